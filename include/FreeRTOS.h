@@ -214,6 +214,46 @@ extern "C" {
 	#define configUSE_COUNTING_SEMAPHORES 0
 #endif
 
+#ifndef configUSE_FAST_SEMAPHORES
+	#define configUSE_FAST_SEMAPHORES 0
+#endif
+
+#ifndef configUSE_SPSC_QUEUES
+	#define configUSE_SPSC_QUEUES 0
+#endif
+
+#ifndef configUSE_ZERO_COPY_QUEUES
+	#define configUSE_ZERO_COPY_QUEUES 0
+#endif
+
+#ifndef configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD
+	#define configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD 0
+#endif
+
+#ifndef configUSE_PRECISE_PRIORITY_INHERITANCE
+	#define configUSE_PRECISE_PRIORITY_INHERITANCE 0
+#endif
+
+#ifndef configUSE_CEILING_MUTEXES
+	#define configUSE_CEILING_MUTEXES 0
+#endif
+
+#ifndef configUSE_QUEUE_WAIT_POLICY
+	#define configUSE_QUEUE_WAIT_POLICY 0
+#endif
+
+#ifndef configUSE_RW_LOCKS
+	#define configUSE_RW_LOCKS 0
+#endif
+
+#ifndef configUSE_MULTI_PRODUCER_STREAM_BUFFERS
+	#define configUSE_MULTI_PRODUCER_STREAM_BUFFERS 0
+#endif
+
+#ifndef configUSE_MULTIPLEXED_STREAM_BUFFERS
+	#define configUSE_MULTIPLEXED_STREAM_BUFFERS 0
+#endif
+
 #ifndef configUSE_ALTERNATIVE_API
 	#define configUSE_ALTERNATIVE_API 0
 #endif
@@ -253,8 +293,15 @@ hold explicit before calling the code. */
 	#define configPRECONDITION_DEFINED 1
 #endif
 
+/* The default portMEMORY_BARRIER() is empty, so does not stop the compiler
+reordering memory accesses across it.  portMEMORY_BARRIER_DEFINED records
+whether the port provided a real barrier, for the features that depend on
+one. */
 #ifndef portMEMORY_BARRIER
 	#define portMEMORY_BARRIER()
+	#define portMEMORY_BARRIER_DEFINED 0
+#else
+	#define portMEMORY_BARRIER_DEFINED 1
 #endif
 
 #ifndef portSOFTWARE_BARRIER
@@ -278,6 +325,38 @@ hold explicit before calling the code. */
 
 #endif /* configUSE_TIMERS */
 
+#ifndef configUSE_TIMER_WHEEL
+	#define configUSE_TIMER_WHEEL 0
+#endif
+
+#ifndef configTIMER_WHEEL_LEVELS
+	#if( configUSE_16_BIT_TICKS == 1 )
+		#define configTIMER_WHEEL_LEVELS 3
+	#else
+		#define configTIMER_WHEEL_LEVELS 4
+	#endif
+#endif
+
+#ifndef configUSE_HARD_TIMERS
+	#define configUSE_HARD_TIMERS 0
+#endif
+
+#ifndef configUSE_DIRECT_TIMER_COMMANDS
+	#define configUSE_DIRECT_TIMER_COMMANDS 0
+#endif
+
+#ifndef configUSE_PREEMPTION_THRESHOLD
+	#define configUSE_PREEMPTION_THRESHOLD 0
+#endif
+
+#ifndef configUSE_EDF_SCHEDULING
+	#define configUSE_EDF_SCHEDULING 0
+#endif
+
+#ifndef configEDF_TASK_PRIORITY
+	#define configEDF_TASK_PRIORITY 1
+#endif
+
 #ifndef portSET_INTERRUPT_MASK_FROM_ISR
 	#define portSET_INTERRUPT_MASK_FROM_ISR() 0
 #endif
@@ -794,6 +873,18 @@ hold explicit before calling the code. */
 	#define configUSE_TIME_SLICING 1
 #endif
 
+#ifndef configUSE_DELAYED_TASK_WHEEL
+	#define configUSE_DELAYED_TASK_WHEEL 0
+#endif
+
+#ifndef configDELAYED_TASK_WHEEL_LEVELS
+	#if( configUSE_16_BIT_TICKS == 1 )
+		#define configDELAYED_TASK_WHEEL_LEVELS 3
+	#else
+		#define configDELAYED_TASK_WHEEL_LEVELS 4
+	#endif
+#endif
+
 #ifndef configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS
 	#define configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS 0
 #endif
@@ -826,6 +917,14 @@ hold explicit before calling the code. */
 	#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
 #endif
 
+/* Setting configUSE_PORT_OPTIMISED_TASK_SELECTION to 2 selects the two level
+ready priority bit map in tasks.c.  That uses portCOUNT_LEADING_ZEROS() if the
+port defines it (only the ARMv7-M ports do at the time of writing), and a
+generic C search of the bit map otherwise, so it can be used with any port. */
+#if( ( configUSE_PORT_OPTIMISED_TASK_SELECTION < 0 ) || ( configUSE_PORT_OPTIMISED_TASK_SELECTION > 2 ) )
+	#error configUSE_PORT_OPTIMISED_TASK_SELECTION must be set to 0, 1 or 2.
+#endif
+
 #ifndef configAPPLICATION_ALLOCATED_HEAP
 	#define configAPPLICATION_ALLOCATED_HEAP 0
 #endif
@@ -834,6 +933,26 @@ hold explicit before calling the code. */
 	#define configUSE_TASK_NOTIFICATIONS 1
 #endif
 
+#ifndef configTASK_NOTIFICATION_ARRAY_ENTRIES
+	#define configTASK_NOTIFICATION_ARRAY_ENTRIES 1
+#endif
+
+#if configTASK_NOTIFICATION_ARRAY_ENTRIES < 1
+	#error configTASK_NOTIFICATION_ARRAY_ENTRIES must be at least 1
+#endif
+
+/* The notification index used by kernel objects, such as stream buffers, that
+notify tasks directly.  By default it is the last index, so applications that
+use more than one index should not use it.  When there is only one index it is
+shared with the application, as in previous versions. */
+#ifndef configKERNEL_NOTIFICATION_INDEX
+	#define configKERNEL_NOTIFICATION_INDEX ( configTASK_NOTIFICATION_ARRAY_ENTRIES - 1 )
+#endif
+
+#if configKERNEL_NOTIFICATION_INDEX >= configTASK_NOTIFICATION_ARRAY_ENTRIES
+	#error configKERNEL_NOTIFICATION_INDEX must be less than configTASK_NOTIFICATION_ARRAY_ENTRIES
+#endif
+
 #ifndef configUSE_POSIX_ERRNO
 	#define configUSE_POSIX_ERRNO 0
 #endif
@@ -880,6 +999,30 @@ hold explicit before calling the code. */
 	#error configUSE_MUTEXES must be set to 1 to use recursive mutexes
 #endif
 
+#if( ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 ) && ( configUSE_MUTEXES != 1 ) )
+	#error configUSE_MUTEXES must be set to 1 to use precise priority inheritance
+#endif
+
+#if( ( configUSE_CEILING_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
+	#error configUSE_MUTEXES must be set to 1 to use priority ceiling mutexes
+#endif
+
+#if( ( configUSE_RW_LOCKS == 1 ) && ( configUSE_MUTEXES != 1 ) )
+	#error configUSE_MUTEXES must be set to 1 to use reader writer locks
+#endif
+
+#if( ( configUSE_SPSC_QUEUES == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 to use SPSC queues
+#endif
+
+#if( ( configUSE_SPSC_QUEUES == 1 ) && ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_MUTEXES != 1 ) )
+	#error Either INCLUDE_xTaskGetCurrentTaskHandle or configUSE_MUTEXES must be set to 1 to use SPSC queues
+#endif
+
+#if( ( configUSE_SPSC_QUEUES == 1 ) && ( portMEMORY_BARRIER_DEFINED == 0 ) )
+	#error portMEMORY_BARRIER() must be defined in portmacro.h to use SPSC queues - a compiler barrier is sufficient on a single core
+#endif
+
 #ifndef configINITIAL_TICK_COUNT
 	#define configINITIAL_TICK_COUNT 0
 #endif
@@ -1131,6 +1274,16 @@ typedef struct xSTATIC_TCB
 	#if ( configUSE_MUTEXES == 1 )
 		UBaseType_t		uxDummy12[ 2 ];
 	#endif
+	#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+		StaticList_t	xDummy24;
+		void			*pvDummy25;
+	#endif
+	#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+		UBaseType_t		uxDummy11;
+	#endif
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+		TickType_t		xDummy13[ 2 ];
+	#endif
 	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
 		void			*pxDummy14;
 	#endif
@@ -1144,8 +1297,9 @@ typedef struct xSTATIC_TCB
 		struct	_reent	xDummy17;
 	#endif
 	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
-		uint32_t 		ulDummy18;
-		uint8_t 		ucDummy19;
+		uint32_t 		ulDummy18[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+		uint8_t 		ucDummy19[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+		uint32_t		ulDummy23;
 	#endif
 	#if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
 		uint8_t			uxDummy20;
@@ -1181,6 +1335,9 @@ typedef struct xSTATIC_QUEUE
 	{
 		void *pvDummy2;
 		UBaseType_t uxDummy2;
+		#if ( configUSE_CEILING_MUTEXES == 1 )
+			UBaseType_t uxDummy12[ 2 ];
+		#endif
 	} u;
 
 	StaticList_t xDummy3[ 2 ];
@@ -1200,9 +1357,105 @@ typedef struct xSTATIC_QUEUE
 		uint8_t ucDummy9;
 	#endif
 
+	#if ( configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD > 0 )
+		UBaseType_t uxDummy10[ 2 ];
+	#endif
+
+	#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+		StaticListItem_t xDummy11;
+	#endif
+
+	#if ( configUSE_QUEUE_WAIT_POLICY == 1 )
+		uint8_t ucDummy13;
+	#endif
+
 } StaticQueue_t;
 typedef StaticQueue_t StaticSemaphore_t;
 
+/*
+ * In line with software engineering best practice, especially when supplying a
+ * library that is likely to change in future versions, FreeRTOS implements a
+ * strict data hiding policy.  This means the fast semaphore structure used
+ * internally by FreeRTOS is not accessible to application code.  However, if
+ * the application writer wants to statically allocate the memory required to
+ * create a fast semaphore then the size of the fast semaphore object needs to
+ * be know.  The StaticFastSemaphore_t structure below is provided for this
+ * purpose.  Its sizes and alignment requirements are guaranteed to match those
+ * of the genuine structure, no matter which architecture is being used, and no
+ * matter how the values in FreeRTOSConfig.h are set.  Its contents are somewhat
+ * obfuscated in the hope users will recognise that it would be unwise to make
+ * direct use of the structure members.
+ */
+typedef struct xSTATIC_FAST_SEMAPHORE
+{
+	StaticQueue_t xDummy1;
+	void *pvDummy2;
+	uint32_t ulDummy3;
+	UBaseType_t uxDummy4;
+
+} StaticFastSemaphore_t;
+
+/*
+ * In line with software engineering best practice, especially when supplying a
+ * library that is likely to change in future versions, FreeRTOS implements a
+ * strict data hiding policy.  This means the SPSC queue structure used
+ * internally by FreeRTOS is not accessible to application code.  However, if
+ * the application writer wants to statically allocate the memory required to
+ * create an SPSC queue then the size of the queue object needs to be know.  The
+ * StaticSPSCQueue_t structure below is provided for this purpose.  Its sizes
+ * and alignment requirements are guaranteed to match those of the genuine
+ * structure, no matter which architecture is being used, and no matter how the
+ * values in FreeRTOSConfig.h are set.  Its contents are somewhat obfuscated in
+ * the hope users will recognise that it would be unwise to make direct use of
+ * the structure members.
+ */
+typedef struct xSTATIC_SPSC_QUEUE
+{
+	void *pvDummy1;
+	UBaseType_t uxDummy2[ 4 ];
+	void *pvDummy3;
+
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucDummy4;
+	#endif
+
+} StaticSPSCQueue_t;
+
+/*
+ * In line with software engineering best practice, FreeRTOS implements a strict
+ * data hiding policy, so the real zero copy queue structure is not accessible
+ * to the application.  The StaticZeroCopyQueue_t structure below is provided so
+ * the application writer can statically allocate the memory required to create
+ * a zero copy queue.  Its size and alignment requirements are guaranteed to
+ * match those of the genuine structure.
+ */
+typedef struct xSTATIC_ZERO_COPY_QUEUE
+{
+	StaticQueue_t xDummy1;
+	void *pvDummy2[ 2 ];
+	UBaseType_t uxDummy3;
+} StaticZeroCopyQueue_t;
+
+/*
+ * In line with software engineering best practice, FreeRTOS implements a strict
+ * data hiding policy, so the real reader writer lock structure is not
+ * accessible to the application.  The StaticRWLock_t structure below is
+ * provided so the application writer can statically allocate the memory
+ * required to create a reader writer lock.  Its size and alignment
+ * requirements are guaranteed to match those of the genuine structure.
+ */
+typedef struct xSTATIC_RW_LOCK
+{
+	StaticList_t xDummy1[ 2 ];
+	void *pvDummy2[ 2 ];
+	UBaseType_t uxDummy3[ 2 ];
+
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucDummy4;
+	#endif
+
+} StaticRWLock_t;
+
 /*
  * In line with software engineering best practice, especially when supplying a
  * library that is likely to change in future versions, FreeRTOS implements a
@@ -1282,6 +1535,11 @@ typedef struct xSTATIC_STREAM_BUFFER
 	#if ( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t uxDummy4;
 	#endif
+	#if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+		size_t uxDummy5;
+		UBaseType_t uxDummy6;
+		StaticList_t xDummy7;
+	#endif
 } StaticStreamBuffer_t;
 
 /* Message buffers are built on stream buffers. */
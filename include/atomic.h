@@ -407,6 +407,145 @@ uint32_t ulCurrent;
 	return ulCurrent;
 }
 
+/*----------------------------- Sequence lock ------------------------------*/
+
+/*
+ * A sequence lock lets one writer publish data that is larger than a single
+ * word to any number of readers without either side entering a critical
+ * section.  The writer never waits for readers.  A reader that overlaps a write
+ * detects it and reads the data again.
+ *
+ * The sequence count is odd while a write is in progress and is incremented
+ * again when the write completes, so a reader that sees the same even count
+ * before and after copying the data has a consistent copy.  The sequence count
+ * must be initialised to zero.
+ *
+ * Only one write can be in progress at a time.  If more than one task or
+ * interrupt can write, the writes must be serialised by other means.  A
+ * reader retries for as long as a write is in progress, so the writer should
+ * be an interrupt, or a task that cannot be preempted mid write by the
+ * readers.
+ *
+ * Example usage:
+ *
+ *   // Writer, for example an ISR.
+ *   Atomic_SeqWriteBegin_u32( &ulSequence );
+ *   xShared = xNewSample;
+ *   Atomic_SeqWriteEnd_u32( &ulSequence );
+ *
+ *   // Reader.
+ *   do
+ *   {
+ *       ulStart = Atomic_SeqReadBegin_u32( &ulSequence );
+ *       xLocal = xShared;
+ *   } while( Atomic_SeqReadRetry_u32( &ulSequence, ulStart ) != 0U );
+ *
+ * The sequence lock is only correct if neither the compiler nor the processor
+ * moves accesses to the protected data across accesses to the sequence count.
+ * The default portMEMORY_BARRIER() is empty, so the functions below use
+ * ATOMIC_SEQUENCE_BARRIER() instead:
+ *
+ *   + portMEMORY_BARRIER() if the port defines it.
+ *   + Otherwise, when the compiler is GCC compatible, a compiler barrier,
+ *     which is sufficient because the kernel runs on a single core.
+ *   + Otherwise the sequence lock functions are not available, and the port
+ *     must define portMEMORY_BARRIER() before they can be used.
+ */
+
+#if ( portMEMORY_BARRIER_DEFINED == 1 )
+	#define ATOMIC_SEQUENCE_BARRIER()	portMEMORY_BARRIER()
+#elif defined( __GNUC__ )
+	#define ATOMIC_SEQUENCE_BARRIER()	__asm volatile ( "" ::: "memory" )
+#endif
+
+#ifdef ATOMIC_SEQUENCE_BARRIER
+
+/**
+ * Sequence lock write begin
+ *
+ * @brief Marks the start of a write to the data protected by a sequence count.
+ *
+ * @param[in,out] pulSequence  Pointer to the sequence count.
+ */
+static portFORCE_INLINE void Atomic_SeqWriteBegin_u32( uint32_t volatile * pulSequence )
+{
+	*pulSequence += 1U;
+
+	/* The count must be seen to change before any of the data does. */
+	ATOMIC_SEQUENCE_BARRIER();
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Sequence lock write end
+ *
+ * @brief Marks the end of a write started by Atomic_SeqWriteBegin_u32().
+ *
+ * @param[in,out] pulSequence  Pointer to the sequence count.
+ */
+static portFORCE_INLINE void Atomic_SeqWriteEnd_u32( uint32_t volatile * pulSequence )
+{
+	/* All the data must be written before the count changes again. */
+	ATOMIC_SEQUENCE_BARRIER();
+
+	*pulSequence += 1U;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Sequence lock read begin
+ *
+ * @brief Samples the sequence count before the protected data is read.
+ *
+ * @param[in] pulSequence  Pointer to the sequence count.
+ *
+ * @return The sequence count, to be passed to Atomic_SeqReadRetry_u32() once
+ *         the data has been read.
+ */
+static portFORCE_INLINE uint32_t Atomic_SeqReadBegin_u32( uint32_t const volatile * pulSequence )
+{
+uint32_t ulSequence;
+
+	ulSequence = *pulSequence;
+
+	/* The count must be read before any of the data is. */
+	ATOMIC_SEQUENCE_BARRIER();
+
+	return ulSequence;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Sequence lock read retry
+ *
+ * @brief Determines whether the data read since Atomic_SeqReadBegin_u32() may
+ *        have been torn by a write.
+ *
+ * @param[in] pulSequence  Pointer to the sequence count.
+ * @param[in] ulStart      Value returned by Atomic_SeqReadBegin_u32().
+ *
+ * @return Unsigned integer of value 1 or 0. 1 if the data must be read again,
+ *         0 if the copy read is consistent.
+ */
+static portFORCE_INLINE uint32_t Atomic_SeqReadRetry_u32( uint32_t const volatile * pulSequence,
+														  uint32_t ulStart )
+{
+uint32_t ulReturnValue = 0U;
+
+	/* All the data must be read before the count is read again. */
+	ATOMIC_SEQUENCE_BARRIER();
+
+	/* An odd starting count means a write was already in progress. */
+	if( ( ( ulStart & 1U ) != 0U ) || ( *pulSequence != ulStart ) )
+	{
+		ulReturnValue = 1U;
+	}
+
+	return ulReturnValue;
+}
+
+#endif /* ATOMIC_SEQUENCE_BARRIER */
+
 #ifdef __cplusplus
 }
 #endif
@@ -368,6 +368,22 @@ void vListInitialiseItem( ListItem_t * const pxItem ) PRIVILEGED_FUNCTION;
  */
 void vListInsert( List_t * const pxList, ListItem_t * const pxNewListItem ) PRIVILEGED_FUNCTION;
 
+/*
+ * Insert a list item into a list in ascending item value order, where the
+ * item values are tick times that may have wrapped around.  An item value is
+ * ordered before another if it is less than half the range of TickType_t
+ * before it.  Used to keep the ready list of EDF scheduled tasks in deadline
+ * order.
+ *
+ * @param pxList The list into which the item is to be inserted.
+ *
+ * @param pxNewListItem The item that is to be placed in the list.
+ *
+ * \page vListInsertWrapped vListInsertWrapped
+ * \ingroup LinkedList
+ */
+void vListInsertWrapped( List_t * const pxList, ListItem_t * const pxNewListItem ) PRIVILEGED_FUNCTION;
+
 /*
  * Insert a list item into a list.  The item will be inserted in a position
  * such that it will be the last item within the list returned by multiple
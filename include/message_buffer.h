@@ -49,6 +49,10 @@
  * (such as xMessageBufferRead()) inside a critical section and set the receive
  * timeout to 0.
  *
+ * The exception is a message buffer created with
+ * xMessageBufferCreateMultiProducer(), which any number of tasks and interrupts
+ * can write to at the same time.  There must still be only one reader.
+ *
  * Message buffers hold variable length messages.  To enable that, when a
  * message is written to the message buffer an additional sizeof( size_t ) bytes
  * are also written to store the message's length (that happens internally, with
@@ -81,6 +85,9 @@ extern "C" {
  */
 typedef void * MessageBufferHandle_t;
 
+/* Message buffers are built on stream buffers. */
+typedef StreamBufferFragment_t MessageBufferFragment_t;
+
 /*-----------------------------------------------------------*/
 
 /**
@@ -139,7 +146,7 @@ const size_t xMessageBufferSizeBytes = 100;
  * \defgroup xMessageBufferCreate xMessageBufferCreate
  * \ingroup MessageBufferManagement
  */
-#define xMessageBufferCreate( xBufferSizeBytes ) ( MessageBufferHandle_t ) xStreamBufferGenericCreate( xBufferSizeBytes, ( size_t ) 0, pdTRUE )
+#define xMessageBufferCreate( xBufferSizeBytes ) ( MessageBufferHandle_t ) xStreamBufferGenericCreate( xBufferSizeBytes, ( size_t ) 0, sbTYPE_MESSAGE_BUFFER )
 
 /**
  * message_buffer.h
@@ -205,7 +212,46 @@ MessageBufferHandle_t xMessageBuffer;
  * \defgroup xMessageBufferCreateStatic xMessageBufferCreateStatic
  * \ingroup MessageBufferManagement
  */
-#define xMessageBufferCreateStatic( xBufferSizeBytes, pucMessageBufferStorageArea, pxStaticMessageBuffer ) ( MessageBufferHandle_t ) xStreamBufferGenericCreateStatic( xBufferSizeBytes, 0, pdTRUE, pucMessageBufferStorageArea, pxStaticMessageBuffer )
+#define xMessageBufferCreateStatic( xBufferSizeBytes, pucMessageBufferStorageArea, pxStaticMessageBuffer ) ( MessageBufferHandle_t ) xStreamBufferGenericCreateStatic( xBufferSizeBytes, 0, sbTYPE_MESSAGE_BUFFER, pucMessageBufferStorageArea, pxStaticMessageBuffer )
+
+/**
+ * message_buffer.h
+ *
+<pre>
+MessageBufferHandle_t xMessageBufferCreateMultiProducer( size_t xBufferSizeBytes );
+MessageBufferHandle_t xMessageBufferCreateMultiProducerStatic( size_t xBufferSizeBytes,
+                                                               uint8_t *pucMessageBufferStorageArea,
+                                                               StaticMessageBuffer_t *pxStaticMessageBuffer );
+</pre>
+ *
+ * Creates a message buffer that more than one task or interrupt can write to
+ * at the same time.  The parameters and return value are the same as those of
+ * xMessageBufferCreate() and xMessageBufferCreateStatic().
+ *
+ * Each writer claims the space needed for its message, copies the message into
+ * that space with interrupts enabled, then publishes it.  Writers therefore do
+ * not have to be serialised by a mutex, and a low priority writer that is
+ * preempted part way through a copy does not hold up a higher priority writer.
+ * Messages become visible to the reader in the order their space was claimed,
+ * once all the writers that claimed space before them have also finished, so
+ * a message is never seen partially written.  Any number of writers can be
+ * blocked waiting for space at once.  There must still be only one reader.
+ *
+ * When a message is read from an interrupt only the highest priority writer
+ * that is blocked waiting for space is unblocked, so the time the interrupt
+ * runs with interrupts masked does not grow with the number of blocked
+ * writers.  That writer unblocks the others, one at a time, when it next runs.
+ *
+ * configUSE_MULTI_PRODUCER_STREAM_BUFFERS must be set to 1 in FreeRTOSConfig.h
+ * for these macros to be available.
+ *
+ * \defgroup xMessageBufferCreateMultiProducer xMessageBufferCreateMultiProducer
+ * \ingroup MessageBufferManagement
+ */
+#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+	#define xMessageBufferCreateMultiProducer( xBufferSizeBytes ) ( MessageBufferHandle_t ) xStreamBufferGenericCreate( xBufferSizeBytes, ( size_t ) 0, sbTYPE_MESSAGE_BUFFER | sbTYPE_MULTI_PRODUCER )
+	#define xMessageBufferCreateMultiProducerStatic( xBufferSizeBytes, pucMessageBufferStorageArea, pxStaticMessageBuffer ) ( MessageBufferHandle_t ) xStreamBufferGenericCreateStatic( xBufferSizeBytes, 0, sbTYPE_MESSAGE_BUFFER | sbTYPE_MULTI_PRODUCER, pucMessageBufferStorageArea, pxStaticMessageBuffer )
+#endif
 
 /**
  * message_buffer.h
@@ -410,6 +456,66 @@ BaseType_t xHigherPriorityTaskWoken = pdFALSE; // Initialised to pdFALSE.
  */
 #define xMessageBufferSendFromISR( xMessageBuffer, pvTxData, xDataLengthBytes, pxHigherPriorityTaskWoken ) xStreamBufferSendFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pvTxData, xDataLengthBytes, pxHigherPriorityTaskWoken )
 
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferSendV( MessageBufferHandle_t xMessageBuffer,
+                            const MessageBufferFragment_t *pxFragments,
+                            UBaseType_t uxFragmentCount,
+                            TickType_t xTicksToWait );
+</pre>
+ *
+ * Sends a single message made up of the bytes held in several separate
+ * buffers, for example a header, a payload and a trailer.  The message is the
+ * same as if the fragments had first been copied into one buffer and passed to
+ * xMessageBufferSend(), but the bytes are copied straight from each fragment
+ * into the message buffer so no staging buffer is needed.
+ *
+ * The length of the message is the total length of all the fragments.  Either
+ * the whole message is written or, if there is not enough space before the
+ * block time expires, nothing is written.  The reader receives the fragments as
+ * one message, in the order they appear in the pxFragments array.
+ *
+ * @param xMessageBuffer The handle of the message buffer to which a message is
+ * being sent.
+ *
+ * @param pxFragments An array of uxFragmentCount fragments, each of which
+ * holds a pointer to some bytes and the number of bytes to copy from there.
+ *
+ * @param uxFragmentCount The number of fragments in the pxFragments array.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should remain
+ * in the Blocked state to wait for enough space to become available in the
+ * message buffer.
+ *
+ * @return The total length of the fragments if the message was written,
+ * otherwise 0.
+ *
+ * \defgroup xMessageBufferSendV xMessageBufferSendV
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferSendV( xMessageBuffer, pxFragments, uxFragmentCount, xTicksToWait ) xStreamBufferSendV( ( StreamBufferHandle_t ) xMessageBuffer, pxFragments, uxFragmentCount, xTicksToWait )
+
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferSendVFromISR( MessageBufferHandle_t xMessageBuffer,
+                                   const MessageBufferFragment_t *pxFragments,
+                                   UBaseType_t uxFragmentCount,
+                                   BaseType_t *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Interrupt safe version of xMessageBufferSendV().  The
+ * pxHigherPriorityTaskWoken parameter behaves as for
+ * xMessageBufferSendFromISR().
+ *
+ * \defgroup xMessageBufferSendVFromISR xMessageBufferSendVFromISR
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferSendVFromISR( xMessageBuffer, pxFragments, uxFragmentCount, pxHigherPriorityTaskWoken ) xStreamBufferSendVFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pxFragments, uxFragmentCount, pxHigherPriorityTaskWoken )
+
 /**
  * message_buffer.h
  *
@@ -48,16 +48,21 @@ only for ports that are using the MPU. */
 		/* Map standard tasks.h API functions to the MPU equivalents. */
 		#define xTaskCreate								MPU_xTaskCreate
 		#define xTaskCreateStatic						MPU_xTaskCreateStatic
+		#define xTaskCreateEDF							MPU_xTaskCreateEDF
+		#define xTaskCreateEDFStatic					MPU_xTaskCreateEDFStatic
 		#define xTaskCreateRestricted					MPU_xTaskCreateRestricted
 		#define vTaskAllocateMPURegions					MPU_vTaskAllocateMPURegions
 		#define vTaskDelete								MPU_vTaskDelete
 		#define vTaskDelay								MPU_vTaskDelay
 		#define vTaskDelayUntil							MPU_vTaskDelayUntil
+		#define vTaskWaitForNextPeriod					MPU_vTaskWaitForNextPeriod
 		#define xTaskAbortDelay							MPU_xTaskAbortDelay
 		#define uxTaskPriorityGet						MPU_uxTaskPriorityGet
 		#define eTaskGetState							MPU_eTaskGetState
 		#define vTaskGetInfo							MPU_vTaskGetInfo
 		#define vTaskPrioritySet						MPU_vTaskPrioritySet
+		#define vTaskPreemptionThresholdSet				MPU_vTaskPreemptionThresholdSet
+		#define uxTaskPreemptionThresholdGet			MPU_uxTaskPreemptionThresholdGet
 		#define vTaskSuspend							MPU_vTaskSuspend
 		#define vTaskResume								MPU_vTaskResume
 		#define vTaskSuspendAll							MPU_vTaskSuspendAll
@@ -79,10 +84,11 @@ only for ports that are using the MPU. */
 		#define vTaskGetRunTimeStats					MPU_vTaskGetRunTimeStats
 		#define ulTaskGetIdleRunTimeCounter				MPU_ulTaskGetIdleRunTimeCounter
 		#define xTaskGenericNotify						MPU_xTaskGenericNotify
-		#define xTaskNotifyWait							MPU_xTaskNotifyWait
-		#define ulTaskNotifyTake						MPU_ulTaskNotifyTake
-		#define xTaskNotifyStateClear					MPU_xTaskNotifyStateClear
-		#define ulTaskNotifyValueClear					MPU_ulTaskNotifyValueClear
+		#define xTaskGenericNotifyWait					MPU_xTaskGenericNotifyWait
+		#define xTaskGenericNotifyWaitBits				MPU_xTaskGenericNotifyWaitBits
+		#define ulTaskGenericNotifyTake					MPU_ulTaskGenericNotifyTake
+		#define xTaskGenericNotifyStateClear			MPU_xTaskGenericNotifyStateClear
+		#define ulTaskGenericNotifyValueClear			MPU_ulTaskGenericNotifyValueClear
 		#define xTaskCatchUpTicks						MPU_xTaskCatchUpTicks
 
 		#define xTaskGetCurrentTaskHandle				MPU_xTaskGetCurrentTaskHandle
@@ -93,15 +99,42 @@ only for ports that are using the MPU. */
 		/* Map standard queue.h API functions to the MPU equivalents. */
 		#define xQueueGenericSend						MPU_xQueueGenericSend
 		#define xQueueReceive							MPU_xQueueReceive
+		#define xQueueSendMultiple						MPU_xQueueSendMultiple
+		#define xQueueReceiveMultiple					MPU_xQueueReceiveMultiple
 		#define xQueuePeek								MPU_xQueuePeek
 		#define xQueueSemaphoreTake						MPU_xQueueSemaphoreTake
 		#define uxQueueMessagesWaiting					MPU_uxQueueMessagesWaiting
 		#define uxQueueSpacesAvailable					MPU_uxQueueSpacesAvailable
 		#define vQueueDelete							MPU_vQueueDelete
+		#define vQueueSetWaitPolicy						MPU_vQueueSetWaitPolicy
 		#define xQueueCreateMutex						MPU_xQueueCreateMutex
 		#define xQueueCreateMutexStatic					MPU_xQueueCreateMutexStatic
+		#define xQueueCreateCeilingMutex				MPU_xQueueCreateCeilingMutex
+		#define xQueueCreateCeilingMutexStatic			MPU_xQueueCreateCeilingMutexStatic
 		#define xQueueCreateCountingSemaphore			MPU_xQueueCreateCountingSemaphore
 		#define xQueueCreateCountingSemaphoreStatic		MPU_xQueueCreateCountingSemaphoreStatic
+		#define xQueueCreateFastSemaphore				MPU_xQueueCreateFastSemaphore
+		#define xQueueCreateFastSemaphoreStatic			MPU_xQueueCreateFastSemaphoreStatic
+		#define xQueueFastSemaphoreTake					MPU_xQueueFastSemaphoreTake
+		#define xQueueFastSemaphoreGive					MPU_xQueueFastSemaphoreGive
+		#define xQueueCreateSPSC						MPU_xQueueCreateSPSC
+		#define xQueueCreateSPSCStatic					MPU_xQueueCreateSPSCStatic
+		#define xQueueSPSCSend							MPU_xQueueSPSCSend
+		#define xQueueSPSCReceive						MPU_xQueueSPSCReceive
+		#define uxQueueSPSCMessagesWaiting				MPU_uxQueueSPSCMessagesWaiting
+		#define vQueueSPSCDelete						MPU_vQueueSPSCDelete
+		#define xQueueCreateZeroCopy					MPU_xQueueCreateZeroCopy
+		#define xQueueCreateZeroCopyStatic				MPU_xQueueCreateZeroCopyStatic
+		#define pvQueueZeroCopyAcquire					MPU_pvQueueZeroCopyAcquire
+		#define xQueueZeroCopyCommit					MPU_xQueueZeroCopyCommit
+		#define pvQueueZeroCopyReceive					MPU_pvQueueZeroCopyReceive
+		#define vQueueZeroCopyRelease					MPU_vQueueZeroCopyRelease
+		#define vQueueZeroCopyDelete					MPU_vQueueZeroCopyDelete
+		#define xQueueCreateRWLock						MPU_xQueueCreateRWLock
+		#define xQueueCreateRWLockStatic				MPU_xQueueCreateRWLockStatic
+		#define xQueueTakeRWLock						MPU_xQueueTakeRWLock
+		#define xQueueGiveRWLock						MPU_xQueueGiveRWLock
+		#define vQueueDeleteRWLock						MPU_vQueueDeleteRWLock
 		#define xQueueGetMutexHolder					MPU_xQueueGetMutexHolder
 		#define xQueueTakeMutexRecursive				MPU_xQueueTakeMutexRecursive
 		#define xQueueGiveMutexRecursive				MPU_xQueueGiveMutexRecursive
@@ -122,6 +155,8 @@ only for ports that are using the MPU. */
 		/* Map standard timer.h API functions to the MPU equivalents. */
 		#define xTimerCreate							MPU_xTimerCreate
 		#define xTimerCreateStatic						MPU_xTimerCreateStatic
+		#define xTimerCreateHard						MPU_xTimerCreateHard
+		#define xTimerCreateHardStatic					MPU_xTimerCreateHardStatic
 		#define pvTimerGetTimerID						MPU_pvTimerGetTimerID
 		#define vTimerSetTimerID						MPU_vTimerSetTimerID
 		#define xTimerIsTimerActive						MPU_xTimerIsTimerActive
@@ -146,7 +181,12 @@ only for ports that are using the MPU. */
 		/* Map standard message/stream_buffer.h API functions to the MPU
 		equivalents. */
 		#define xStreamBufferSend						MPU_xStreamBufferSend
+		#define xStreamBufferSendV						MPU_xStreamBufferSendV
+		#define xStreamBufferSendReserve				MPU_xStreamBufferSendReserve
+		#define xStreamBufferSendCommit					MPU_xStreamBufferSendCommit
 		#define xStreamBufferReceive					MPU_xStreamBufferReceive
+		#define xStreamBufferReceivePeek				MPU_xStreamBufferReceivePeek
+		#define xStreamBufferReceiveConsume				MPU_xStreamBufferReceiveConsume
 		#define xStreamBufferNextMessageLengthBytes		MPU_xStreamBufferNextMessageLengthBytes
 		#define vStreamBufferDelete						MPU_vStreamBufferDelete
 		#define xStreamBufferIsFull						MPU_xStreamBufferIsFull
@@ -157,6 +197,13 @@ only for ports that are using the MPU. */
 		#define xStreamBufferSetTriggerLevel			MPU_xStreamBufferSetTriggerLevel
 		#define xStreamBufferGenericCreate				MPU_xStreamBufferGenericCreate
 		#define xStreamBufferGenericCreateStatic		MPU_xStreamBufferGenericCreateStatic
+		#define xStreamBufferMuxCreate					MPU_xStreamBufferMuxCreate
+		#define xStreamBufferMuxSend					MPU_xStreamBufferMuxSend
+		#define xStreamBufferMuxReceive					MPU_xStreamBufferMuxReceive
+		#define xStreamBufferMuxBytesAvailable			MPU_xStreamBufferMuxBytesAvailable
+		#define xStreamBufferMuxSpacesAvailable			MPU_xStreamBufferMuxSpacesAvailable
+		#define xStreamBufferMuxSetTriggerLevel			MPU_xStreamBufferMuxSetTriggerLevel
+		#define vStreamBufferMuxDelete					MPU_vStreamBufferMuxDelete
 
 
 		/* Remove the privileged function macro, but keep the PRIVILEGED_DATA
@@ -61,6 +61,41 @@ typedef struct QueueDefinition * QueueSetHandle_t;
  */
 typedef struct QueueDefinition * QueueSetMemberHandle_t;
 
+/**
+ * Type by which fast semaphores are referenced.  For example, a call to
+ * xSemaphoreCreateFastMutex() returns a FastSemaphoreHandle_t variable that can
+ * then be used as a parameter to xSemaphoreFastTake(), xSemaphoreFastGive(),
+ * etc.
+ */
+struct FastSemaphoreDefinition;
+typedef struct FastSemaphoreDefinition * FastSemaphoreHandle_t;
+
+/**
+ * Type by which single producer single consumer queues are referenced.  For
+ * example, a call to xQueueCreateSPSC() returns an SPSCQueueHandle_t variable
+ * that can then be used as a parameter to xQueueSPSCSend(),
+ * xQueueSPSCReceive(), etc.
+ */
+struct SPSCQueueDefinition;
+typedef struct SPSCQueueDefinition * SPSCQueueHandle_t;
+
+/**
+ * Type by which zero copy queues are referenced.  For example, a call to
+ * xQueueCreateZeroCopy() returns a ZeroCopyQueueHandle_t variable that can then
+ * be used as a parameter to pvQueueZeroCopyAcquire(), xQueueZeroCopyCommit(),
+ * etc.
+ */
+struct ZeroCopyQueueDefinition;
+typedef struct ZeroCopyQueueDefinition * ZeroCopyQueueHandle_t;
+
+/**
+ * Type by which reader writer locks are referenced.  For example, a call to
+ * xSemaphoreCreateRWLock() returns an RWLockHandle_t variable that can then be
+ * used as a parameter to xSemaphoreTakeRead(), xSemaphoreTakeWrite(), etc.
+ */
+struct RWLockDefinition;
+typedef struct RWLockDefinition * RWLockHandle_t;
+
 /* For internal use only. */
 #define	queueSEND_TO_BACK		( ( BaseType_t ) 0 )
 #define	queueSEND_TO_FRONT		( ( BaseType_t ) 1 )
@@ -74,6 +109,10 @@ typedef struct QueueDefinition * QueueSetMemberHandle_t;
 #define queueQUEUE_TYPE_BINARY_SEMAPHORE	( ( uint8_t ) 3U )
 #define queueQUEUE_TYPE_RECURSIVE_MUTEX		( ( uint8_t ) 4U )
 
+/* Wait policies that can be passed to vQueueSetWaitPolicy(). */
+#define queueWAIT_POLICY_PRIORITY			( ( uint8_t ) 0U )
+#define queueWAIT_POLICY_FIFO				( ( uint8_t ) 1U )
+
 /**
  * queue. h
  * <pre>
@@ -867,6 +906,100 @@ BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue, void * const pvBuffer ) PRIV
  */
 BaseType_t xQueueReceive( QueueHandle_t xQueue, void * const pvBuffer, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueSendMultiple(
+								  QueueHandle_t xQueue,
+								  const void *pvItemsToQueue,
+								  UBaseType_t uxItemCount,
+								  TickType_t xTicksToWait
+							  );
+ * </pre>
+ *
+ * Post up to uxItemCount items to the back of a queue in a single operation.
+ * The items are copied into the queue within one critical section, waiting
+ * tasks are unblocked within that same critical section, and the calling task
+ * yields at most once, making this more efficient than calling xQueueSend()
+ * uxItemCount times.
+ *
+ * If there is space for fewer than uxItemCount items then as many items as
+ * will fit are posted and the function returns without waiting for space for
+ * the rest.  The function only blocks if the queue is full when it is called.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItemsToQueue A pointer to an array of uxItemCount items, each the
+ * size defined when the queue was created.
+ *
+ * @param uxItemCount The number of items in the array.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for space to become available on the queue, should it already be full.
+ *
+ * @return The number of items posted, which will be 0 (errQUEUE_FULL) if the
+ * queue remained full until the block time expired.
+ *
+ * Example usage:
+   <pre>
+ void vForwardPackets( QueueHandle_t xQueue, struct APacket *pxPackets, UBaseType_t uxCount )
+ {
+ BaseType_t xSent;
+
+	while( uxCount > 0 )
+	{
+		// Post as many packets as possible in one go, waiting for space if
+		// the queue is full.
+		xSent = xQueueSendMultiple( xQueue, pxPackets, uxCount, portMAX_DELAY );
+		pxPackets += xSent;
+		uxCount -= ( UBaseType_t ) xSent;
+	}
+ }
+ </pre>
+ * \defgroup xQueueSendMultiple xQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItemsToQueue, const UBaseType_t uxItemCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueReceiveMultiple(
+								  QueueHandle_t xQueue,
+								  void *pvBuffer,
+								  UBaseType_t uxMaxItems,
+								  TickType_t xTicksToWait
+							  );
+ * </pre>
+ *
+ * Receive up to uxMaxItems items from the front of a queue in a single
+ * operation.  The items are copied out of the queue within one critical
+ * section, tasks waiting for space are unblocked within that same critical
+ * section, and the calling task yields at most once.
+ *
+ * The function only blocks if the queue is empty when it is called, and
+ * returns as soon as at least one item has been received.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to a buffer large enough to hold uxMaxItems items.
+ * The items are written to the buffer in the order in which they were
+ * received.
+ *
+ * @param uxMaxItems The maximum number of items to receive.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for an item to receive should the queue be empty at the time of the call.
+ *
+ * @return The number of items received, which will be 0 (errQUEUE_EMPTY) if
+ * the queue remained empty until the block time expired.
+ *
+ * \defgroup xQueueReceiveMultiple xQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxItems, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
 /**
  * queue. h
  * <pre>UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue );</pre>
@@ -913,6 +1046,49 @@ UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue ) PRIVILEGED_FUNC
  */
 void vQueueDelete( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * <pre>void vQueueSetWaitPolicy( QueueHandle_t xQueue, uint8_t ucWaitPolicy );</pre>
+ *
+ * Sets the order in which tasks blocked on a queue or semaphore are woken.
+ * configUSE_QUEUE_WAIT_POLICY must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * By default (queueWAIT_POLICY_PRIORITY) the highest priority blocked task is
+ * woken first, which costs a sorted insert each time a task blocks.  With
+ * queueWAIT_POLICY_FIFO tasks are woken in the order in which they blocked,
+ * and blocking costs a constant time insert.  FIFO suits queues shared by
+ * tasks of the same priority, such as a pool of worker tasks.
+ *
+ * The policy must be set after the queue is created and before any task
+ * blocks on it.  Mutexes must use queueWAIT_POLICY_PRIORITY.
+ *
+ * @param xQueue A handle to the queue or semaphore.
+ *
+ * @param ucWaitPolicy Either queueWAIT_POLICY_PRIORITY or
+ * queueWAIT_POLICY_FIFO.
+ *
+ * Example usage:
+   <pre>
+ QueueHandle_t xWorkQueue;
+
+ void vCreateWorkQueue( void )
+ {
+    xWorkQueue = xQueueCreate( 10, sizeof( WorkItem_t ) );
+
+    if( xWorkQueue != NULL )
+    {
+        // All the worker tasks run at the same priority, so wake them in
+        // turn rather than searching for the highest priority one.
+        vQueueSetWaitPolicy( xWorkQueue, queueWAIT_POLICY_FIFO );
+    }
+ }
+   </pre>
+ * \defgroup vQueueSetWaitPolicy vQueueSetWaitPolicy
+ * \ingroup QueueManagement
+ */
+void vQueueSetWaitPolicy( QueueHandle_t xQueue, const uint8_t ucWaitPolicy ) PRIVILEGED_FUNCTION;
+
 /**
  * queue. h
  * <pre>
@@ -1384,6 +1560,71 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherP
  */
 BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue, void * const pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueSendMultipleFromISR(
+										 QueueHandle_t xQueue,
+										 const void *pvItemsToQueue,
+										 UBaseType_t uxItemCount,
+										 BaseType_t *pxHigherPriorityTaskWoken
+									 );
+ * </pre>
+ *
+ * A version of xQueueSendMultiple() that can be called from an interrupt
+ * service routine.  As many of the items as will fit are posted, with interrupts
+ * masked only once.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItemsToQueue A pointer to an array of uxItemCount items.
+ *
+ * @param uxItemCount The number of items in the array.
+ *
+ * @param pxHigherPriorityTaskWoken xQueueSendMultipleFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if posting the items caused a task to
+ * unblock, and the unblocked task has a priority higher than the currently
+ * running task.
+ *
+ * @return The number of items posted.
+ *
+ * \defgroup xQueueSendMultipleFromISR xQueueSendMultipleFromISR
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItemsToQueue, const UBaseType_t uxItemCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueReceiveMultipleFromISR(
+											QueueHandle_t xQueue,
+											void *pvBuffer,
+											UBaseType_t uxMaxItems,
+											BaseType_t *pxHigherPriorityTaskWoken
+										);
+ * </pre>
+ *
+ * A version of xQueueReceiveMultiple() that can be called from an interrupt
+ * service routine.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to a buffer large enough to hold uxMaxItems items.
+ *
+ * @param uxMaxItems The maximum number of items to receive.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if receiving the items caused
+ * a task waiting to send to unblock, and the unblocked task has a priority
+ * higher than the currently running task.
+ *
+ * @return The number of items received.
+ *
+ * \defgroup xQueueReceiveMultipleFromISR xQueueReceiveMultipleFromISR
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxItems, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /*
  * Utilities to query queues that are safe to use from an ISR.  These utilities
  * should be used only from witin an ISR, or within a critical section.
@@ -1392,6 +1633,481 @@ BaseType_t xQueueIsQueueEmptyFromISR( const QueueHandle_t xQueue ) PRIVILEGED_FU
 BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * <pre>
+ SPSCQueueHandle_t xQueueCreateSPSC(
+							  UBaseType_t uxQueueLength,
+							  UBaseType_t uxItemSize
+						  );
+ * </pre>
+ *
+ * Creates a queue that has exactly one producer and exactly one consumer, and
+ * returns a handle by which the queue can be referenced.
+ * configUSE_SPSC_QUEUES must be set to 1 in FreeRTOSConfig.h for this function
+ * to be available.
+ *
+ * Because only one context ever writes to each end of the queue, items are
+ * passed without entering a critical section, making SPSC queues suitable for
+ * streaming data from an interrupt to a task at a high rate.  Interrupts are
+ * only masked when the consumer is blocked and has to be unblocked, which is
+ * done using the task's direct to task notification at index
+ * configKERNEL_NOTIFICATION_INDEX.  The consumer task must therefore not use
+ * that notification index for any other purpose.
+ *
+ * The producer and consumer order their accesses to the queue using
+ * portMEMORY_BARRIER(), so the port must define portMEMORY_BARRIER() - at
+ * least as a compiler barrier - for SPSC queues to be used.
+ *
+ * Unlike a normal queue, an SPSC queue cannot be a member of a queue set, the
+ * producer cannot block, and only one task may ever read from the queue.
+ *
+ * The memory used by the queue is allocated using pvPortMalloc(), so
+ * configSUPPORT_DYNAMIC_ALLOCATION must also be set to 1 (or left undefined).
+ * Use xQueueCreateSPSCStatic() to provide the memory at compile time instead.
+ *
+ * @param uxQueueLength The maximum number of items the queue can hold at any
+ * one time.
+ *
+ * @param uxItemSize The size, in bytes, of each item.  Must be greater than
+ * zero.
+ *
+ * @return If the queue is successfully created then a handle to the queue is
+ * returned.  If the queue cannot be created then NULL is returned.
+ *
+ * \defgroup xQueueCreateSPSC xQueueCreateSPSC
+ * \ingroup QueueManagement
+ */
+SPSCQueueHandle_t xQueueCreateSPSC( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ SPSCQueueHandle_t xQueueCreateSPSCStatic(
+							  UBaseType_t uxQueueLength,
+							  UBaseType_t uxItemSize,
+							  uint8_t *pucQueueStorage,
+							  StaticSPSCQueue_t *pxQueueBuffer
+						  );
+ * </pre>
+ *
+ * As xQueueCreateSPSC(), except the memory used by the queue is provided by the
+ * application writer.  configSUPPORT_STATIC_ALLOCATION must be set to 1 in
+ * FreeRTOSConfig.h for this function to be available.
+ *
+ * @param uxQueueLength The maximum number of items the queue can hold at any
+ * one time.
+ *
+ * @param uxItemSize The size, in bytes, of each item.  Must be greater than
+ * zero.
+ *
+ * @param pucQueueStorage Must point to a uint8_t array that is at least
+ * ( uxQueueLength * uxItemSize ) bytes long.
+ *
+ * @param pxQueueBuffer Must point to a variable of type StaticSPSCQueue_t,
+ * which will be used to hold the queue's data structure.
+ *
+ * @return A handle to the created queue, or NULL if pxQueueBuffer is NULL.
+ *
+ * \defgroup xQueueCreateSPSCStatic xQueueCreateSPSCStatic
+ * \ingroup QueueManagement
+ */
+SPSCQueueHandle_t xQueueCreateSPSCStatic( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, StaticSPSCQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueSPSCSend(
+							  SPSCQueueHandle_t xQueue,
+							  const void *pvItemToQueue
+						  );
+ * </pre>
+ *
+ * Copies an item to the back of an SPSC queue.  Must only be called by the one
+ * task that produces data for the queue.  The producer never blocks, so if the
+ * queue is full the item is not written and pdFAIL is returned immediately.
+ *
+ * @param xQueue The handle of the queue to which the item is to be posted.
+ *
+ * @param pvItemToQueue A pointer to the item that is to be placed on the
+ * queue.
+ *
+ * @return pdPASS if the item was successfully posted, otherwise pdFAIL.
+ *
+ * \defgroup xQueueSPSCSend xQueueSPSCSend
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueSPSCSend( SPSCQueueHandle_t xQueue, const void * const pvItemToQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueSPSCSendFromISR(
+									 SPSCQueueHandle_t xQueue,
+									 const void *pvItemToQueue,
+									 BaseType_t *pxHigherPriorityTaskWoken
+								  );
+ * </pre>
+ *
+ * A version of xQueueSPSCSend() that can be called from an interrupt service
+ * routine.  Must only be called by the one interrupt that produces data for the
+ * queue.
+ *
+ * @param xQueue The handle of the queue to which the item is to be posted.
+ *
+ * @param pvItemToQueue A pointer to the item that is to be placed on the
+ * queue.
+ *
+ * @param pxHigherPriorityTaskWoken xQueueSPSCSendFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if sending to the queue caused the
+ * consumer task to unblock, and the consumer task has a priority higher than
+ * the currently running task.  If xQueueSPSCSendFromISR() sets this value to
+ * pdTRUE then a context switch should be requested before the interrupt is
+ * exited.
+ *
+ * @return pdPASS if the item was successfully posted, otherwise pdFAIL.
+ *
+ * \defgroup xQueueSPSCSendFromISR xQueueSPSCSendFromISR
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueSPSCSendFromISR( SPSCQueueHandle_t xQueue, const void * const pvItemToQueue, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueSPSCReceive(
+								 SPSCQueueHandle_t xQueue,
+								 void *pvBuffer,
+								 TickType_t xTicksToWait
+							 );
+ * </pre>
+ *
+ * Receives an item from the front of an SPSC queue, optionally blocking until
+ * an item is available.  Must only be called by the one task that consumes data
+ * from the queue.
+ *
+ * @param xQueue The handle to the queue from which the item is to be received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received item will be
+ * copied.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for an item to receive should the queue be empty at the time of the call.
+ *
+ * @return pdPASS if an item was successfully received from the queue, otherwise
+ * pdFAIL.
+ *
+ * \defgroup xQueueSPSCReceive xQueueSPSCReceive
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueSPSCReceive( SPSCQueueHandle_t xQueue, void * const pvBuffer, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>UBaseType_t uxQueueSPSCMessagesWaiting( const SPSCQueueHandle_t xQueue );</pre>
+ *
+ * Return the number of items stored in an SPSC queue.  The value is only a
+ * snapshot, as the producer and consumer can run at any time.  Can be called
+ * from a task or an interrupt.
+ *
+ * @param xQueue A handle to the queue being queried.
+ *
+ * @return The number of items available in the queue.
+ *
+ * \defgroup uxQueueSPSCMessagesWaiting uxQueueSPSCMessagesWaiting
+ * \ingroup QueueManagement
+ */
+UBaseType_t uxQueueSPSCMessagesWaiting( const SPSCQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>void vQueueSPSCDelete( SPSCQueueHandle_t xQueue );</pre>
+ *
+ * Delete an SPSC queue, freeing the memory if it was allocated dynamically.
+ * Neither the producer nor the consumer may be using the queue when it is
+ * deleted.
+ *
+ * @param xQueue A handle to the queue to be deleted.
+ *
+ * \defgroup vQueueSPSCDelete vQueueSPSCDelete
+ * \ingroup QueueManagement
+ */
+void vQueueSPSCDelete( SPSCQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * The size, in bytes, of each buffer in a zero copy queue's pool.  Each buffer
+ * is large enough to hold a pointer and is a multiple of portBYTE_ALIGNMENT
+ * bytes.  A pool provided to xQueueCreateZeroCopyStatic() must be
+ * ( uxQueueLength * queueZERO_COPY_BUFFER_SIZE( uxItemSize ) ) bytes long.
+ */
+#define queueZERO_COPY_BUFFER_SIZE( uxItemSize ) ( ( ( ( ( size_t ) ( uxItemSize ) > sizeof( void * ) ) ? ( size_t ) ( uxItemSize ) : sizeof( void * ) ) + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/**
+ * queue. h
+ * <pre>
+ ZeroCopyQueueHandle_t xQueueCreateZeroCopy(
+							  UBaseType_t uxQueueLength,
+							  UBaseType_t uxItemSize
+						  );
+ * </pre>
+ *
+ * Creates a zero copy queue and returns a handle by which the queue can be
+ * referenced.  configUSE_ZERO_COPY_QUEUES must be set to 1 in FreeRTOSConfig.h
+ * for this function to be available.
+ *
+ * A normal queue copies each item into the queue when it is sent and out of the
+ * queue when it is received.  A zero copy queue instead owns a pool of
+ * uxQueueLength buffers.  A sender obtains a free buffer by calling
+ * pvQueueZeroCopyAcquire(), writes the item directly into the buffer, then
+ * passes the buffer to the receiver by calling xQueueZeroCopyCommit().  The
+ * receiver obtains the buffer by calling pvQueueZeroCopyReceive(), uses the
+ * item in place, then returns the buffer to the pool by calling
+ * vQueueZeroCopyRelease().  Buffers are received in the order in which they
+ * were committed.
+ *
+ * A task can block in pvQueueZeroCopyAcquire() waiting for a buffer to be
+ * released, and in pvQueueZeroCopyReceive() waiting for a buffer to be
+ * committed, in the same way as a task can block waiting for space in, or data
+ * from, a normal queue.
+ *
+ * @param uxQueueLength The number of buffers in the pool, which is also the
+ * maximum number of items the queue can hold at any one time.
+ *
+ * @param uxItemSize The size, in bytes, of each item.
+ *
+ * @return If the queue is successfully created then a handle to the queue is
+ * returned.  If the queue cannot be created then NULL is returned.
+ *
+ * Example usage:
+   <pre>
+ struct AMessage
+ {
+	char ucMessageID;
+	char ucData[ 200 ];
+ };
+
+ ZeroCopyQueueHandle_t xQueue;
+
+ void vSenderTask( void *pvParameters )
+ {
+ struct AMessage *pxMessage;
+
+	// Create a queue of 4 messages.
+	xQueue = xQueueCreateZeroCopy( 4, sizeof( struct AMessage ) );
+
+	for( ;; )
+	{
+		// Obtain a buffer, waiting if all four are in use.
+		pxMessage = pvQueueZeroCopyAcquire( xQueue, portMAX_DELAY );
+
+		// Build the message in place, then pass it on.
+		pxMessage->ucMessageID = 1;
+		xQueueZeroCopyCommit( xQueue, pxMessage );
+	}
+ }
+
+ void vReceiverTask( void *pvParameters )
+ {
+ struct AMessage *pxMessage;
+
+	for( ;; )
+	{
+		pxMessage = pvQueueZeroCopyReceive( xQueue, portMAX_DELAY );
+
+		if( pxMessage != NULL )
+		{
+			// Use the message in place, then return the buffer.
+			vProcessMessage( pxMessage );
+			vQueueZeroCopyRelease( xQueue, pxMessage );
+		}
+	}
+ }
+ </pre>
+ * \defgroup xQueueCreateZeroCopy xQueueCreateZeroCopy
+ * \ingroup QueueManagement
+ */
+ZeroCopyQueueHandle_t xQueueCreateZeroCopy( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ ZeroCopyQueueHandle_t xQueueCreateZeroCopyStatic(
+							  UBaseType_t uxQueueLength,
+							  UBaseType_t uxItemSize,
+							  uint8_t *pucQueueStorage,
+							  uint8_t *pucPoolStorage,
+							  StaticZeroCopyQueue_t *pxQueueBuffer
+						  );
+ * </pre>
+ *
+ * As xQueueCreateZeroCopy(), except the memory used by the queue is provided by
+ * the application writer.  configSUPPORT_STATIC_ALLOCATION must be set to 1 in
+ * FreeRTOSConfig.h for this function to be available.
+ *
+ * @param uxQueueLength The number of buffers in the pool.
+ *
+ * @param uxItemSize The size, in bytes, of each item.
+ *
+ * @param pucQueueStorage Must point to a uint8_t array that is at least
+ * ( uxQueueLength * sizeof( void * ) ) bytes long, used to hold pointers to the
+ * committed buffers.
+ *
+ * @param pucPoolStorage Must point to a uint8_t array that is at least
+ * ( uxQueueLength * queueZERO_COPY_BUFFER_SIZE( uxItemSize ) ) bytes long and
+ * aligned to portBYTE_ALIGNMENT.  The buffers are allocated from this array.
+ *
+ * @param pxQueueBuffer Must point to a variable of type StaticZeroCopyQueue_t,
+ * which will be used to hold the queue's data structure.
+ *
+ * @return A handle to the created queue, or NULL if pxQueueBuffer is NULL.
+ *
+ * \defgroup xQueueCreateZeroCopyStatic xQueueCreateZeroCopyStatic
+ * \ingroup QueueManagement
+ */
+ZeroCopyQueueHandle_t xQueueCreateZeroCopyStatic( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, uint8_t *pucPoolStorage, StaticZeroCopyQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>void *pvQueueZeroCopyAcquire( ZeroCopyQueueHandle_t xQueue, TickType_t xTicksToWait );</pre>
+ *
+ * Obtain a free buffer from a zero copy queue's pool.  The buffer belongs to
+ * the calling task until it is passed to xQueueZeroCopyCommit().
+ *
+ * @param xQueue The queue from which the buffer is to be obtained.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for a buffer to be released should every buffer be in use at the time of the
+ * call.
+ *
+ * @return A pointer to a buffer of at least uxItemSize bytes, or NULL if no
+ * buffer became free before the block time expired.
+ *
+ * \defgroup pvQueueZeroCopyAcquire pvQueueZeroCopyAcquire
+ * \ingroup QueueManagement
+ */
+void *pvQueueZeroCopyAcquire( ZeroCopyQueueHandle_t xQueue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>void *pvQueueZeroCopyAcquireFromISR( ZeroCopyQueueHandle_t xQueue );</pre>
+ *
+ * A version of pvQueueZeroCopyAcquire() that can be called from an interrupt
+ * service routine.  Returns NULL immediately if every buffer is in use.
+ *
+ * \defgroup pvQueueZeroCopyAcquireFromISR pvQueueZeroCopyAcquireFromISR
+ * \ingroup QueueManagement
+ */
+void *pvQueueZeroCopyAcquireFromISR( ZeroCopyQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>BaseType_t xQueueZeroCopyCommit( ZeroCopyQueueHandle_t xQueue, void *pvBuffer );</pre>
+ *
+ * Post a buffer previously obtained from pvQueueZeroCopyAcquire() to the back
+ * of the queue.  The caller must not access the buffer after it has been
+ * committed.  Committing never blocks, as there is always room in the queue for
+ * every buffer in the pool.
+ *
+ * @param xQueue The queue to which the buffer is to be posted.
+ *
+ * @param pvBuffer The buffer being posted.
+ *
+ * @return pdPASS.
+ *
+ * \defgroup xQueueZeroCopyCommit xQueueZeroCopyCommit
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueZeroCopyCommit( ZeroCopyQueueHandle_t xQueue, void *pvBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>BaseType_t xQueueZeroCopyCommitFromISR( ZeroCopyQueueHandle_t xQueue, void *pvBuffer, BaseType_t *pxHigherPriorityTaskWoken );</pre>
+ *
+ * A version of xQueueZeroCopyCommit() that can be called from an interrupt
+ * service routine.  *pxHigherPriorityTaskWoken is set to pdTRUE if committing
+ * the buffer unblocked a task that has a priority higher than the currently
+ * running task.
+ *
+ * \defgroup xQueueZeroCopyCommitFromISR xQueueZeroCopyCommitFromISR
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueZeroCopyCommitFromISR( ZeroCopyQueueHandle_t xQueue, void *pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>void *pvQueueZeroCopyReceive( ZeroCopyQueueHandle_t xQueue, TickType_t xTicksToWait );</pre>
+ *
+ * Receive the buffer at the front of a zero copy queue.  The buffer belongs to
+ * the calling task until it is passed to vQueueZeroCopyRelease().
+ *
+ * @param xQueue The queue from which the buffer is to be received.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for a buffer to be committed should the queue be empty at the time of the
+ * call.
+ *
+ * @return A pointer to the received buffer, or NULL if the queue remained empty
+ * until the block time expired.
+ *
+ * \defgroup pvQueueZeroCopyReceive pvQueueZeroCopyReceive
+ * \ingroup QueueManagement
+ */
+void *pvQueueZeroCopyReceive( ZeroCopyQueueHandle_t xQueue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>void *pvQueueZeroCopyReceiveFromISR( ZeroCopyQueueHandle_t xQueue, BaseType_t *pxHigherPriorityTaskWoken );</pre>
+ *
+ * A version of pvQueueZeroCopyReceive() that can be called from an interrupt
+ * service routine.  Returns NULL immediately if the queue is empty.
+ *
+ * \defgroup pvQueueZeroCopyReceiveFromISR pvQueueZeroCopyReceiveFromISR
+ * \ingroup QueueManagement
+ */
+void *pvQueueZeroCopyReceiveFromISR( ZeroCopyQueueHandle_t xQueue, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>void vQueueZeroCopyRelease( ZeroCopyQueueHandle_t xQueue, void *pvBuffer );</pre>
+ *
+ * Return a buffer obtained from pvQueueZeroCopyReceive() to the queue's pool,
+ * unblocking the highest priority task waiting in pvQueueZeroCopyAcquire(), if
+ * any.  A buffer obtained from pvQueueZeroCopyAcquire() can also be released
+ * without being committed.
+ *
+ * @param xQueue The queue that owns the buffer.
+ *
+ * @param pvBuffer The buffer being released.
+ *
+ * \defgroup vQueueZeroCopyRelease vQueueZeroCopyRelease
+ * \ingroup QueueManagement
+ */
+void vQueueZeroCopyRelease( ZeroCopyQueueHandle_t xQueue, void *pvBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>void vQueueZeroCopyReleaseFromISR( ZeroCopyQueueHandle_t xQueue, void *pvBuffer, BaseType_t *pxHigherPriorityTaskWoken );</pre>
+ *
+ * A version of vQueueZeroCopyRelease() that can be called from an interrupt
+ * service routine.
+ *
+ * \defgroup vQueueZeroCopyReleaseFromISR vQueueZeroCopyReleaseFromISR
+ * \ingroup QueueManagement
+ */
+void vQueueZeroCopyReleaseFromISR( ZeroCopyQueueHandle_t xQueue, void *pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>void vQueueZeroCopyDelete( ZeroCopyQueueHandle_t xQueue );</pre>
+ *
+ * Delete a zero copy queue, freeing the queue and its buffer pool if they were
+ * allocated dynamically.
+ *
+ * \defgroup vQueueZeroCopyDelete vQueueZeroCopyDelete
+ * \ingroup QueueManagement
+ */
+void vQueueZeroCopyDelete( ZeroCopyQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
 /*
  * The functions defined above are for passing data to and from tasks.  The
  * functions below are the equivalents for passing data to and from
@@ -1413,12 +2129,36 @@ BaseType_t xQueueCRReceive( QueueHandle_t xQueue, void *pvBuffer, TickType_t xTi
  */
 QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
 QueueHandle_t xQueueCreateMutexStatic( const uint8_t ucQueueType, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
+QueueHandle_t xQueueCreateCeilingMutex( const UBaseType_t uxCeilingPriority ) PRIVILEGED_FUNCTION;
+QueueHandle_t xQueueCreateCeilingMutexStatic( const UBaseType_t uxCeilingPriority, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
 QueueHandle_t xQueueCreateCountingSemaphore( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount ) PRIVILEGED_FUNCTION;
 QueueHandle_t xQueueCreateCountingSemaphoreStatic( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
 BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 TaskHandle_t xQueueGetMutexHolder( QueueHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
 TaskHandle_t xQueueGetMutexHolderFromISR( QueueHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Use xSemaphoreCreateFastMutex(),
+ * xSemaphoreCreateFastCounting(), xSemaphoreFastTake(), xSemaphoreFastGive()
+ * and xSemaphoreFastGiveFromISR() instead of calling these functions directly.
+ */
+FastSemaphoreHandle_t xQueueCreateFastSemaphore( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, const uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
+FastSemaphoreHandle_t xQueueCreateFastSemaphoreStatic( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, const uint8_t ucQueueType, StaticFastSemaphore_t *pxStaticFastSemaphore ) PRIVILEGED_FUNCTION;
+BaseType_t xQueueFastSemaphoreTake( FastSemaphoreHandle_t xFastSemaphore, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xQueueFastSemaphoreGive( FastSemaphoreHandle_t xFastSemaphore ) PRIVILEGED_FUNCTION;
+BaseType_t xQueueFastSemaphoreGiveFromISR( FastSemaphoreHandle_t xFastSemaphore, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Use xSemaphoreCreateRWLock(), xSemaphoreTakeRead(),
+ * xSemaphoreTakeWrite(), xSemaphoreGiveRWLock() and vSemaphoreDeleteRWLock()
+ * instead of calling these functions directly.
+ */
+RWLockHandle_t xQueueCreateRWLock( const UBaseType_t uxMaxReaders ) PRIVILEGED_FUNCTION;
+RWLockHandle_t xQueueCreateRWLockStatic( const UBaseType_t uxMaxReaders, TaskHandle_t *pxReaderBuffer, StaticRWLock_t *pxStaticRWLock ) PRIVILEGED_FUNCTION;
+BaseType_t xQueueTakeRWLock( RWLockHandle_t xRWLock, const BaseType_t xExclusive, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xQueueGiveRWLock( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+void vQueueDeleteRWLock( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
 /*
  * For internal use only.  Use xSemaphoreTakeMutexRecursive() or
  * xSemaphoreGiveMutexRecursive() instead of calling these functions directly.
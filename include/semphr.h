@@ -777,6 +777,80 @@ typedef QueueHandle_t SemaphoreHandle_t;
 	#define xSemaphoreCreateMutexStatic( pxMutexBuffer ) xQueueCreateMutexStatic( queueQUEUE_TYPE_MUTEX, ( pxMutexBuffer ) )
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+/**
+ * semphr. h
+ * <pre>SemaphoreHandle_t xSemaphoreCreateCeilingMutex( UBaseType_t uxCeilingPriority )</pre>
+ *
+ * Creates a mutex that uses the immediate priority ceiling protocol instead of
+ * priority inheritance, and returns a handle by which the mutex can be
+ * referenced.  configUSE_CEILING_MUTEXES must be set to 1 in FreeRTOSConfig.h
+ * for this macro to be available.
+ *
+ * A task that takes the mutex is raised to uxCeilingPriority straight away,
+ * and keeps that priority until it gives the mutex back (or, as with priority
+ * inheritance, until it gives back the last mutex it holds).  As no other task
+ * that uses the mutex can preempt the holder, a task only ever blocks on the
+ * mutex if the holder blocks while holding it, and taking the mutex never
+ * requires the priority of another task to be changed.  uxCeilingPriority must
+ * therefore be at least the priority of the highest priority task that uses the
+ * mutex.
+ *
+ * Mutexes created using this function can be accessed using the
+ * xSemaphoreTake() and xSemaphoreGive() macros.  The xSemaphoreTakeRecursive()
+ * and xSemaphoreGiveRecursive() macros must not be used.
+ *
+ * Mutex type semaphores cannot be used from within interrupt service routines.
+ *
+ * @param uxCeilingPriority The priority of the highest priority task that uses
+ * the mutex.  Must be above tskIDLE_PRIORITY and below configMAX_PRIORITIES.
+ *
+ * @return If the mutex was successfully created then a handle to the created
+ * mutex is returned.  If there was not enough heap to allocate the mutex data
+ * structures then NULL is returned.
+ *
+ * Example usage:
+ <pre>
+ SemaphoreHandle_t xSemaphore;
+
+ void vATask( void * pvParameters )
+ {
+    // The mutex is used by tasks of priority 3 or lower.
+    xSemaphore = xSemaphoreCreateCeilingMutex( 3 );
+
+    if( xSemaphore != NULL )
+    {
+        if( xSemaphoreTake( xSemaphore, portMAX_DELAY ) == pdTRUE )
+        {
+            // Access the shared resource at priority 3.
+
+            xSemaphoreGive( xSemaphore );
+        }
+    }
+ }
+ </pre>
+ * \defgroup xSemaphoreCreateCeilingMutex xSemaphoreCreateCeilingMutex
+ * \ingroup Semaphores
+ */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_CEILING_MUTEXES == 1 ) )
+	#define xSemaphoreCreateCeilingMutex( uxCeilingPriority ) xQueueCreateCeilingMutex( ( uxCeilingPriority ) )
+#endif
+
+/**
+ * semphr. h
+ * <pre>SemaphoreHandle_t xSemaphoreCreateCeilingMutexStatic( UBaseType_t uxCeilingPriority, StaticSemaphore_t *pxMutexBuffer )</pre>
+ *
+ * As xSemaphoreCreateCeilingMutex(), but the memory used by the mutex is
+ * provided by the application writer.  pxMutexBuffer must point to a variable
+ * of type StaticSemaphore_t, which will be used to hold the mutex's data
+ * structure.
+ *
+ * \defgroup xSemaphoreCreateCeilingMutexStatic xSemaphoreCreateCeilingMutexStatic
+ * \ingroup Semaphores
+ */
+#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_CEILING_MUTEXES == 1 ) )
+	#define xSemaphoreCreateCeilingMutexStatic( uxCeilingPriority, pxMutexBuffer ) xQueueCreateCeilingMutexStatic( ( uxCeilingPriority ), ( pxMutexBuffer ) )
+#endif
+
 
 /**
  * semphr. h
@@ -1097,6 +1171,19 @@ typedef QueueHandle_t SemaphoreHandle_t;
  */
 #define vSemaphoreDelete( xSemaphore ) vQueueDelete( ( QueueHandle_t ) ( xSemaphore ) )
 
+/**
+ * semphr. h
+ * <pre>void vSemaphoreSetWaitPolicy( SemaphoreHandle_t xSemaphore, uint8_t ucWaitPolicy );</pre>
+ *
+ * Sets the order in which tasks blocked on a binary or counting semaphore are
+ * woken - queueWAIT_POLICY_PRIORITY (the default) or queueWAIT_POLICY_FIFO.
+ * See vQueueSetWaitPolicy().  Mutexes must use queueWAIT_POLICY_PRIORITY.
+ *
+ * \defgroup vSemaphoreSetWaitPolicy vSemaphoreSetWaitPolicy
+ * \ingroup Semaphores
+ */
+#define vSemaphoreSetWaitPolicy( xSemaphore, ucWaitPolicy ) vQueueSetWaitPolicy( ( QueueHandle_t ) ( xSemaphore ), ( ucWaitPolicy ) )
+
 /**
  * semphr.h
  * <pre>TaskHandle_t xSemaphoreGetMutexHolder( SemaphoreHandle_t xMutex );</pre>
@@ -1135,6 +1222,357 @@ typedef QueueHandle_t SemaphoreHandle_t;
  */
 #define uxSemaphoreGetCount( xSemaphore ) uxQueueMessagesWaiting( ( QueueHandle_t ) ( xSemaphore ) )
 
+/**
+ * semphr. h
+ * <pre>FastSemaphoreHandle_t xSemaphoreCreateFastMutex( void )</pre>
+ *
+ * Creates a fast mutex, and returns a handle by which the fast mutex can be
+ * referenced.  configUSE_FAST_SEMAPHORES and configUSE_MUTEXES must both be set
+ * to 1 in FreeRTOSConfig.h for this macro to be available.
+ *
+ * A fast mutex behaves like a mutex created using xSemaphoreCreateMutex(),
+ * including priority inheritance, but is taken and given using
+ * xSemaphoreFastTake() and xSemaphoreFastGive().  While no task is blocked on
+ * the mutex those functions complete with a single atomic compare and swap
+ * (see atomic.h) and do not touch the scheduler or the mutex's event lists.
+ * The compare and swap is itself a very short critical section
+ * (ATOMIC_ENTER_CRITICAL()), so interrupts are still masked briefly.  Only
+ * when a task has to wait for the mutex does it fall back to the kernel's
+ * blocking path, in which case the task holding the mutex inherits the
+ * waiting task's priority in the normal way.
+ *
+ * Fast mutexes are not recursive, cannot be used from interrupts, and cannot
+ * be added to queue sets.  A fast mutex taken without contention is not
+ * counted in the holder's count of held mutexes until another task blocks on
+ * it.
+ *
+ * @return If the fast mutex was successfully created then a handle to the
+ * created fast mutex is returned.  If there was not enough heap to allocate
+ * the fast mutex data structures then NULL is returned.
+ *
+ * Example usage:
+ <pre>
+ FastSemaphoreHandle_t xFastMutex;
+
+ void vATask( void * pvParameters )
+ {
+    // Create a fast mutex.
+    xFastMutex = xSemaphoreCreateFastMutex();
+
+    if( xFastMutex != NULL )
+    {
+        if( xSemaphoreFastTake( xFastMutex, portMAX_DELAY ) == pdTRUE )
+        {
+            // Access the shared resource.
+
+            xSemaphoreFastGive( xFastMutex );
+        }
+    }
+ }
+ </pre>
+ * \defgroup xSemaphoreCreateFastMutex xSemaphoreCreateFastMutex
+ * \ingroup Semaphores
+ */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_FAST_SEMAPHORES == 1 ) && ( configUSE_MUTEXES == 1 ) )
+	#define xSemaphoreCreateFastMutex() xQueueCreateFastSemaphore( ( UBaseType_t ) 1, ( UBaseType_t ) 1, queueQUEUE_TYPE_MUTEX )
+#endif
+
+/**
+ * semphr. h
+ * <pre>FastSemaphoreHandle_t xSemaphoreCreateFastMutexStatic( StaticFastSemaphore_t *pxFastMutexBuffer )</pre>
+ *
+ * As xSemaphoreCreateFastMutex(), but the memory used by the fast mutex is
+ * provided by the application writer.  pxFastMutexBuffer must point to a
+ * variable of type StaticFastSemaphore_t, which will be used to hold the fast
+ * mutex's data structure.
+ *
+ * \defgroup xSemaphoreCreateFastMutexStatic xSemaphoreCreateFastMutexStatic
+ * \ingroup Semaphores
+ */
+#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_FAST_SEMAPHORES == 1 ) && ( configUSE_MUTEXES == 1 ) )
+	#define xSemaphoreCreateFastMutexStatic( pxFastMutexBuffer ) xQueueCreateFastSemaphoreStatic( ( UBaseType_t ) 1, ( UBaseType_t ) 1, queueQUEUE_TYPE_MUTEX, ( pxFastMutexBuffer ) )
+#endif
+
+/**
+ * semphr. h
+ * <pre>FastSemaphoreHandle_t xSemaphoreCreateFastCounting( UBaseType_t uxMaxCount, UBaseType_t uxInitialCount )</pre>
+ *
+ * Creates a fast counting semaphore, and returns a handle by which the
+ * semaphore can be referenced.  configUSE_FAST_SEMAPHORES must be set to 1 in
+ * FreeRTOSConfig.h for this macro to be available.
+ *
+ * A fast counting semaphore behaves like a semaphore created using
+ * xSemaphoreCreateCounting(), but is taken and given using
+ * xSemaphoreFastTake(), xSemaphoreFastGive() and xSemaphoreFastGiveFromISR().
+ * While no task is blocked on the semaphore those functions complete with a
+ * single atomic compare and swap and do not touch the scheduler or the
+ * semaphore's event lists.  The compare and swap is itself a very short
+ * critical section (ATOMIC_ENTER_CRITICAL()), so interrupts are still masked
+ * briefly.
+ *
+ * @param uxMaxCount The maximum count value that can be reached.  Must be
+ * less than 0x80000000.
+ *
+ * @param uxInitialCount The count value assigned to the semaphore when it is
+ * created.
+ *
+ * @return If the semaphore was successfully created then a handle to the
+ * semaphore is returned.  If there was not enough heap to allocate the
+ * semaphore then NULL is returned.
+ *
+ * \defgroup xSemaphoreCreateFastCounting xSemaphoreCreateFastCounting
+ * \ingroup Semaphores
+ */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_FAST_SEMAPHORES == 1 ) )
+	#define xSemaphoreCreateFastCounting( uxMaxCount, uxInitialCount ) xQueueCreateFastSemaphore( ( uxMaxCount ), ( uxInitialCount ), queueQUEUE_TYPE_COUNTING_SEMAPHORE )
+#endif
+
+/**
+ * semphr. h
+ * <pre>FastSemaphoreHandle_t xSemaphoreCreateFastCountingStatic( UBaseType_t uxMaxCount, UBaseType_t uxInitialCount, StaticFastSemaphore_t *pxSemaphoreBuffer )</pre>
+ *
+ * As xSemaphoreCreateFastCounting(), but the memory used by the semaphore is
+ * provided by the application writer.  pxSemaphoreBuffer must point to a
+ * variable of type StaticFastSemaphore_t, which will be used to hold the
+ * semaphore's data structure.
+ *
+ * \defgroup xSemaphoreCreateFastCountingStatic xSemaphoreCreateFastCountingStatic
+ * \ingroup Semaphores
+ */
+#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_FAST_SEMAPHORES == 1 ) )
+	#define xSemaphoreCreateFastCountingStatic( uxMaxCount, uxInitialCount, pxSemaphoreBuffer ) xQueueCreateFastSemaphoreStatic( ( uxMaxCount ), ( uxInitialCount ), queueQUEUE_TYPE_COUNTING_SEMAPHORE, ( pxSemaphoreBuffer ) )
+#endif
+
+/**
+ * semphr. h
+ * <pre>BaseType_t xSemaphoreFastTake( FastSemaphoreHandle_t xFastSemaphore, TickType_t xTicksToWait )</pre>
+ *
+ * Take a fast mutex or fast counting semaphore.  The semantics, including the
+ * block time, are those of xSemaphoreTake().
+ *
+ * @param xFastSemaphore A handle to the fast semaphore being taken.
+ *
+ * @param xTicksToWait The time in ticks to wait for the semaphore to become
+ * available.  A block time of zero can be used to poll the semaphore.
+ *
+ * @return pdTRUE if the semaphore was obtained.  pdFALSE if xTicksToWait
+ * expired without the semaphore becoming available.
+ *
+ * \defgroup xSemaphoreFastTake xSemaphoreFastTake
+ * \ingroup Semaphores
+ */
+#define xSemaphoreFastTake( xFastSemaphore, xTicksToWait ) xQueueFastSemaphoreTake( ( xFastSemaphore ), ( xTicksToWait ) )
+
+/**
+ * semphr. h
+ * <pre>BaseType_t xSemaphoreFastGive( FastSemaphoreHandle_t xFastSemaphore )</pre>
+ *
+ * Give a fast mutex or fast counting semaphore.  A fast mutex can only be
+ * given by the task that holds it.
+ *
+ * @param xFastSemaphore A handle to the fast semaphore being given.
+ *
+ * @return pdTRUE if the semaphore was given.  pdFALSE if the calling task did
+ * not hold the mutex, or the counting semaphore was already at its maximum
+ * count.
+ *
+ * \defgroup xSemaphoreFastGive xSemaphoreFastGive
+ * \ingroup Semaphores
+ */
+#define xSemaphoreFastGive( xFastSemaphore ) xQueueFastSemaphoreGive( ( xFastSemaphore ) )
+
+/**
+ * semphr. h
+ * <pre>BaseType_t xSemaphoreFastGiveFromISR( FastSemaphoreHandle_t xFastSemaphore, BaseType_t *pxHigherPriorityTaskWoken )</pre>
+ *
+ * Give a fast counting semaphore from an interrupt.  Fast mutexes cannot be
+ * given from an interrupt.  If no task is waiting the count is incremented
+ * with a single atomic compare and swap, which masks interrupts only for the
+ * duration of the compare and swap, and the semaphore's event lists are not
+ * accessed.
+ *
+ * @param xFastSemaphore A handle to the fast counting semaphore being given.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if giving the semaphore
+ * unblocked a task with a priority higher than the currently running task, in
+ * which case a context switch should be requested before the interrupt is
+ * exited.
+ *
+ * @return pdTRUE if the semaphore was given, otherwise pdFALSE.
+ *
+ * \defgroup xSemaphoreFastGiveFromISR xSemaphoreFastGiveFromISR
+ * \ingroup Semaphores
+ */
+#define xSemaphoreFastGiveFromISR( xFastSemaphore, pxHigherPriorityTaskWoken ) xQueueFastSemaphoreGiveFromISR( ( xFastSemaphore ), ( pxHigherPriorityTaskWoken ) )
+
+/**
+ * semphr. h
+ * <pre>void vSemaphoreFastDelete( FastSemaphoreHandle_t xFastSemaphore );</pre>
+ *
+ * Delete a fast semaphore.  Do not delete a fast mutex that is held, or a fast
+ * semaphore that tasks are blocked on.
+ *
+ * @param xFastSemaphore A handle to the fast semaphore to be deleted.
+ *
+ * \defgroup vSemaphoreFastDelete vSemaphoreFastDelete
+ * \ingroup Semaphores
+ */
+#define vSemaphoreFastDelete( xFastSemaphore ) vQueueDelete( ( QueueHandle_t ) ( xFastSemaphore ) )
+
+/**
+ * semphr. h
+ * <pre>RWLockHandle_t xSemaphoreCreateRWLock( UBaseType_t uxMaxReaders )</pre>
+ *
+ * Creates a reader writer lock, and returns a handle by which the lock can be
+ * referenced.  configUSE_RW_LOCKS and configUSE_MUTEXES must both be set to 1
+ * in FreeRTOSConfig.h for this macro to be available.
+ *
+ * A reader writer lock can be held by any number of readers, up to
+ * uxMaxReaders, or by a single writer.  A writer waiting for the lock is
+ * preferred over readers, so once a writer is waiting no further reader is
+ * admitted until the writer has had the lock.  Tasks holding the lock inherit
+ * the priority of higher priority tasks that block on it, in the same way as
+ * mutex holders do.
+ *
+ * Reader writer locks are not recursive, and cannot be used from interrupts.
+ * A task holding the lock for reading must not attempt to take it for
+ * writing.
+ *
+ * @param uxMaxReaders The maximum number of tasks that can hold the lock for
+ * reading at any one time.  Each reader occupies one entry in a table of
+ * readers that is allocated with the lock.
+ *
+ * @return If the lock was successfully created then a handle to the created
+ * lock is returned.  If there was not enough heap to allocate the lock then
+ * NULL is returned.
+ *
+ * Example usage:
+ <pre>
+ RWLockHandle_t xRWLock;
+
+ void vAReadingTask( void * pvParameters )
+ {
+    // Create a lock that up to four tasks can read at once.
+    xRWLock = xSemaphoreCreateRWLock( 4 );
+
+    if( xRWLock != NULL )
+    {
+        if( xSemaphoreTakeRead( xRWLock, portMAX_DELAY ) == pdTRUE )
+        {
+            // Read the shared data.
+
+            xSemaphoreGiveRWLock( xRWLock );
+        }
+    }
+ }
+
+ void vAWritingTask( void * pvParameters )
+ {
+    if( xSemaphoreTakeWrite( xRWLock, portMAX_DELAY ) == pdTRUE )
+    {
+        // Update the shared data.
+
+        xSemaphoreGiveRWLock( xRWLock );
+    }
+ }
+ </pre>
+ * \defgroup xSemaphoreCreateRWLock xSemaphoreCreateRWLock
+ * \ingroup Semaphores
+ */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_RW_LOCKS == 1 ) )
+	#define xSemaphoreCreateRWLock( uxMaxReaders ) xQueueCreateRWLock( ( uxMaxReaders ) )
+#endif
+
+/**
+ * semphr. h
+ * <pre>RWLockHandle_t xSemaphoreCreateRWLockStatic( UBaseType_t uxMaxReaders, TaskHandle_t *pxReaderBuffer, StaticRWLock_t *pxRWLockBuffer )</pre>
+ *
+ * As xSemaphoreCreateRWLock(), but the memory used by the lock is provided by
+ * the application writer.  pxReaderBuffer must point to an array of at least
+ * uxMaxReaders TaskHandle_t variables, which will be used to record the
+ * readers, and pxRWLockBuffer must point to a variable of type StaticRWLock_t,
+ * which will be used to hold the lock's data structure.
+ *
+ * \defgroup xSemaphoreCreateRWLockStatic xSemaphoreCreateRWLockStatic
+ * \ingroup Semaphores
+ */
+#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_RW_LOCKS == 1 ) )
+	#define xSemaphoreCreateRWLockStatic( uxMaxReaders, pxReaderBuffer, pxRWLockBuffer ) xQueueCreateRWLockStatic( ( uxMaxReaders ), ( pxReaderBuffer ), ( pxRWLockBuffer ) )
+#endif
+
+/**
+ * semphr. h
+ * <pre>BaseType_t xSemaphoreTakeRead( RWLockHandle_t xRWLock, TickType_t xTicksToWait )</pre>
+ *
+ * Take a reader writer lock for reading.  The lock is available for reading
+ * while no task holds it for writing, no task is waiting to write, and fewer
+ * than uxMaxReaders tasks hold it for reading.
+ *
+ * @param xRWLock A handle to the lock being taken.
+ *
+ * @param xTicksToWait The time in ticks to wait for the lock to become
+ * available.  A block time of zero can be used to poll the lock.
+ *
+ * @return pdTRUE if the lock was obtained.  pdFALSE if xTicksToWait expired
+ * without the lock becoming available.
+ *
+ * \defgroup xSemaphoreTakeRead xSemaphoreTakeRead
+ * \ingroup Semaphores
+ */
+#define xSemaphoreTakeRead( xRWLock, xTicksToWait ) xQueueTakeRWLock( ( xRWLock ), pdFALSE, ( xTicksToWait ) )
+
+/**
+ * semphr. h
+ * <pre>BaseType_t xSemaphoreTakeWrite( RWLockHandle_t xRWLock, TickType_t xTicksToWait )</pre>
+ *
+ * Take a reader writer lock for writing.  The lock is available for writing
+ * while no task holds it.
+ *
+ * @param xRWLock A handle to the lock being taken.
+ *
+ * @param xTicksToWait The time in ticks to wait for the lock to become
+ * available.  A block time of zero can be used to poll the lock.
+ *
+ * @return pdTRUE if the lock was obtained.  pdFALSE if xTicksToWait expired
+ * without the lock becoming available.
+ *
+ * \defgroup xSemaphoreTakeWrite xSemaphoreTakeWrite
+ * \ingroup Semaphores
+ */
+#define xSemaphoreTakeWrite( xRWLock, xTicksToWait ) xQueueTakeRWLock( ( xRWLock ), pdTRUE, ( xTicksToWait ) )
+
+/**
+ * semphr. h
+ * <pre>BaseType_t xSemaphoreGiveRWLock( RWLockHandle_t xRWLock )</pre>
+ *
+ * Release a reader writer lock held by the calling task, whether it was taken
+ * for reading or for writing.  If that leaves the lock free it is passed to a
+ * waiting writer, or if no writer is waiting, to the waiting readers.
+ *
+ * @param xRWLock A handle to the lock being released.
+ *
+ * @return pdTRUE if the lock was released.  pdFALSE if the calling task did
+ * not hold the lock.
+ *
+ * \defgroup xSemaphoreGiveRWLock xSemaphoreGiveRWLock
+ * \ingroup Semaphores
+ */
+#define xSemaphoreGiveRWLock( xRWLock ) xQueueGiveRWLock( ( xRWLock ) )
+
+/**
+ * semphr. h
+ * <pre>void vSemaphoreDeleteRWLock( RWLockHandle_t xRWLock );</pre>
+ *
+ * Delete a reader writer lock.  Do not delete a lock that is held, or that
+ * tasks are blocked on.
+ *
+ * @param xRWLock A handle to the lock to be deleted.
+ *
+ * \defgroup vSemaphoreDeleteRWLock vSemaphoreDeleteRWLock
+ * \ingroup Semaphores
+ */
+#define vSemaphoreDeleteRWLock( xRWLock ) vQueueDeleteRWLock( ( xRWLock ) )
+
 #endif /* SEMAPHORE_H */
 
 
@@ -46,6 +46,10 @@
  * (such as xStreamBufferReceive()) inside a critical section section and set the
  * receive block time to 0.
  *
+ * The exception is a stream buffer created with
+ * xStreamBufferCreateMultiProducer(), which any number of tasks and interrupts
+ * can write to at the same time.  There must still be only one reader.
+ *
  */
 
 #ifndef STREAM_BUFFER_H
@@ -68,6 +72,34 @@ extern "C" {
 struct StreamBufferDef_t;
 typedef struct StreamBufferDef_t * StreamBufferHandle_t;
 
+/**
+ * Type by which multiplexed stream buffers are referenced.  For example, a
+ * call to xStreamBufferMuxCreate() returns a StreamBufferMuxHandle_t variable
+ * that can then be used as a parameter to xStreamBufferMuxSend(),
+ * xStreamBufferMuxReceive(), etc.
+ */
+struct StreamBufferMuxDef_t;
+typedef struct StreamBufferMuxDef_t * StreamBufferMuxHandle_t;
+
+/*
+ * Values passed as the xStreamBufferType parameter of
+ * xStreamBufferGenericCreate() and xStreamBufferGenericCreateStatic().
+ * sbTYPE_MULTI_PRODUCER can be bitwise ORed with either of the other two.
+ */
+#define sbTYPE_STREAM_BUFFER	( ( BaseType_t ) 0 )
+#define sbTYPE_MESSAGE_BUFFER	( ( BaseType_t ) 1 )
+#define sbTYPE_MULTI_PRODUCER	( ( BaseType_t ) 2 )
+
+/*
+ * Describes one of the fragments passed to xStreamBufferSendV() and
+ * xMessageBufferSendV().
+ */
+typedef struct xSTREAM_BUFFER_FRAGMENT
+{
+	const void *pvData;		/* The start of the fragment. */
+	size_t xLengthBytes;	/* The number of bytes in the fragment. */
+} StreamBufferFragment_t;
+
 
 /**
  * message_buffer.h
@@ -134,7 +166,7 @@ const size_t xStreamBufferSizeBytes = 100, xTriggerLevel = 10;
  * \defgroup xStreamBufferCreate xStreamBufferCreate
  * \ingroup StreamBufferManagement
  */
-#define xStreamBufferCreate( xBufferSizeBytes, xTriggerLevelBytes ) xStreamBufferGenericCreate( xBufferSizeBytes, xTriggerLevelBytes, pdFALSE )
+#define xStreamBufferCreate( xBufferSizeBytes, xTriggerLevelBytes ) xStreamBufferGenericCreate( xBufferSizeBytes, xTriggerLevelBytes, sbTYPE_STREAM_BUFFER )
 
 /**
  * stream_buffer.h
@@ -215,7 +247,49 @@ const size_t xTriggerLevel = 1;
  * \defgroup xStreamBufferCreateStatic xStreamBufferCreateStatic
  * \ingroup StreamBufferManagement
  */
-#define xStreamBufferCreateStatic( xBufferSizeBytes, xTriggerLevelBytes, pucStreamBufferStorageArea, pxStaticStreamBuffer ) xStreamBufferGenericCreateStatic( xBufferSizeBytes, xTriggerLevelBytes, pdFALSE, pucStreamBufferStorageArea, pxStaticStreamBuffer )
+#define xStreamBufferCreateStatic( xBufferSizeBytes, xTriggerLevelBytes, pucStreamBufferStorageArea, pxStaticStreamBuffer ) xStreamBufferGenericCreateStatic( xBufferSizeBytes, xTriggerLevelBytes, sbTYPE_STREAM_BUFFER, pucStreamBufferStorageArea, pxStaticStreamBuffer )
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+StreamBufferHandle_t xStreamBufferCreateMultiProducer( size_t xBufferSizeBytes, size_t xTriggerLevelBytes );
+StreamBufferHandle_t xStreamBufferCreateMultiProducerStatic( size_t xBufferSizeBytes,
+                                                             size_t xTriggerLevelBytes,
+                                                             uint8_t *pucStreamBufferStorageArea,
+                                                             StaticStreamBuffer_t *pxStaticStreamBuffer );
+</pre>
+ *
+ * Creates a stream buffer that more than one task or interrupt can write to
+ * at the same time.  The parameters and return value are the same as those of
+ * xStreamBufferCreate() and xStreamBufferCreateStatic().
+ *
+ * Each writer claims the space it needs, copies its data into that space with
+ * interrupts enabled, then publishes it.  Writers therefore do not have to be
+ * serialised by a mutex, and the bytes from one call to xStreamBufferSend()
+ * are never interleaved with the bytes from another.  Data becomes visible to
+ * the reader in the order its space was claimed, once all the writers that
+ * claimed space before it have also finished.  Any number of writers can be
+ * blocked waiting for space at once.  There must still be only one reader.
+ *
+ * When data is read from an interrupt only the highest priority writer that
+ * is blocked waiting for space is unblocked, so the time the interrupt runs
+ * with interrupts masked does not grow with the number of blocked writers.
+ * That writer unblocks the others, one at a time, when it next runs.
+ *
+ * xStreamBufferSendReserve() and xStreamBufferSendCommit() cannot be used with
+ * a stream buffer created by these macros.
+ *
+ * configUSE_MULTI_PRODUCER_STREAM_BUFFERS must be set to 1 in FreeRTOSConfig.h
+ * for these macros to be available.
+ *
+ * \defgroup xStreamBufferCreateMultiProducer xStreamBufferCreateMultiProducer
+ * \ingroup StreamBufferManagement
+ */
+#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+	#define xStreamBufferCreateMultiProducer( xBufferSizeBytes, xTriggerLevelBytes ) xStreamBufferGenericCreate( xBufferSizeBytes, xTriggerLevelBytes, sbTYPE_MULTI_PRODUCER )
+	#define xStreamBufferCreateMultiProducerStatic( xBufferSizeBytes, xTriggerLevelBytes, pucStreamBufferStorageArea, pxStaticStreamBuffer ) xStreamBufferGenericCreateStatic( xBufferSizeBytes, xTriggerLevelBytes, sbTYPE_MULTI_PRODUCER, pucStreamBufferStorageArea, pxStaticStreamBuffer )
+#endif
 
 /**
  * stream_buffer.h
@@ -415,6 +489,236 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
 								 size_t xDataLengthBytes,
 								 BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+                           const StreamBufferFragment_t *pxFragments,
+                           UBaseType_t uxFragmentCount,
+                           TickType_t xTicksToWait );
+</pre>
+ *
+ * Sends the bytes held in several separate buffers to a stream buffer, as if
+ * they had first been copied into one buffer and passed to xStreamBufferSend().
+ * The bytes are copied straight from each fragment into the stream buffer, so
+ * the application does not need a staging buffer to assemble them in.
+ *
+ * The fragments are written in the order they appear in the pxFragments array.
+ * The block time and the return value behave as for xStreamBufferSend() -
+ * the task waits for space for all the fragments, and if the block time
+ * expires first as many bytes as will fit are written.  Fragments with a
+ * length of zero are skipped.
+ *
+ * Use xMessageBufferSendV() to write the fragments to a message buffer as a
+ * single message.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to which the fragments
+ * are being sent.
+ *
+ * @param pxFragments An array of uxFragmentCount fragments, each of which
+ * holds a pointer to some bytes and the number of bytes to copy from there.
+ *
+ * @param uxFragmentCount The number of fragments in the pxFragments array.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for enough space to become available in the stream
+ * buffer.
+ *
+ * @return The total number of bytes written to the stream buffer.
+ *
+ * Example use:
+<pre>
+void vSendFrame( StreamBufferHandle_t xStreamBuffer, const uint8_t *pucPayload, size_t xPayloadLength )
+{
+FrameHeader_t xHeader;
+uint16_t usCRC;
+StreamBufferFragment_t xFragments[ 3 ];
+
+    vBuildHeader( &xHeader, xPayloadLength );
+    usCRC = usCalculateCRC( pucPayload, xPayloadLength );
+
+    xFragments[ 0 ].pvData = &xHeader;
+    xFragments[ 0 ].xLengthBytes = sizeof( xHeader );
+    xFragments[ 1 ].pvData = pucPayload;
+    xFragments[ 1 ].xLengthBytes = xPayloadLength;
+    xFragments[ 2 ].pvData = &usCRC;
+    xFragments[ 2 ].xLengthBytes = sizeof( usCRC );
+
+    xStreamBufferSendV( xStreamBuffer, xFragments, 3, portMAX_DELAY );
+}
+</pre>
+ * \defgroup xStreamBufferSendV xStreamBufferSendV
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+						   const StreamBufferFragment_t *pxFragments,
+						   UBaseType_t uxFragmentCount,
+						   TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferSendVFromISR( StreamBufferHandle_t xStreamBuffer,
+                                  const StreamBufferFragment_t *pxFragments,
+                                  UBaseType_t uxFragmentCount,
+                                  BaseType_t *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Interrupt safe version of xStreamBufferSendV().  The
+ * pxHigherPriorityTaskWoken parameter behaves as for
+ * xStreamBufferSendFromISR().
+ *
+ * \defgroup xStreamBufferSendVFromISR xStreamBufferSendVFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendVFromISR( StreamBufferHandle_t xStreamBuffer,
+								  const StreamBufferFragment_t *pxFragments,
+								  UBaseType_t uxFragmentCount,
+								  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+                                 void **ppvData,
+                                 TickType_t xTicksToWait );
+</pre>
+ *
+ * Obtains direct access to free space in a stream buffer so data can be
+ * written into the buffer in place, for example by a DMA engine, rather than
+ * being copied in by xStreamBufferSend().  The data does not become available
+ * to the reader until it is committed using xStreamBufferSendCommit() or
+ * xStreamBufferSendCommitFromISR().
+ *
+ * The space returned is the free space that starts at the position the next
+ * byte will be written to and ends either before the unread data or at the end
+ * of the buffer's storage area, whichever comes first.  If the free space wraps
+ * around the end of the storage area, the space at the start of the storage
+ * area is returned by the reserve call that follows the commit.
+ *
+ * Reserve and commit can only be used with stream buffers, not message
+ * buffers.  The single writer restriction that applies to xStreamBufferSend()
+ * also applies here, and the writer must not send or reserve again until it has
+ * committed.
+ *
+ * Use xStreamBufferSendReserve() to reserve space from a task.  Use
+ * xStreamBufferSendReserveFromISR() to reserve space from an interrupt service
+ * routine (ISR).
+ *
+ * @param xStreamBuffer The handle of the stream buffer being written to.
+ *
+ * @param ppvData Set to point to the first free byte in the buffer.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for space to become available if the stream buffer is
+ * full.
+ *
+ * @return The number of bytes that can be written at *ppvData, which is 0 if
+ * the buffer remained full for the whole block time.
+ *
+ * Example use:
+<pre>
+void vStartReceive( StreamBufferHandle_t xStreamBuffer )
+{
+void *pvData;
+size_t xSpace;
+
+    // Point the DMA engine straight at the free space in the stream buffer.
+    xSpace = xStreamBufferSendReserve( xStreamBuffer, &pvData, portMAX_DELAY );
+    vStartDMA( pvData, xSpace );
+}
+
+void vDMACompleteISR( void )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    // Make the bytes the DMA engine wrote visible to the reader.
+    xStreamBufferSendCommitFromISR( xStreamBuffer, xDMABytesTransferred(), &xHigherPriorityTaskWoken );
+    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+</pre>
+ * \defgroup xStreamBufferSendReserve xStreamBufferSendReserve
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+								 void **ppvData,
+								 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferSendReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        void **ppvData );
+</pre>
+ *
+ * Interrupt safe version of xStreamBufferSendReserve().  It does not block, so
+ * returns 0 if the stream buffer is full.
+ *
+ * \defgroup xStreamBufferSendReserveFromISR xStreamBufferSendReserveFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+										void **ppvData ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+                                size_t xBytesWritten );
+</pre>
+ *
+ * Makes xBytesWritten bytes written into the space obtained from
+ * xStreamBufferSendReserve() or xStreamBufferSendReserveFromISR() available to
+ * the reader.  If that takes the number of bytes in the buffer to the trigger
+ * level, a task blocked waiting to read from the buffer is unblocked, just as
+ * if the bytes had been sent using xStreamBufferSend().
+ *
+ * Use xStreamBufferSendCommit() to commit from a task.  Use
+ * xStreamBufferSendCommitFromISR() to commit from an interrupt service routine
+ * (ISR).
+ *
+ * @param xStreamBuffer The handle of the stream buffer being written to.
+ *
+ * @param xBytesWritten The number of bytes written, which must not exceed the
+ * number of bytes returned by the reserve call.  Bytes are committed in order
+ * from the start of the reserved space.
+ *
+ * @return The number of bytes committed.
+ *
+ * \defgroup xStreamBufferSendCommit xStreamBufferSendCommit
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+								size_t xBytesWritten ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                       size_t xBytesWritten,
+                                       BaseType_t *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Interrupt safe version of xStreamBufferSendCommit().
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if committing the data
+ * unblocked a task that has a priority above the priority of the currently
+ * running task, in which case a context switch should be requested before the
+ * interrupt is exited.
+ *
+ * \defgroup xStreamBufferSendCommitFromISR xStreamBufferSendCommitFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+									   size_t xBytesWritten,
+									   BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /**
  * stream_buffer.h
  *
@@ -590,6 +894,158 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
 									size_t xBufferLengthBytes,
 									BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReceivePeek( StreamBufferHandle_t xStreamBuffer,
+                                 const uint8_t **ppucFirst,
+                                 size_t *pxFirstLength,
+                                 const uint8_t **ppucSecond,
+                                 size_t *pxSecondLength,
+                                 TickType_t xTicksToWait );
+</pre>
+ *
+ * Obtains direct access to the bytes in a stream buffer so they can be
+ * inspected in place, rather than being copied out by xStreamBufferReceive().
+ * The bytes remain in the buffer until they are removed using
+ * xStreamBufferReceiveConsume() or xStreamBufferReceiveConsumeFromISR().
+ *
+ * The bytes are described by up to two spans.  The first span starts at the
+ * oldest byte in the buffer.  If the bytes wrap around the end of the buffer's
+ * storage area then the second span holds the bytes at the start of the
+ * storage area, otherwise the second span is empty.
+ *
+ * Peek and consume can only be used with stream buffers, not message buffers.
+ * The single reader restriction that applies to xStreamBufferReceive() also
+ * applies here.
+ *
+ * Use xStreamBufferReceivePeek() to peek from a task.  Use
+ * xStreamBufferReceivePeekFromISR() to peek from an interrupt service routine
+ * (ISR).
+ *
+ * @param xStreamBuffer The handle of the stream buffer being read.
+ *
+ * @param ppucFirst Set to point to the oldest byte in the buffer.
+ *
+ * @param pxFirstLength Set to the number of bytes in the first span.
+ *
+ * @param ppucSecond Set to point to the start of the buffer's storage area if
+ * the bytes wrap, otherwise set to NULL.
+ *
+ * @param pxSecondLength Set to the number of bytes in the second span, which is
+ * 0 if the bytes do not wrap.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for data if the stream buffer is empty.
+ *
+ * @return The total number of bytes described by the two spans, which is 0 if
+ * the buffer remained empty for the whole block time.
+ *
+ * Example use:
+<pre>
+void vAParserTask( void *pvParameters )
+{
+const uint8_t *pucFirst, *pucSecond;
+size_t xFirstLength, xSecondLength, xUsed;
+
+    for( ;; )
+    {
+        xStreamBufferReceivePeek( xStreamBuffer, &pucFirst, &xFirstLength, &pucSecond, &xSecondLength, portMAX_DELAY );
+
+        // Parse the bytes where they are, then remove the bytes that were
+        // used from the buffer.
+        xUsed = xParse( pucFirst, xFirstLength, pucSecond, xSecondLength );
+        xStreamBufferReceiveConsume( xStreamBuffer, xUsed );
+    }
+}
+</pre>
+ * \defgroup xStreamBufferReceivePeek xStreamBufferReceivePeek
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceivePeek( StreamBufferHandle_t xStreamBuffer,
+								 const uint8_t **ppucFirst,
+								 size_t *pxFirstLength,
+								 const uint8_t **ppucSecond,
+								 size_t *pxSecondLength,
+								 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReceivePeekFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        const uint8_t **ppucFirst,
+                                        size_t *pxFirstLength,
+                                        const uint8_t **ppucSecond,
+                                        size_t *pxSecondLength );
+</pre>
+ *
+ * Interrupt safe version of xStreamBufferReceivePeek().  It does not block, so
+ * returns 0 if the stream buffer is empty.
+ *
+ * \defgroup xStreamBufferReceivePeekFromISR xStreamBufferReceivePeekFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceivePeekFromISR( StreamBufferHandle_t xStreamBuffer,
+										const uint8_t **ppucFirst,
+										size_t *pxFirstLength,
+										const uint8_t **ppucSecond,
+										size_t *pxSecondLength ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReceiveConsume( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xBytesConsumed );
+</pre>
+ *
+ * Removes the oldest xBytesConsumed bytes from a stream buffer, for example
+ * after they have been inspected using xStreamBufferReceivePeek().  If a task
+ * was blocked waiting for space in the buffer it is unblocked, just as if the
+ * bytes had been read using xStreamBufferReceive().
+ *
+ * Use xStreamBufferReceiveConsume() to consume from a task.  Use
+ * xStreamBufferReceiveConsumeFromISR() to consume from an interrupt service
+ * routine (ISR).
+ *
+ * @param xStreamBuffer The handle of the stream buffer being read.
+ *
+ * @param xBytesConsumed The number of bytes to remove, which must not exceed the
+ * number of bytes in the buffer.
+ *
+ * @return The number of bytes removed.
+ *
+ * \defgroup xStreamBufferReceiveConsume xStreamBufferReceiveConsume
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveConsume( StreamBufferHandle_t xStreamBuffer,
+									size_t xBytesConsumed ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReceiveConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+                                           size_t xBytesConsumed,
+                                           BaseType_t *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Interrupt safe version of xStreamBufferReceiveConsume().
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if removing the bytes
+ * unblocked a task that has a priority above the priority of the currently
+ * running task, in which case a context switch should be requested before the
+ * interrupt is exited.
+ *
+ * \defgroup xStreamBufferReceiveConsumeFromISR xStreamBufferReceiveConsumeFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+										   size_t xBytesConsumed,
+										   BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /**
  * stream_buffer.h
  *
@@ -833,14 +1289,254 @@ BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuf
  */
 BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuffer, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+StreamBufferMuxHandle_t xStreamBufferMuxCreate( UBaseType_t uxChannels, UBaseType_t uxBlockCount, size_t xBlockSizeBytes );
+</pre>
+ *
+ * Creates a multiplexed stream buffer - uxChannels independent byte streams
+ * that share a single pool of uxBlockCount storage blocks, each
+ * xBlockSizeBytes long.  A channel takes blocks from the pool as data is
+ * written to it and returns them as the data is read, so a busy channel can
+ * use the space an idle channel is not using.  Any one channel can hold up to
+ * uxBlockCount * xBlockSizeBytes bytes.
+ *
+ * Each channel has its own trigger level and its own waiting tasks, so it
+ * behaves like a separate stream buffer with one writer and one reader.  A
+ * task that is blocked waiting to write to a channel is unblocked when blocks
+ * are returned to the pool by a read from any channel.
+ *
+ * configUSE_MULTIPLEXED_STREAM_BUFFERS must be set to 1 in FreeRTOSConfig.h
+ * for xStreamBufferMuxCreate() to be available.  The structures, the block
+ * links and the pool are allocated with a single call to pvPortMalloc().
+ *
+ * @param uxChannels The number of channels.
+ *
+ * @param uxBlockCount The number of blocks in the shared pool.
+ *
+ * @param xBlockSizeBytes The size of each block.  Smaller blocks waste less
+ * space in partially filled blocks, larger blocks require fewer block links to
+ * be followed when data is copied.
+ *
+ * @return If the multiplexed stream buffer is created successfully then a
+ * handle to it is returned.  If there was insufficient heap memory available
+ * then NULL is returned.
+ *
+ * \defgroup xStreamBufferMuxCreate xStreamBufferMuxCreate
+ * \ingroup StreamBufferManagement
+ */
+StreamBufferMuxHandle_t xStreamBufferMuxCreate( UBaseType_t uxChannels,
+												UBaseType_t uxBlockCount,
+												size_t xBlockSizeBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferMuxSend( StreamBufferMuxHandle_t xStreamBufferMux,
+                             UBaseType_t uxChannel,
+                             const void *pvTxData,
+                             size_t xDataLengthBytes,
+                             TickType_t xTicksToWait );
+</pre>
+ *
+ * Sends bytes to one channel of a multiplexed stream buffer.  Behaves as
+ * xStreamBufferSend(), except that the space available to the channel is the
+ * unused part of the block it is writing plus every free block in the shared
+ * pool.
+ *
+ * Use xStreamBufferMuxSendFromISR() to write to a channel from an interrupt
+ * service routine.
+ *
+ * @param xStreamBufferMux The handle of the multiplexed stream buffer.
+ *
+ * @param uxChannel The channel to write to, from 0 to uxChannels - 1.
+ *
+ * @param pvTxData A pointer to the buffer that holds the bytes to be copied
+ * into the channel.
+ *
+ * @param xDataLengthBytes The maximum number of bytes to copy from pvTxData.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for enough space to become available in the pool.
+ *
+ * @return The number of bytes written to the channel.  If a task times out
+ * before it can write all xDataLengthBytes then it will still write as many
+ * bytes as possible.
+ *
+ * \defgroup xStreamBufferMuxSend xStreamBufferMuxSend
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferMuxSend( StreamBufferMuxHandle_t xStreamBufferMux,
+							 UBaseType_t uxChannel,
+							 const void *pvTxData,
+							 size_t xDataLengthBytes,
+							 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferMuxSendFromISR( StreamBufferMuxHandle_t xStreamBufferMux,
+                                    UBaseType_t uxChannel,
+                                    const void *pvTxData,
+                                    size_t xDataLengthBytes,
+                                    BaseType_t *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Interrupt safe version of xStreamBufferMuxSend().  Writes as many of the
+ * bytes as fit in the space available to the channel and never blocks.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if writing the data unblocks
+ * a task that has a priority above the currently running task.
+ *
+ * \defgroup xStreamBufferMuxSendFromISR xStreamBufferMuxSendFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferMuxSendFromISR( StreamBufferMuxHandle_t xStreamBufferMux,
+									UBaseType_t uxChannel,
+									const void *pvTxData,
+									size_t xDataLengthBytes,
+									BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferMuxReceive( StreamBufferMuxHandle_t xStreamBufferMux,
+                                UBaseType_t uxChannel,
+                                void *pvRxData,
+                                size_t xBufferLengthBytes,
+                                TickType_t xTicksToWait );
+</pre>
+ *
+ * Receives bytes from one channel of a multiplexed stream buffer.  Behaves as
+ * xStreamBufferReceive().  Blocks that have been completely read are returned
+ * to the shared pool, and any task waiting to write to any channel is
+ * unblocked.
+ *
+ * Use xStreamBufferMuxReceiveFromISR() to read from a channel from an
+ * interrupt service routine.
+ *
+ * @param xStreamBufferMux The handle of the multiplexed stream buffer.
+ *
+ * @param uxChannel The channel to read from, from 0 to uxChannels - 1.
+ *
+ * @param pvRxData A pointer to the buffer into which the received bytes will
+ * be copied.
+ *
+ * @param xBufferLengthBytes The length of the buffer pointed to by pvRxData.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for data to arrive on the channel.
+ *
+ * @return The number of bytes read from the channel.
+ *
+ * \defgroup xStreamBufferMuxReceive xStreamBufferMuxReceive
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferMuxReceive( StreamBufferMuxHandle_t xStreamBufferMux,
+								UBaseType_t uxChannel,
+								void *pvRxData,
+								size_t xBufferLengthBytes,
+								TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferMuxReceiveFromISR( StreamBufferMuxHandle_t xStreamBufferMux,
+                                       UBaseType_t uxChannel,
+                                       void *pvRxData,
+                                       size_t xBufferLengthBytes,
+                                       BaseType_t *pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Interrupt safe version of xStreamBufferMuxReceive().
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if returning blocks to the
+ * pool unblocks a task that has a priority above the currently running task.
+ *
+ * \defgroup xStreamBufferMuxReceiveFromISR xStreamBufferMuxReceiveFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferMuxReceiveFromISR( StreamBufferMuxHandle_t xStreamBufferMux,
+									   UBaseType_t uxChannel,
+									   void *pvRxData,
+									   size_t xBufferLengthBytes,
+									   BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferMuxBytesAvailable( StreamBufferMuxHandle_t xStreamBufferMux, UBaseType_t uxChannel );
+size_t xStreamBufferMuxSpacesAvailable( StreamBufferMuxHandle_t xStreamBufferMux, UBaseType_t uxChannel );
+</pre>
+ *
+ * Query the number of bytes that can be read from, and written to, a channel
+ * of a multiplexed stream buffer.  The space available to every channel
+ * changes whenever any channel takes blocks from, or returns blocks to, the
+ * shared pool.
+ *
+ * \defgroup xStreamBufferMuxBytesAvailable xStreamBufferMuxBytesAvailable
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferMuxBytesAvailable( StreamBufferMuxHandle_t xStreamBufferMux,
+									   UBaseType_t uxChannel ) PRIVILEGED_FUNCTION;
+size_t xStreamBufferMuxSpacesAvailable( StreamBufferMuxHandle_t xStreamBufferMux,
+										UBaseType_t uxChannel ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+BaseType_t xStreamBufferMuxSetTriggerLevel( StreamBufferMuxHandle_t xStreamBufferMux, UBaseType_t uxChannel, size_t xTriggerLevel );
+</pre>
+ *
+ * Sets the trigger level of one channel, as xStreamBufferSetTriggerLevel()
+ * does for a stream buffer.  Each channel starts with a trigger level of 1.
+ *
+ * @return If xTriggerLevel was less than or equal to the size of the shared
+ * pool then the trigger level will be updated and pdTRUE returned.  Otherwise
+ * pdFALSE is returned.
+ *
+ * \defgroup xStreamBufferMuxSetTriggerLevel xStreamBufferMuxSetTriggerLevel
+ * \ingroup StreamBufferManagement
+ */
+BaseType_t xStreamBufferMuxSetTriggerLevel( StreamBufferMuxHandle_t xStreamBufferMux,
+											UBaseType_t uxChannel,
+											size_t xTriggerLevel ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+void vStreamBufferMuxDelete( StreamBufferMuxHandle_t xStreamBufferMux );
+</pre>
+ *
+ * Deletes a multiplexed stream buffer that was created using
+ * xStreamBufferMuxCreate().  No tasks may be blocked on any of its channels.
+ *
+ * \defgroup vStreamBufferMuxDelete vStreamBufferMuxDelete
+ * \ingroup StreamBufferManagement
+ */
+void vStreamBufferMuxDelete( StreamBufferMuxHandle_t xStreamBufferMux ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+
 /* Functions below here are not part of the public API. */
 StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes,
 												 size_t xTriggerLevelBytes,
-												 BaseType_t xIsMessageBuffer ) PRIVILEGED_FUNCTION;
+												 BaseType_t xStreamBufferType ) PRIVILEGED_FUNCTION;
 
 StreamBufferHandle_t xStreamBufferGenericCreateStatic( size_t xBufferSizeBytes,
 													   size_t xTriggerLevelBytes,
-													   BaseType_t xIsMessageBuffer,
+													   BaseType_t xStreamBufferType,
 													   uint8_t * const pucStreamBufferStorageArea,
 													   StaticStreamBuffer_t * const pxStaticStreamBuffer ) PRIVILEGED_FUNCTION;
 
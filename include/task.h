@@ -162,6 +162,14 @@ typedef enum
  */
 #define tskIDLE_PRIORITY			( ( UBaseType_t ) 0U )
 
+/**
+ * Defines the index of the task notification used by the task notification
+ * functions and macros that do not take an explicit index.
+ *
+ * \ingroup TaskNotifications
+ */
+#define tskDEFAULT_INDEX_TO_NOTIFY	( 0 )
+
 /**
  * task. h
  *
@@ -452,6 +460,121 @@ is used in assert() statements. */
 									StaticTask_t * const pxTaskBuffer ) PRIVILEGED_FUNCTION;
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+/**
+ * task. h
+ *<pre>
+ BaseType_t xTaskCreateEDF(
+							  TaskFunction_t pvTaskCode,
+							  const char * const pcName,
+							  configSTACK_DEPTH_TYPE usStackDepth,
+							  void *pvParameters,
+							  TickType_t xRelativeDeadline,
+							  TaskHandle_t *pvCreatedTask
+						  );</pre>
+ *
+ * configUSE_EDF_SCHEDULING and configSUPPORT_DYNAMIC_ALLOCATION must both be
+ * set to 1 in FreeRTOSConfig.h for this function to be available.
+ *
+ * Create a task that is scheduled by Earliest Deadline First.  The task is
+ * created in the same way as by xTaskCreate(), but always at priority
+ * configEDF_TASK_PRIORITY.  Tasks of any other priority are scheduled by
+ * priority as normal, but ready tasks that have priority
+ * configEDF_TASK_PRIORITY run in order of absolute deadline rather than
+ * sharing processing time.
+ *
+ * The first job of the task is released when the task is created, so its
+ * first absolute deadline is the time of creation plus xRelativeDeadline.
+ * Periodic tasks call vTaskWaitForNextPeriod() to wait for the release of
+ * each subsequent job, which also sets the deadline of that job.
+ *
+ * @param pvTaskCode Pointer to the task entry function.
+ *
+ * @param pcName A descriptive name for the task.
+ *
+ * @param usStackDepth The size of the task stack specified as the number of
+ * variables the stack can hold - not the number of bytes.
+ *
+ * @param pvParameters Pointer that will be used as the parameter for the task
+ * being created.
+ *
+ * @param xRelativeDeadline The time, in ticks, within which each job of the
+ * task should complete after it is released.  Must be greater than zero.
+ *
+ * @param pvCreatedTask Used to pass back a handle by which the created task
+ * can be referenced.
+ *
+ * @return pdPASS if the task was successfully created and added to a ready
+ * list, otherwise an error code defined in the file projdefs.h
+ *
+ * Example usage:
+   <pre>
+ // A task that runs every 10 ticks, and must complete within 5 ticks of
+ // being released.
+ void vControlTask( void * pvParameters )
+ {
+ TickType_t xLastWakeTime = xTaskGetTickCount();
+
+	 for( ;; )
+	 {
+		 // Perform action here.
+
+		 // Wait for the next period.
+		 vTaskWaitForNextPeriod( &xLastWakeTime, 10 );
+	 }
+ }
+
+ void vOtherFunction( void )
+ {
+	 xTaskCreateEDF( vControlTask, "CTRL", STACK_SIZE, NULL, 5, NULL );
+ }
+   </pre>
+ * \defgroup xTaskCreateEDF xTaskCreateEDF
+ * \ingroup Tasks
+ */
+#if( ( configUSE_EDF_SCHEDULING == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+	BaseType_t xTaskCreateEDF(	TaskFunction_t pxTaskCode,
+								const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+								const configSTACK_DEPTH_TYPE usStackDepth,
+								void * const pvParameters,
+								const TickType_t xRelativeDeadline,
+								TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ *<pre>
+ TaskHandle_t xTaskCreateEDFStatic( TaskFunction_t pvTaskCode,
+								 const char * const pcName,
+								 uint32_t ulStackDepth,
+								 void *pvParameters,
+								 TickType_t xRelativeDeadline,
+								 StackType_t *pxStackBuffer,
+								 StaticTask_t *pxTaskBuffer );</pre>
+ *
+ * configUSE_EDF_SCHEDULING and configSUPPORT_STATIC_ALLOCATION must both be
+ * set to 1 in FreeRTOSConfig.h for this function to be available.
+ *
+ * As xTaskCreateEDF(), but the memory used by the task is provided by the
+ * application writer as described for xTaskCreateStatic().
+ *
+ * @return If neither pxStackBuffer or pxTaskBuffer are NULL, then the task
+ * will be created and a handle to the created task is returned.  If either
+ * pxStackBuffer or pxTaskBuffer are NULL then the task will not be created and
+ * NULL is returned.
+ *
+ * \defgroup xTaskCreateEDFStatic xTaskCreateEDFStatic
+ * \ingroup Tasks
+ */
+#if( ( configUSE_EDF_SCHEDULING == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+	TaskHandle_t xTaskCreateEDFStatic(	TaskFunction_t pxTaskCode,
+										const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+										const uint32_t ulStackDepth,
+										void * const pvParameters,
+										const TickType_t xRelativeDeadline,
+										StackType_t * const puxStackBuffer,
+										StaticTask_t * const pxTaskBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  *<pre>
@@ -816,6 +939,36 @@ void vTaskDelay( const TickType_t xTicksToDelay ) PRIVILEGED_FUNCTION;
  */
 void vTaskDelayUntil( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <pre>void vTaskWaitForNextPeriod( TickType_t *pxPreviousWakeTime, const TickType_t xTimeIncrement );</pre>
+ *
+ * configUSE_EDF_SCHEDULING and INCLUDE_vTaskDelayUntil must both be set to 1
+ * in FreeRTOSConfig.h for this function to be available.
+ *
+ * Called by a task created using xTaskCreateEDF() to end its current job and
+ * wait for the release of its next job.  The parameters are used exactly as
+ * those of vTaskDelayUntil(), with the next job being released at the time the
+ * task unblocks.  Before blocking, the absolute deadline of the task is set to
+ * that release time plus the relative deadline the task was created with, so
+ * if the current job has overrun its period the task continues immediately,
+ * ordered by the deadline of the next job.
+ *
+ * @param pxPreviousWakeTime Pointer to a variable that holds the time at which
+ * the previous job was released.  The variable must be initialised with the
+ * current time prior to its first use (see the example for xTaskCreateEDF()).
+ * Following this the variable is automatically updated within
+ * vTaskWaitForNextPeriod().
+ *
+ * @param xTimeIncrement The period of the task.
+ *
+ * \defgroup vTaskWaitForNextPeriod vTaskWaitForNextPeriod
+ * \ingroup TaskCtrl
+ */
+#if( configUSE_EDF_SCHEDULING == 1 )
+	void vTaskWaitForNextPeriod( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * <pre>BaseType_t xTaskAbortDelay( TaskHandle_t xTask );</pre>
@@ -1017,6 +1170,69 @@ void vTaskGetInfo( TaskHandle_t xTask, TaskStatus_t *pxTaskStatus, BaseType_t xG
  */
 void vTaskPrioritySet( TaskHandle_t xTask, UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <pre>void vTaskPreemptionThresholdSet( TaskHandle_t xTask, UBaseType_t uxNewThreshold );</pre>
+ *
+ * configUSE_PREEMPTION_THRESHOLD must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Set the preemption threshold of any task.  Once the task is running, only
+ * tasks with a priority above its preemption threshold can preempt it, so a
+ * group of tasks with priorities up to the threshold do not preempt each
+ * other while still being preempted by tasks of higher priority.  A task
+ * that has raised its threshold above its priority is not time sliced with
+ * tasks of equal priority.  A threshold below the priority of the task has
+ * no effect, and a task's threshold is tskIDLE_PRIORITY when it is created.
+ *
+ * A context switch will occur before the function returns if the threshold of
+ * the calling task is lowered below the priority of a ready task.
+ *
+ * @param xTask Handle to the task for which the threshold is being set.
+ * Passing a NULL handle results in the threshold of the calling task being
+ * set.
+ *
+ * @param uxNewThreshold The preemption threshold to which the task will be
+ * set.
+ *
+ * Example usage:
+   <pre>
+ void vPipelineStage( void *pvParameters )
+ {
+	 // Tasks up to priority 4 cannot preempt this task once it is running.
+	 vTaskPreemptionThresholdSet( NULL, 4 );
+
+	 for( ;; )
+	 {
+		 // Process data here.
+	 }
+ }
+   </pre>
+ * \defgroup vTaskPreemptionThresholdSet vTaskPreemptionThresholdSet
+ * \ingroup TaskCtrl
+ */
+void vTaskPreemptionThresholdSet( TaskHandle_t xTask, UBaseType_t uxNewThreshold ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>UBaseType_t uxTaskPreemptionThresholdGet( const TaskHandle_t xTask );</pre>
+ *
+ * configUSE_PREEMPTION_THRESHOLD must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Obtain the preemption threshold of any task, which is never less than the
+ * priority of the task.
+ *
+ * @param xTask Handle of the task to be queried.  Passing a NULL handle
+ * results in the threshold of the calling task being returned.
+ *
+ * @return The preemption threshold of xTask.
+ *
+ * \defgroup uxTaskPreemptionThresholdGet uxTaskPreemptionThresholdGet
+ * \ingroup TaskCtrl
+ */
+UBaseType_t uxTaskPreemptionThresholdGet( const TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <pre>void vTaskSuspend( TaskHandle_t xTaskToSuspend );</pre>
@@ -1774,6 +1990,7 @@ uint32_t ulTaskGetIdleRunTimeCounter( void ) PRIVILEGED_FUNCTION;
 /**
  * task. h
  * <PRE>BaseType_t xTaskNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction );</PRE>
+ * <PRE>BaseType_t xTaskNotifyIndexed( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction );</PRE>
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
  * function to be available.
@@ -1781,6 +1998,17 @@ uint32_t ulTaskGetIdleRunTimeCounter( void ) PRIVILEGED_FUNCTION;
  * When configUSE_TASK_NOTIFICATIONS is set to one each task has its own private
  * "notification value", which is a 32-bit unsigned integer (uint32_t).
  *
+ * Each task in fact has an array of configTASK_NOTIFICATION_ARRAY_ENTRIES
+ * notification values, each with its own notification state, so a task can
+ * use notifications for several unrelated purposes at once.  The functions
+ * and macros that do not end in "Indexed" operate on index
+ * tskDEFAULT_INDEX_TO_NOTIFY (index 0), and are equivalent to calling the
+ * Indexed form with uxIndexToNotify or uxIndexToWaitOn set to 0.  Index
+ * configKERNEL_NOTIFICATION_INDEX, which defaults to the last index, is used
+ * by stream buffers and message buffers to unblock tasks, so should not be
+ * used by the application when configTASK_NOTIFICATION_ARRAY_ENTRIES is
+ * greater than 1.
+ *
  * Events can be sent to a task using an intermediary object.  Examples of such
  * objects are queues, semaphores, mutexes and event groups.  Task notifications
  * are a method of sending an event directly to a task without the need for such
@@ -1809,6 +2037,11 @@ uint32_t ulTaskGetIdleRunTimeCounter( void ) PRIVILEGED_FUNCTION;
  * task, and the handle of the currently running task can be obtained by calling
  * xTaskGetCurrentTaskHandle().
  *
+ * @param uxIndexToNotify The index within the target task's array of
+ * notification values to which the notification is to be sent.  Only
+ * available through the Indexed form of the API.  uxIndexToNotify must be less
+ * than configTASK_NOTIFICATION_ARRAY_ENTRIES.
+ *
  * @param ulValue Data that can be sent with the notification.  How the data is
  * used depends on the value of the eAction parameter.
  *
@@ -1850,13 +2083,16 @@ uint32_t ulTaskGetIdleRunTimeCounter( void ) PRIVILEGED_FUNCTION;
  * \defgroup xTaskNotify xTaskNotify
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue ) PRIVILEGED_FUNCTION;
-#define xTaskNotify( xTaskToNotify, ulValue, eAction ) xTaskGenericNotify( ( xTaskToNotify ), ( ulValue ), ( eAction ), NULL )
-#define xTaskNotifyAndQuery( xTaskToNotify, ulValue, eAction, pulPreviousNotifyValue ) xTaskGenericNotify( ( xTaskToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotifyValue ) )
+BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue ) PRIVILEGED_FUNCTION;
+#define xTaskNotify( xTaskToNotify, ulValue, eAction ) xTaskGenericNotify( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), NULL )
+#define xTaskNotifyIndexed( xTaskToNotify, uxIndexToNotify, ulValue, eAction ) xTaskGenericNotify( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulValue ), ( eAction ), NULL )
+#define xTaskNotifyAndQuery( xTaskToNotify, ulValue, eAction, pulPreviousNotifyValue ) xTaskGenericNotify( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), ( pulPreviousNotifyValue ) )
+#define xTaskNotifyAndQueryIndexed( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pulPreviousNotifyValue ) xTaskGenericNotify( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotifyValue ) )
 
 /**
  * task. h
  * <PRE>BaseType_t xTaskNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, BaseType_t *pxHigherPriorityTaskWoken );</PRE>
+ * <PRE>BaseType_t xTaskNotifyIndexedFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, BaseType_t *pxHigherPriorityTaskWoken );</PRE>
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
  * function to be available.
@@ -1895,6 +2131,11 @@ BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNo
  * task, and the handle of the currently running task can be obtained by calling
  * xTaskGetCurrentTaskHandle().
  *
+ * @param uxIndexToNotify The index within the target task's array of
+ * notification values to which the notification is to be sent.  Only
+ * available through the Indexed form of the API.  uxIndexToNotify must be less
+ * than configTASK_NOTIFICATION_ARRAY_ENTRIES.
+ *
  * @param ulValue Data that can be sent with the notification.  How the data is
  * used depends on the value of the eAction parameter.
  *
@@ -1941,13 +2182,16 @@ BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNo
  * \defgroup xTaskNotify xTaskNotify
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
-#define xTaskNotifyFromISR( xTaskToNotify, ulValue, eAction, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( ulValue ), ( eAction ), NULL, ( pxHigherPriorityTaskWoken ) )
-#define xTaskNotifyAndQueryFromISR( xTaskToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotificationValue ), ( pxHigherPriorityTaskWoken ) )
+BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#define xTaskNotifyFromISR( xTaskToNotify, ulValue, eAction, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), NULL, ( pxHigherPriorityTaskWoken ) )
+#define xTaskNotifyIndexedFromISR( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulValue ), ( eAction ), NULL, ( pxHigherPriorityTaskWoken ) )
+#define xTaskNotifyAndQueryFromISR( xTaskToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), ( pulPreviousNotificationValue ), ( pxHigherPriorityTaskWoken ) )
+#define xTaskNotifyAndQueryIndexedFromISR( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotificationValue ), ( pxHigherPriorityTaskWoken ) )
 
 /**
  * task. h
  * <PRE>BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait );</pre>
+ * <PRE>BaseType_t xTaskNotifyWaitIndexed( UBaseType_t uxIndexToWaitOn, uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait );</pre>
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
  * function to be available.
@@ -1978,6 +2222,11 @@ BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulVal
  *
  * See http://www.FreeRTOS.org/RTOS-task-notifications.html for details.
  *
+ * @param uxIndexToWaitOn The index within the calling task's array of
+ * notification values on which the calling task will wait.  Only available
+ * through the Indexed form of the API.  uxIndexToWaitOn must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.
+ *
  * @param ulBitsToClearOnEntry Bits that are set in ulBitsToClearOnEntry value
  * will be cleared in the calling task's notification value before the task
  * checks to see if any notifications are pending, and optionally blocks if no
@@ -2018,11 +2267,78 @@ BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulVal
  * \defgroup xTaskNotifyWait xTaskNotifyWait
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWaitOn, uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#define xTaskNotifyWait( ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait ) xTaskGenericNotifyWait( ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulBitsToClearOnEntry ), ( ulBitsToClearOnExit ), ( pulNotificationValue ), ( xTicksToWait ) )
+#define xTaskNotifyWaitIndexed( uxIndexToWaitOn, ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait ) xTaskGenericNotifyWait( ( uxIndexToWaitOn ), ( ulBitsToClearOnEntry ), ( ulBitsToClearOnExit ), ( pulNotificationValue ), ( xTicksToWait ) )
+
+/**
+ * task. h
+ * <PRE>BaseType_t xTaskNotifyWaitBits( uint32_t ulBitsToWaitFor, BaseType_t xClearOnExit, BaseType_t xWaitForAllBits, uint32_t *pulNotificationValue, TickType_t xTicksToWait );</pre>
+ * <PRE>BaseType_t xTaskNotifyWaitBitsIndexed( UBaseType_t uxIndexToWaitOn, uint32_t ulBitsToWaitFor, BaseType_t xClearOnExit, BaseType_t xWaitForAllBits, uint32_t *pulNotificationValue, TickType_t xTicksToWait );</pre>
+ *
+ * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
+ * function to be available.
+ *
+ * Uses the task's notification value as a light weight event group.  Where
+ * xTaskNotifyWait() returns as soon as any notification is received,
+ * xTaskNotifyWaitBits() keeps the calling task in the Blocked state until
+ * either any one (xWaitForAllBits set to pdFALSE) or all (xWaitForAllBits set
+ * to pdTRUE) of the bits in ulBitsToWaitFor are set in the task's notification
+ * value.  Notifications that do not satisfy the wait condition still update
+ * the notification value, but do not unblock the task.
+ *
+ * The wait condition is evaluated by xTaskNotify(), xTaskNotifyFromISR() and
+ * the other notification functions at the point the notification value is
+ * updated, so unlike xEventGroupSetBits() setting bits does not suspend the
+ * scheduler or walk a list of waiting tasks.  The trade off is that, as with
+ * all direct to task notifications, only the receiving task can wait.  Bits
+ * are normally set using xTaskNotify() with the eAction parameter set to
+ * eSetBits.
+ *
+ * See http://www.FreeRTOS.org/RTOS-task-notifications.html for details.
+ *
+ * @param uxIndexToWaitOn The index within the calling task's array of
+ * notification values on which the calling task will wait.  Only available
+ * through the Indexed form of the API.  uxIndexToWaitOn must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.
+ *
+ * @param ulBitsToWaitFor A bitwise value that indicates the bit or bits to
+ * test inside the notification value.  ulBitsToWaitFor must not be 0.
+ *
+ * @param xClearOnExit If xClearOnExit is set to pdTRUE then the bits in
+ * ulBitsToWaitFor are cleared in the notification value before the function
+ * returns if the wait condition was met.  The bits are not cleared if the
+ * function returns because the block time expired.
+ *
+ * @param xWaitForAllBits If xWaitForAllBits is set to pdTRUE then the function
+ * only returns pdTRUE when all the bits in ulBitsToWaitFor are set.  If
+ * xWaitForAllBits is set to pdFALSE then the function returns pdTRUE when any
+ * of the bits in ulBitsToWaitFor are set.
+ *
+ * @param pulNotificationValue Used to pass the task's notification value out
+ * of the function.  The value passed out is the value before any bits were
+ * cleared because xClearOnExit was set to pdTRUE.  Set to NULL if the value is
+ * not required.
+ *
+ * @param xTicksToWait The maximum amount of time that the task should wait in
+ * the Blocked state for the wait condition to be met.  This is specified in
+ * kernel ticks, the macro pdMS_TO_TICKS( value_in_ms ) can be used to convert a
+ * time specified in milliseconds to a time specified in ticks.
+ *
+ * @return pdTRUE if the wait condition was met (including if it was already
+ * met when xTaskNotifyWaitBits() was called), otherwise pdFALSE.
+ *
+ * \defgroup xTaskNotifyWaitBits xTaskNotifyWaitBits
+ * \ingroup TaskNotifications
+ */
+BaseType_t xTaskGenericNotifyWaitBits( UBaseType_t uxIndexToWaitOn, uint32_t ulBitsToWaitFor, BaseType_t xClearOnExit, BaseType_t xWaitForAllBits, uint32_t *pulNotificationValue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#define xTaskNotifyWaitBits( ulBitsToWaitFor, xClearOnExit, xWaitForAllBits, pulNotificationValue, xTicksToWait ) xTaskGenericNotifyWaitBits( ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulBitsToWaitFor ), ( xClearOnExit ), ( xWaitForAllBits ), ( pulNotificationValue ), ( xTicksToWait ) )
+#define xTaskNotifyWaitBitsIndexed( uxIndexToWaitOn, ulBitsToWaitFor, xClearOnExit, xWaitForAllBits, pulNotificationValue, xTicksToWait ) xTaskGenericNotifyWaitBits( ( uxIndexToWaitOn ), ( ulBitsToWaitFor ), ( xClearOnExit ), ( xWaitForAllBits ), ( pulNotificationValue ), ( xTicksToWait ) )
 
 /**
  * task. h
  * <PRE>BaseType_t xTaskNotifyGive( TaskHandle_t xTaskToNotify );</PRE>
+ * <PRE>BaseType_t xTaskNotifyGiveIndexed( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify );</PRE>
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this macro
  * to be available.
@@ -2058,17 +2374,24 @@ BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClea
  * task, and the handle of the currently running task can be obtained by calling
  * xTaskGetCurrentTaskHandle().
  *
+ * @param uxIndexToNotify The index within the target task's array of
+ * notification values to which the notification is to be sent.  Only
+ * available through the Indexed form of the API.  uxIndexToNotify must be less
+ * than configTASK_NOTIFICATION_ARRAY_ENTRIES.
+ *
  * @return xTaskNotifyGive() is a macro that calls xTaskNotify() with the
  * eAction parameter set to eIncrement - so pdPASS is always returned.
  *
  * \defgroup xTaskNotifyGive xTaskNotifyGive
  * \ingroup TaskNotifications
  */
-#define xTaskNotifyGive( xTaskToNotify ) xTaskGenericNotify( ( xTaskToNotify ), ( 0 ), eIncrement, NULL )
+#define xTaskNotifyGive( xTaskToNotify ) xTaskGenericNotify( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( 0 ), eIncrement, NULL )
+#define xTaskNotifyGiveIndexed( xTaskToNotify, uxIndexToNotify ) xTaskGenericNotify( ( xTaskToNotify ), ( uxIndexToNotify ), ( 0 ), eIncrement, NULL )
 
 /**
  * task. h
  * <PRE>void vTaskNotifyGiveFromISR( TaskHandle_t xTaskHandle, BaseType_t *pxHigherPriorityTaskWoken );
+ * <PRE>void vTaskNotifyGiveIndexedFromISR( TaskHandle_t xTaskHandle, UBaseType_t uxIndexToNotify, BaseType_t *pxHigherPriorityTaskWoken );
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this macro
  * to be available.
@@ -2107,6 +2430,11 @@ BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClea
  * task, and the handle of the currently running task can be obtained by calling
  * xTaskGetCurrentTaskHandle().
  *
+ * @param uxIndexToNotify The index within the target task's array of
+ * notification values to which the notification is to be sent.  Only
+ * available through the Indexed form of the API.  uxIndexToNotify must be less
+ * than configTASK_NOTIFICATION_ARRAY_ENTRIES.
+ *
  * @param pxHigherPriorityTaskWoken  vTaskNotifyGiveFromISR() will set
  * *pxHigherPriorityTaskWoken to pdTRUE if sending the notification caused the
  * task to which the notification was sent to leave the Blocked state, and the
@@ -2119,11 +2447,14 @@ BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClea
  * \defgroup xTaskNotifyWait xTaskNotifyWait
  * \ingroup TaskNotifications
  */
-void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+void vTaskGenericNotifyGiveFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#define vTaskNotifyGiveFromISR( xTaskToNotify, pxHigherPriorityTaskWoken ) vTaskGenericNotifyGiveFromISR( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( pxHigherPriorityTaskWoken ) )
+#define vTaskNotifyGiveIndexedFromISR( xTaskToNotify, uxIndexToNotify, pxHigherPriorityTaskWoken ) vTaskGenericNotifyGiveFromISR( ( xTaskToNotify ), ( uxIndexToNotify ), ( pxHigherPriorityTaskWoken ) )
 
 /**
  * task. h
  * <PRE>uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait );</pre>
+ * <PRE>uint32_t ulTaskNotifyTakeIndexed( UBaseType_t uxIndexToWaitOn, BaseType_t xClearCountOnExit, TickType_t xTicksToWait );</pre>
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
  * function to be available.
@@ -2167,6 +2498,11 @@ void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPri
  *
  * See http://www.FreeRTOS.org/RTOS-task-notifications.html for details.
  *
+ * @param uxIndexToWaitOn The index within the calling task's array of
+ * notification values on which the calling task will wait.  Only available
+ * through the Indexed form of the API.  uxIndexToWaitOn must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.
+ *
  * @param xClearCountOnExit if xClearCountOnExit is pdFALSE then the task's
  * notification value is decremented when the function exits.  In this way the
  * notification value acts like a counting semaphore.  If xClearCountOnExit is
@@ -2188,30 +2524,40 @@ void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPri
  * \defgroup ulTaskNotifyTake ulTaskNotifyTake
  * \ingroup TaskNotifications
  */
-uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWaitOn, BaseType_t xClearCountOnExit, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#define ulTaskNotifyTake( xClearCountOnExit, xTicksToWait ) ulTaskGenericNotifyTake( ( tskDEFAULT_INDEX_TO_NOTIFY ), ( xClearCountOnExit ), ( xTicksToWait ) )
+#define ulTaskNotifyTakeIndexed( uxIndexToWaitOn, xClearCountOnExit, xTicksToWait ) ulTaskGenericNotifyTake( ( uxIndexToWaitOn ), ( xClearCountOnExit ), ( xTicksToWait ) )
 
 /**
  * task. h
  * <PRE>BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask );</pre>
+ * <PRE>BaseType_t xTaskNotifyStateClearIndexed( TaskHandle_t xTask, UBaseType_t uxIndexToClear );</pre>
  *
  * If the notification state of the task referenced by the handle xTask is
  * eNotified, then set the task's notification state to eNotWaitingNotification.
  * The task's notification value is not altered.  Set xTask to NULL to clear the
- * notification state of the calling task.
+ * notification state of the calling task.  The Indexed form clears the state
+ * of the notification at index uxIndexToClear, the other form clears the state
+ * of the notification at index tskDEFAULT_INDEX_TO_NOTIFY.
  *
  * @return pdTRUE if the task's notification state was set to
  * eNotWaitingNotification, otherwise pdFALSE.
  * \defgroup xTaskNotifyStateClear xTaskNotifyStateClear
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask );
+BaseType_t xTaskGenericNotifyStateClear( TaskHandle_t xTask, UBaseType_t uxIndexToClear ) PRIVILEGED_FUNCTION;
+#define xTaskNotifyStateClear( xTask ) xTaskGenericNotifyStateClear( ( xTask ), ( tskDEFAULT_INDEX_TO_NOTIFY ) )
+#define xTaskNotifyStateClearIndexed( xTask, uxIndexToClear ) xTaskGenericNotifyStateClear( ( xTask ), ( uxIndexToClear ) )
 
 /**
 * task. h
 * <PRE>uint32_t ulTaskNotifyValueClear( TaskHandle_t xTask, uint32_t ulBitsToClear );</pre>
+* <PRE>uint32_t ulTaskNotifyValueClearIndexed( TaskHandle_t xTask, UBaseType_t uxIndexToClear, uint32_t ulBitsToClear );</pre>
 *
 * Clears the bits specified by the ulBitsToClear bit mask in the notification
-* value of the task referenced by xTask.
+* value of the task referenced by xTask.  The Indexed form clears bits in the
+* notification value at index uxIndexToClear, the other form clears bits in the
+* notification value at index tskDEFAULT_INDEX_TO_NOTIFY.
 *
 * Set ulBitsToClear to 0xffffffff (UINT_MAX on 32-bit architectures) to clear
 * the notification value to 0.  Set ulBitsToClear to 0 to query the task's
@@ -2222,7 +2568,9 @@ BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask );
 * \defgroup ulTaskNotifyValueClear ulTaskNotifyValueClear
 * \ingroup TaskNotifications
 */
-uint32_t ulTaskNotifyValueClear( TaskHandle_t xTask, uint32_t ulBitsToClear ) PRIVILEGED_FUNCTION;
+uint32_t ulTaskGenericNotifyValueClear( TaskHandle_t xTask, UBaseType_t uxIndexToClear, uint32_t ulBitsToClear ) PRIVILEGED_FUNCTION;
+#define ulTaskNotifyValueClear( xTask, ulBitsToClear ) ulTaskGenericNotifyValueClear( ( xTask ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulBitsToClear ) )
+#define ulTaskNotifyValueClearIndexed( xTask, uxIndexToClear, ulBitsToClear ) ulTaskGenericNotifyValueClear( ( xTask ), ( uxIndexToClear ), ( ulBitsToClear ) )
 
 /**
  * task.h
@@ -2375,6 +2723,7 @@ BaseType_t xTaskIncrementTick( void ) PRIVILEGED_FUNCTION;
  */
 void vTaskPlaceOnEventList( List_t * const pxEventList, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xItemValue, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+void vTaskPlaceOnFIFOEventList( List_t * const pxEventList, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
@@ -2471,6 +2820,54 @@ BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder ) PRIVILEGE
  */
 void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder, UBaseType_t uxHighestPriorityWaitingTask ) PRIVILEGED_FUNCTION;
 
+/*
+ * The following four functions replace the three above when
+ * configUSE_PRECISE_PRIORITY_INHERITANCE is set to 1.  Each mutex then owns a
+ * list item that is held in a list of the mutexes held by the mutex holder,
+ * with the list item's value set to the priority of the highest priority task
+ * waiting for the mutex.  The priority of a task that holds mutexes is always
+ * the greater of its base priority and those values, and a change in the
+ * priority of a task that is itself blocked on a mutex is passed on to the
+ * holder of that mutex.
+ */
+
+/*
+ * Called when pxMutexHolder obtains the mutex that owns pxMutexItem.
+ * uxHighestPriorityWaitingTask is the priority of the highest priority task
+ * still waiting for the mutex, or tskIDLE_PRIORITY if there is none.
+ */
+void vTaskPriorityMutexTaken( TaskHandle_t const pxMutexHolder, ListItem_t * const pxMutexItem, UBaseType_t uxHighestPriorityWaitingTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called when the calling task is about to block on the mutex that owns
+ * pxMutexItem.  Raises the priority of the mutex holder, and of any task the
+ * mutex holder is in turn waiting for, to that of the calling task should it
+ * be lower.
+ */
+BaseType_t xTaskPriorityInheritFromMutex( ListItem_t * const pxMutexItem ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called when the calling task gives back the mutex that owns pxMutexItem.
+ * Returns pdTRUE if the priority of the calling task was lowered as a result.
+ */
+BaseType_t xTaskPriorityDisinheritFromMutex( ListItem_t * const pxMutexItem ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called when the calling task stops waiting for the mutex that owns
+ * pxMutexItem without obtaining it.  uxHighestPriorityWaitingTask is the
+ * priority of the highest priority task still waiting for the mutex.
+ */
+void vTaskPriorityMutexWaitEnded( ListItem_t * const pxMutexItem, UBaseType_t uxHighestPriorityWaitingTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * Raises the priority of the calling task to uxCeilingPriority when it takes a
+ * priority ceiling mutex, should its priority be lower.  The priority is
+ * restored by xTaskPriorityDisinherit() in the same way as an inherited
+ * priority.  Not used when configUSE_PRECISE_PRIORITY_INHERITANCE is 1, as the
+ * ceiling is then recorded in the mutex's list item instead.
+ */
+void vTaskPriorityRaiseToCeiling( UBaseType_t uxCeilingPriority ) PRIVILEGED_FUNCTION;
+
 /*
  * Get the uxTCBNumber assigned to the task referenced by the xTask parameter.
  */
@@ -2527,6 +2924,13 @@ eSleepModeStatus eTaskConfirmSleepModeStatus( void ) PRIVILEGED_FUNCTION;
  */
 TaskHandle_t pvTaskIncrementMutexHeldCount( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Increment the mutex held count of a task that took a
+ * fast mutex without the kernel's involvement, when the mutex is handed to the
+ * kernel because another task needs to block on it.
+ */
+void vTaskIncrementMutexHeldCount( TaskHandle_t xMutexHolder ) PRIVILEGED_FUNCTION;
+
 /*
  * For internal use only.  Same as vTaskSetTimeOutState(), but without a critial
  * section.
@@ -363,6 +363,92 @@ typedef void (*PendedFunction_t)( void *, uint32_t );
 										StaticTimer_t *pxTimerBuffer ) PRIVILEGED_FUNCTION;
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+/**
+ * TimerHandle_t xTimerCreateHard( const char * const pcTimerName,
+ * 								TickType_t xTimerPeriodInTicks,
+ * 								UBaseType_t uxAutoReload,
+ * 								void * pvTimerID,
+ * 								TimerCallbackFunction_t pxCallbackFunction );
+ *
+ * TimerHandle_t xTimerCreateHardStatic( const char * const pcTimerName,
+ * 									TickType_t xTimerPeriodInTicks,
+ * 									UBaseType_t uxAutoReload,
+ * 									void * pvTimerID,
+ * 									TimerCallbackFunction_t pxCallbackFunction,
+ *									StaticTimer_t *pxTimerBuffer );
+ *
+ * Creates a new hard software timer instance, and returns a handle by which
+ * the created software timer can be referenced.  configUSE_HARD_TIMERS must be
+ * set to 1 in FreeRTOSConfig.h for these functions to be available.  The
+ * parameters and return value are the same as those of xTimerCreate() and
+ * xTimerCreateStatic() respectively.
+ *
+ * A hard timer is used with the same API functions as any other timer, but is
+ * not processed by the timer service task.  Commands sent to a hard timer, such
+ * as xTimerStart(), xTimerStop(), xTimerReset(), xTimerChangePeriod() and
+ * their FromISR() equivalents, are performed immediately within a short
+ * critical section instead of being sent on the timer command queue, so never
+ * block and never fail because the queue is full.  The callback function of a
+ * hard timer is called directly from the tick interrupt on the tick at which
+ * the timer expires, so its timing does not depend on the priority of the
+ * timer service task or on the other timers that expire at the same time.  If
+ * configUSE_TIMER_WHEEL is set to 1 hard timers are held in a timer wheel of
+ * their own, so the time taken by these commands, and by the tick interrupt to
+ * reload an auto-reload hard timer, does not depend on the number of active
+ * hard timers.
+ *
+ * Because the callback function executes in the context of the tick interrupt
+ * it must be kept short and must only call interrupt safe API functions (those
+ * that end in "FromISR").  A context switch requested by an interrupt safe API
+ * function called from the callback is performed when the tick interrupt
+ * exits, so the pxHigherPriorityTaskWoken parameter of those functions can be
+ * set to NULL.  The callback function can stop, reset or change the period of
+ * its own timer using the FromISR() functions.  Like tasks, hard timers are not
+ * processed while the scheduler is suspended - any that expire while the
+ * scheduler is suspended are processed when the scheduler is resumed.
+ *
+ * Example usage:
+ * @verbatim
+ * // The control loop must run every tick, without being delayed by other
+ * // timers.
+ * void vControlLoopCallback( TimerHandle_t xTimer )
+ * {
+ *     vUpdateControlOutput();
+ *     vTaskNotifyGiveFromISR( xLoggingTask, NULL );
+ * }
+ *
+ * void main( void )
+ * {
+ * TimerHandle_t xControlTimer;
+ *
+ *     xControlTimer = xTimerCreateHard( "Control", 1, pdTRUE, NULL, vControlLoopCallback );
+ *     xTimerStart( xControlTimer, 0 );
+ *
+ *     // ...
+ *     // Create tasks here.
+ *     // ...
+ *
+ *     vTaskStartScheduler();
+ * }
+ * @endverbatim
+ */
+#if( ( configUSE_HARD_TIMERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+	TimerHandle_t xTimerCreateHard(	const char * const pcTimerName,			/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+									const TickType_t xTimerPeriodInTicks,
+									const UBaseType_t uxAutoReload,
+									void * const pvTimerID,
+									TimerCallbackFunction_t pxCallbackFunction ) PRIVILEGED_FUNCTION;
+#endif
+
+#if( ( configUSE_HARD_TIMERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+	TimerHandle_t xTimerCreateHardStatic(	const char * const pcTimerName,			/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+											const TickType_t xTimerPeriodInTicks,
+											const UBaseType_t uxAutoReload,
+											void * const pvTimerID,
+											TimerCallbackFunction_t pxCallbackFunction,
+											StaticTimer_t *pxTimerBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * void *pvTimerGetTimerID( TimerHandle_t xTimer );
  *
@@ -1295,6 +1381,22 @@ TickType_t xTimerGetExpiryTime( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
 BaseType_t xTimerCreateTimerTask( void ) PRIVILEGED_FUNCTION;
 BaseType_t xTimerGenericCommand( TimerHandle_t xTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue, BaseType_t * const pxHigherPriorityTaskWoken, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
+#if( configUSE_HARD_TIMERS == 1 )
+	/*
+	 * Called from xTaskIncrementTick() each time the tick count is incremented
+	 * to call the callback functions of the hard timers that expire at
+	 * xTimeNow.
+	 */
+	void vTimerProcessHardTimers( const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the number of ticks from xTimeNow until the next hard timer
+	 * expires, or portMAX_DELAY if no hard timers are active.  Used to limit
+	 * the time for which the tick interrupt is suppressed in tickless idle mode.
+	 */
+	TickType_t xTimerGetTicksToNextHardTimer( const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+#endif
+
 #if( configUSE_TRACE_FACILITY == 1 )
 	void vTimerSetTimerNumber( TimerHandle_t xTimer, UBaseType_t uxTimerNumber ) PRIVILEGED_FUNCTION;
 	UBaseType_t uxTimerGetTimerNumber( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
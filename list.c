@@ -167,6 +167,43 @@ const TickType_t xValueOfInsertion = pxNewListItem->xItemValue;
 }
 /*-----------------------------------------------------------*/
 
+void vListInsertWrapped( List_t * const pxList, ListItem_t * const pxNewListItem )
+{
+ListItem_t *pxIterator;
+const TickType_t xValueOfInsertion = pxNewListItem->xItemValue;
+
+	listTEST_LIST_INTEGRITY( pxList );
+	listTEST_LIST_ITEM_INTEGRITY( pxNewListItem );
+
+	/* Insert the new list item into the list, sorted in xItemValue order where
+	the item values are times that can wrap.  An item value is taken to come
+	before the new item value if it is less than half the range of TickType_t
+	before it, so the order stays correct when the tick count overflows.  As
+	with vListInsert() the new list item is placed after any list items that
+	have the same item value.  The list end is checked explicitly as its item
+	value cannot be used as a back marker. */
+	for( pxIterator = ( ListItem_t * ) &( pxList->xListEnd ); /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+		 ( pxIterator->pxNext != ( const ListItem_t * ) &( pxList->xListEnd ) ) && /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+		 ( ( TickType_t ) ( xValueOfInsertion - pxIterator->pxNext->xItemValue ) <= ( portMAX_DELAY >> 1 ) );
+		 pxIterator = pxIterator->pxNext )
+	{
+		/* There is nothing to do here, just iterating to the wanted
+		insertion position. */
+	}
+
+	pxNewListItem->pxNext = pxIterator->pxNext;
+	pxNewListItem->pxNext->pxPrevious = pxNewListItem;
+	pxNewListItem->pxPrevious = pxIterator;
+	pxIterator->pxNext = pxNewListItem;
+
+	/* Remember which list the item is in.  This allows fast removal of the
+	item later. */
+	pxNewListItem->pxContainer = pxList;
+
+	( pxList->uxNumberOfItems )++;
+}
+/*-----------------------------------------------------------*/
+
 UBaseType_t uxListRemove( ListItem_t * const pxItemToRemove )
 {
 /* The list item knows which list it is in.  Obtain the list from the list
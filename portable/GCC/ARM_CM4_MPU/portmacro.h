@@ -186,6 +186,10 @@ not necessary for to use this port.  They are defined so the common demo files
 
 #endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
 
+/* Count the leading zero bits in a 32-bit value.  Used by the kernel when
+configUSE_PORT_OPTIMISED_TASK_SELECTION is set to 2. */
+#define portCOUNT_LEADING_ZEROS( ulBitmap ) ( ( uint32_t ) __builtin_clz( ( ulBitmap ) ) )
+
 /*-----------------------------------------------------------*/
 
 #ifdef configASSERT
@@ -157,6 +157,10 @@ typedef struct MPU_SETTINGS
 	#define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities ) uxTopPriority = ( 31UL - ( ( uint32_t ) __CLZ( ( uxReadyPriorities ) ) ) )
 
 #endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+/* Count the leading zero bits in a 32-bit value.  Used by the kernel when
+configUSE_PORT_OPTIMISED_TASK_SELECTION is set to 2. */
+#define portCOUNT_LEADING_ZEROS( ulBitmap ) ( ( uint32_t ) __CLZ( ( ulBitmap ) ) )
 /*-----------------------------------------------------------*/
 
 /* Critical section management. */
@@ -41,6 +41,10 @@ task.h is included from an application file. */
 	#include "croutine.h"
 #endif
 
+#if ( configUSE_FAST_SEMAPHORES == 1 )
+	#include "atomic.h"
+#endif
+
 /* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
 because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
 for the header files above, but not in this file, in order to generate the
@@ -51,6 +55,7 @@ correct privileged Vs unprivileged linkage and placement. */
 /* Constants used with the cRxLock and cTxLock structure members. */
 #define queueUNLOCKED					( ( int8_t ) -1 )
 #define queueLOCKED_UNMODIFIED			( ( int8_t ) 0 )
+#define queueMAX_LOCK_COUNT				( ( int8_t ) 127 )
 
 /* When the Queue_t structure is used to represent a base queue its pcHead and
 pcTail members are used as pointers into the queue storage area.  When the
@@ -74,8 +79,33 @@ typedef struct SemaphoreData
 {
 	TaskHandle_t xMutexHolder;		 /*< The handle of the task that holds the mutex. */
 	UBaseType_t uxRecursiveCallCount;/*< Maintains a count of the number of times a recursive mutex has been recursively 'taken' when the structure is used as a mutex. */
+	#if( configUSE_CEILING_MUTEXES == 1 )
+		UBaseType_t uxCeilingPriority;	/*< The priority a task is raised to as soon as it takes the mutex, or tskIDLE_PRIORITY if the mutex uses priority inheritance instead. */
+	#endif
 } SemaphoreData_t;
 
+#if( configUSE_QUEUE_WAIT_POLICY == 1 )
+	#define queuePLACE_ON_EVENT_LIST( pxQueue, pxEventList, xTicksToWait )	\
+	{																		\
+		if( ( pxQueue )->ucWaitPolicy == queueWAIT_POLICY_FIFO )			\
+		{																	\
+			vTaskPlaceOnFIFOEventList( ( pxEventList ), ( xTicksToWait ) );	\
+		}																	\
+		else																\
+		{																	\
+			vTaskPlaceOnEventList( ( pxEventList ), ( xTicksToWait ) );		\
+		}																	\
+	}
+#else
+	#define queuePLACE_ON_EVENT_LIST( pxQueue, pxEventList, xTicksToWait ) vTaskPlaceOnEventList( ( pxEventList ), ( xTicksToWait ) )
+#endif
+
+#if( configUSE_CEILING_MUTEXES == 1 )
+	#define queueIS_CEILING_MUTEX( pxQueue ) ( ( ( pxQueue )->uxQueueType == queueQUEUE_IS_MUTEX ) && ( ( pxQueue )->u.xSemaphore.uxCeilingPriority != tskIDLE_PRIORITY ) )
+#else
+	#define queueIS_CEILING_MUTEX( pxQueue ) ( pdFALSE )
+#endif
+
 /* Semaphores do not actually store or copy data, so have an item size of
 zero. */
 #define queueSEMAPHORE_QUEUE_ITEM_LENGTH ( ( UBaseType_t ) 0 )
@@ -128,6 +158,19 @@ typedef struct QueueDefinition 		/* The old naming convention is used to prevent
 		uint8_t ucQueueType;
 	#endif
 
+	#if ( configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD > 0 )
+		volatile UBaseType_t uxWritesBusy;	/*< The number of slots past the last visible item that have been claimed by a task still copying an item in, including items sent by interrupts meanwhile.  Zero when no task is copying. */
+		volatile UBaseType_t uxReadsBusy;	/*< The number of slots before the first visible item that have been claimed by a task still copying an item out, including items received by interrupts meanwhile.  Zero when no task is copying. */
+	#endif
+
+	#if ( configUSE_QUEUE_WAIT_POLICY == 1 )
+		uint8_t ucWaitPolicy;			/*< Either queueWAIT_POLICY_PRIORITY or queueWAIT_POLICY_FIFO - the order in which blocked tasks are woken. */
+	#endif
+
+	#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+		ListItem_t xMutexHeldListItem;	/*< When the structure is used as a mutex, references the mutex from the list of mutexes held by the mutex holder.  Its value is the priority of the highest priority task waiting for the mutex. */
+	#endif
+
 } xQUEUE;
 
 /* The old xQUEUE name is maintained above then typedefed to the new Queue_t
@@ -136,6 +179,172 @@ typedef xQUEUE Queue_t;
 
 /*-----------------------------------------------------------*/
 
+#if ( configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD > 0 )
+
+	/* Tasks copy items of at least configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD
+	bytes into and out of the queue storage area with interrupts enabled.  The
+	slot is claimed inside a critical section, the scheduler is suspended so no
+	other task can access the queue, and the item is copied and then published
+	inside a second critical section.  Queues of length one are excluded as
+	queueOVERWRITE could otherwise overwrite a slot being copied.  Interrupts
+	can still use the queue while a task is copying, but cannot use the claimed
+	slots, cannot send to the front of the queue while the front slot is being
+	read, and have their own sends and receives published by the task so items
+	remain in order. */
+	#define queueCOPY_OUTSIDE_CRITICAL( pxQueue )	( ( ( pxQueue )->uxItemSize >= ( UBaseType_t ) configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD ) && ( ( pxQueue )->uxLength > ( UBaseType_t ) 1 ) )
+	#define queueSLOTS_IN_USE( pxQueue )			( ( pxQueue )->uxMessagesWaiting + ( pxQueue )->uxWritesBusy + ( pxQueue )->uxReadsBusy )
+	#define queueCAN_SEND_TO_FRONT( pxQueue )		( ( pxQueue )->uxReadsBusy == ( UBaseType_t ) 0 )
+
+#else
+
+	#define queueCOPY_OUTSIDE_CRITICAL( pxQueue )	( pdFALSE )
+	#define queueSLOTS_IN_USE( pxQueue )			( ( pxQueue )->uxMessagesWaiting )
+	#define queueCAN_SEND_TO_FRONT( pxQueue )		( pdTRUE )
+
+#endif /* configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD */
+
+#if ( configUSE_QUEUE_SETS == 1 )
+	#define queueIS_IN_QUEUE_SET( pxQueue )			( ( pxQueue )->pxQueueSetContainer != NULL )
+#else
+	#define queueIS_IN_QUEUE_SET( pxQueue )			( pdFALSE )
+#endif
+
+/* xQueueGenericSend() and xQueueReceive() take a fast path when the call
+cannot block and there is no waiting task to unblock.  The item is copied
+inside a single critical section and the function returns without setting up
+a timeout or locking the queue.  Semaphores and mutexes (item size zero),
+queue set members, sends other than to the back of the queue and items that are
+copied outside of a critical section take the normal path. */
+#define queueCAN_SEND_FAST( pxQueue, xCopyPosition )								\
+	( ( ( xCopyPosition ) == queueSEND_TO_BACK ) &&									\
+	  ( ( pxQueue )->uxItemSize != ( UBaseType_t ) 0 ) &&							\
+	  ( queueSLOTS_IN_USE( pxQueue ) < ( pxQueue )->uxLength ) &&					\
+	  ( listLIST_IS_EMPTY( &( ( pxQueue )->xTasksWaitingToReceive ) ) != pdFALSE ) &&	\
+	  ( queueIS_IN_QUEUE_SET( pxQueue ) == pdFALSE ) &&								\
+	  ( queueCOPY_OUTSIDE_CRITICAL( pxQueue ) == pdFALSE ) )
+
+#define queueCAN_RECEIVE_FAST( pxQueue )											\
+	( ( ( pxQueue )->uxItemSize != ( UBaseType_t ) 0 ) &&							\
+	  ( ( pxQueue )->uxMessagesWaiting > ( UBaseType_t ) 0 ) &&						\
+	  ( listLIST_IS_EMPTY( &( ( pxQueue )->xTasksWaitingToSend ) ) != pdFALSE ) &&	\
+	  ( queueCOPY_OUTSIDE_CRITICAL( pxQueue ) == pdFALSE ) )
+
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_FAST_SEMAPHORES == 1 )
+
+	/* When a fast mutex is held by a task that has blocked waiters, pvHolder is
+	set to the address of the fast semaphore itself, which can never be a task
+	handle.  When a fast counting semaphore has blocked waiters the top bit of
+	ulCount is set. */
+	#define queueFAST_MUTEX_CONTENDED( pxFastSemaphore )	( ( void * ) ( pxFastSemaphore ) )
+	#define queueFAST_COUNT_CONTENDED_BIT					( ( uint32_t ) 0x80000000UL )
+
+	/*
+	 * A fast semaphore is a mutex or counting semaphore that is taken and given
+	 * with a single atomic compare and swap while no task is blocked on it.
+	 * Only when a task must block is the state handed to the embedded Queue_t,
+	 * at which point the kernel's normal blocking and priority inheritance
+	 * apply until the last waiter has left.
+	 *
+	 * Uncontended, pvHolder (mutex) or ulCount (counting semaphore) is the
+	 * whole state and xQueue is unused.  Contended, xQueue holds the state in
+	 * the way a normal mutex or counting semaphore would, and pvHolder or
+	 * ulCount is marked as contended so the atomic fast paths fail.  The
+	 * transitions between the two are made inside critical sections.
+	 */
+	typedef struct FastSemaphoreDefinition
+	{
+		Queue_t xQueue;				/*< The kernel mutex or semaphore used while tasks are blocked.  Must be the first member so the handle can be deleted with vQueueDelete(). */
+		void * volatile pvHolder;	/*< Mutex only.  NULL when the mutex is available, otherwise the holder, or queueFAST_MUTEX_CONTENDED() when xQueue tracks the holder. */
+		volatile uint32_t ulCount;	/*< Counting semaphore only.  The count, or queueFAST_COUNT_CONTENDED_BIT when xQueue holds the count. */
+		UBaseType_t uxWaiters;		/*< The number of tasks inside the blocking path of xQueueFastSemaphoreTake(). */
+	} FastSemaphore_t;
+
+#endif /* configUSE_FAST_SEMAPHORES */
+
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+	/*
+	 * A queue with exactly one producer and one consumer, for example an ISR
+	 * streaming samples to a task.  The producer only ever writes uxHead and
+	 * the consumer only ever writes uxTail, so items are passed using ordered
+	 * loads and stores rather than critical sections.  The indexes run from 0
+	 * to ( 2 * uxLength ) - 1 so a full queue can be told apart from an empty
+	 * one without wasting a slot.  A consumer that has to wait records its
+	 * handle in xTaskWaitingToReceive and is unblocked with a direct to task
+	 * notification, so interrupts are only masked when a task is actually
+	 * waiting.
+	 */
+	typedef struct SPSCQueueDefinition
+	{
+		int8_t *pcStorage;							/*< Points to the beginning of the queue storage area. */
+		UBaseType_t uxLength;						/*< The number of items the queue can hold. */
+		UBaseType_t uxItemSize;						/*< The size of each item. */
+		volatile UBaseType_t uxHead;				/*< The next index to write.  Only written by the producer. */
+		volatile UBaseType_t uxTail;				/*< The next index to read.  Only written by the consumer. */
+		TaskHandle_t volatile xTaskWaitingToReceive;/*< The consumer, while it is blocked waiting for an item, otherwise NULL. */
+
+		#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+			uint8_t ucStaticallyAllocated;			/*< Set to pdTRUE if the memory used by the queue was statically allocated to ensure no attempt is made to free the memory. */
+		#endif
+	} SPSCQueue_t;
+
+#endif /* configUSE_SPSC_QUEUES */
+
+#if ( configUSE_ZERO_COPY_QUEUES == 1 )
+
+	/*
+	 * A zero copy queue owns a pool of uxLength buffers.  A sender acquires a
+	 * free buffer, fills it in place, then commits it, which posts a pointer to
+	 * the buffer to the embedded Queue_t.  A receiver obtains the pointer,
+	 * uses the buffer in place, then releases it back to the pool.  Only the
+	 * pointer is ever copied.
+	 *
+	 * Free buffers are kept on a singly linked list, the link being stored in
+	 * the first bytes of each free buffer.  As there are exactly as many
+	 * buffers as queue slots, a committed buffer always finds space in the
+	 * queue, so xQueue.xTasksWaitingToSend is used to hold tasks waiting for a
+	 * buffer to be released and xQueue.xTasksWaitingToReceive holds tasks
+	 * waiting for a buffer to be committed.
+	 */
+	typedef struct ZeroCopyQueueDefinition
+	{
+		Queue_t xQueue;				/*< The queue of pointers to committed buffers.  Must be the first member so the structure and storage can be freed by vQueueDelete(). */
+		void *pvFreeBuffers;		/*< The first buffer on the free list, or NULL if every buffer has been acquired. */
+		uint8_t *pucPool;			/*< The start of the buffer pool. */
+		UBaseType_t uxBufferSize;	/*< The size of each buffer in the pool, see queueZERO_COPY_BUFFER_SIZE(). */
+	} ZeroCopyQueue_t;
+
+#endif /* configUSE_ZERO_COPY_QUEUES */
+
+#if ( configUSE_RW_LOCKS == 1 )
+
+	/*
+	 * A reader writer lock can be held by one writer or by up to uxMaxReaders
+	 * readers at a time.  The holding tasks are recorded so they can inherit
+	 * the priority of any task that blocks on the lock.  When the lock is
+	 * released it is handed directly to the tasks that can now hold it, a
+	 * waiting writer taking precedence over waiting readers.
+	 */
+	typedef struct RWLockDefinition
+	{
+		List_t xTasksWaitingToRead;		/*< List of tasks that are blocked waiting to read.  Stored in priority order. */
+		List_t xTasksWaitingToWrite;	/*< List of tasks that are blocked waiting to write.  Stored in priority order. */
+		TaskHandle_t xWriter;			/*< The task holding the lock for writing, or NULL. */
+		TaskHandle_t *pxReaders;		/*< The tasks holding the lock for reading.  The first uxReaders entries are valid. */
+		UBaseType_t uxReaders;			/*< The number of tasks holding the lock for reading. */
+		UBaseType_t uxMaxReaders;		/*< The number of entries in pxReaders. */
+
+		#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+			uint8_t ucStaticallyAllocated;	/*< Set to pdTRUE if the memory used by the lock was statically allocated to ensure no attempt is made to free the memory. */
+		#endif
+	} RWLock_t;
+
+#endif /* configUSE_RW_LOCKS */
+
+/*-----------------------------------------------------------*/
+
 /*
  * The queue registry is just a means for kernel aware debuggers to locate
  * queue structures.  It has no other purpose so is an optional component.
@@ -174,14 +383,14 @@ typedef xQUEUE Queue_t;
 static void prvUnlockQueue( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 
 /*
- * Uses a critical section to determine if there is any data in a queue.
+ * Determines if there is any data in a queue.
  *
  * @return pdTRUE if the queue contains no items, otherwise pdFALSE.
  */
 static BaseType_t prvIsQueueEmpty( const Queue_t *pxQueue ) PRIVILEGED_FUNCTION;
 
 /*
- * Uses a critical section to determine if there is any space in a queue.
+ * Determines if there is any space in a queue.
  *
  * @return pdTRUE if there is no space, otherwise pdFALSE;
  */
@@ -198,6 +407,29 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvIte
  */
 static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/*
+ * Copies uxItemCount items to the back of the queue, or out of the front of
+ * the queue, using at most two memcpy() calls - one for the run up to the end
+ * of the storage area and one for the run that wraps to the start.  The caller
+ * must ensure there is sufficient space or data.
+ */
+static void prvCopyMultipleToQueue( Queue_t * const pxQueue, const void *pvItemsToQueue, const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+static void prvCopyMultipleFromQueue( Queue_t * const pxQueue, void * const pvBuffer, const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called after uxItemCount items have been added to a queue outside of a
+ * locked region.  Notifies the queue set the queue belongs to, if any, or
+ * unblocks up to uxItemCount tasks waiting to receive.  Returns pdTRUE if a
+ * task with a priority higher than the calling task was unblocked.
+ */
+static BaseType_t prvQueueMultipleItemsAdded( Queue_t * const pxQueue, const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks up to uxMaxToUnblock tasks from pxEventList.  Returns pdTRUE if a
+ * task with a priority higher than the calling task was unblocked.
+ */
+static BaseType_t prvUnblockMultipleWaiters( List_t * const pxEventList, const UBaseType_t uxMaxToUnblock ) PRIVILEGED_FUNCTION;
+
 #if ( configUSE_QUEUE_SETS == 1 )
 	/*
 	 * Checks to see if a queue is a member of a queue set, and if so, notifies
@@ -231,6 +463,118 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 	 */
 	static UBaseType_t prvGetDisinheritPriorityAfterTimeout( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 #endif
+
+#if( configUSE_FAST_SEMAPHORES == 1 )
+	/*
+	 * Called after a FastSemaphore_t structure has been allocated either
+	 * statically or dynamically to fill in the structure's members.
+	 */
+	static void prvInitialiseNewFastSemaphore( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, const uint8_t ucQueueType, FastSemaphore_t *pxNewFastSemaphore ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Must be called from within a critical section.  If no task is left in
+	 * the blocking path of the fast semaphore, and (for a mutex) no task holds
+	 * the embedded kernel mutex, move the state back out of the embedded queue
+	 * so the atomic fast paths can be used again.
+	 */
+	static void prvFastSemaphoreLeaveContended( FastSemaphore_t * const pxFastSemaphore ) PRIVILEGED_FUNCTION;
+#endif
+
+#if( configUSE_SPSC_QUEUES == 1 )
+	/*
+	 * Called after an SPSCQueue_t structure has been allocated either
+	 * statically or dynamically to fill in the structure's members.
+	 */
+	static void prvInitialiseNewSPSCQueue( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, SPSCQueue_t *pxNewQueue ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns the number of items in an SPSC queue given its head and tail
+	 * indexes.
+	 */
+	static UBaseType_t prvSPSCItemsWaiting( const SPSCQueue_t * const pxQueue, const UBaseType_t uxHead, const UBaseType_t uxTail ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Copies an item into an SPSC queue and publishes it to the consumer.
+	 * Returns pdFALSE if the queue was full.  Must only be called by the
+	 * producer.
+	 */
+	static BaseType_t prvSPSCWrite( SPSCQueue_t * const pxQueue, const void * const pvItemToQueue ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Copies an item out of an SPSC queue and releases its slot to the
+	 * producer.  Returns pdFALSE if the queue was empty.  Must only be called by
+	 * the consumer.
+	 */
+	static BaseType_t prvSPSCRead( SPSCQueue_t * const pxQueue, void * const pvBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+#if( configUSE_ZERO_COPY_QUEUES == 1 )
+	/*
+	 * Called after a ZeroCopyQueue_t structure has been allocated either
+	 * statically or dynamically to fill in the structure's members and build
+	 * the free buffer list.
+	 */
+	static void prvInitialiseNewZeroCopyQueue( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, uint8_t *pucPoolStorage, ZeroCopyQueue_t *pxNewQueue ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Removes a buffer from the free list, returning NULL if the list is empty.
+	 * Must be called from within a critical section.
+	 */
+	static void *prvZeroCopyPopFreeBuffer( ZeroCopyQueue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns a buffer to the free list.  Must be called from within a critical
+	 * section.
+	 */
+	static void prvZeroCopyPushFreeBuffer( ZeroCopyQueue_t * const pxQueue, void *pvBuffer ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Uses a critical section to determine if every buffer in the pool has been
+	 * acquired.
+	 */
+	static BaseType_t prvIsZeroCopyPoolEmpty( ZeroCopyQueue_t *pxQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+#if( configUSE_RW_LOCKS == 1 )
+	/*
+	 * Called after a RWLock_t structure has been allocated either statically
+	 * or dynamically to fill in the structure's members.
+	 */
+	static void prvInitialiseNewRWLock( const UBaseType_t uxMaxReaders, TaskHandle_t *pxReaderStorage, RWLock_t *pxNewRWLock ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns pdTRUE if the lock can be taken for writing (xExclusive is
+	 * pdTRUE) or for reading (xExclusive is pdFALSE) without blocking.  Must
+	 * be called with the scheduler suspended or from a critical section.
+	 */
+	static BaseType_t prvRWLockIsAvailable( const RWLock_t * const pxRWLock, const BaseType_t xExclusive ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns pdTRUE if xTask holds the lock for writing (xExclusive is pdTRUE)
+	 * or for reading (xExclusive is pdFALSE).
+	 */
+	static BaseType_t prvRWLockIsHeldBy( const RWLock_t * const pxRWLock, const BaseType_t xExclusive, const TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Raises the priority of every task holding the lock to that of the
+	 * calling task, returning pdTRUE if any holder has inherited a priority.
+	 * Must be called from a critical section.
+	 */
+	static BaseType_t prvRWLockInherit( const RWLock_t * const pxRWLock ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Lowers the priority of every task holding the lock after the task they
+	 * inherited from has timed out.  Must be called from a critical section.
+	 */
+	static void prvRWLockDisinheritAfterTimeout( const RWLock_t * const pxRWLock ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Gives the lock to the waiting tasks that can now hold it, returning
+	 * pdTRUE if a task of higher priority than the calling task was unblocked.
+	 * Must be called from a critical section.
+	 */
+	static BaseType_t prvRWLockHandOver( RWLock_t * const pxRWLock ) PRIVILEGED_FUNCTION;
+#endif
 /*-----------------------------------------------------------*/
 
 /*
@@ -267,6 +611,13 @@ Queue_t * const pxQueue = xQueue;
 		pxQueue->cRxLock = queueUNLOCKED;
 		pxQueue->cTxLock = queueUNLOCKED;
 
+		#if ( configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD > 0 )
+		{
+			pxQueue->uxWritesBusy = ( UBaseType_t ) 0U;
+			pxQueue->uxReadsBusy = ( UBaseType_t ) 0U;
+		}
+		#endif
+
 		if( xNewQueue == pdFALSE )
 		{
 			/* If there are tasks blocked waiting to read from the queue, then
@@ -457,6 +808,12 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 	}
 	#endif /* configUSE_QUEUE_SETS */
 
+	#if( configUSE_QUEUE_WAIT_POLICY == 1 )
+	{
+		pxNewQueue->ucWaitPolicy = queueWAIT_POLICY_PRIORITY;
+	}
+	#endif /* configUSE_QUEUE_WAIT_POLICY */
+
 	traceQUEUE_CREATE( pxNewQueue );
 }
 /*-----------------------------------------------------------*/
@@ -477,6 +834,20 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 			/* In case this is a recursive mutex. */
 			pxNewQueue->u.xSemaphore.uxRecursiveCallCount = 0;
 
+			#if( configUSE_CEILING_MUTEXES == 1 )
+			{
+				/* Set by the ceiling mutex create functions after this
+				function returns. */
+				pxNewQueue->u.xSemaphore.uxCeilingPriority = tskIDLE_PRIORITY;
+			}
+			#endif
+
+			#if( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+			{
+				vListInitialiseItem( &( pxNewQueue->xMutexHeldListItem ) );
+			}
+			#endif
+
 			traceCREATE_MUTEX( pxNewQueue );
 
 			/* Start with the semaphore in the expected state. */
@@ -527,6 +898,62 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if( ( configUSE_CEILING_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateCeilingMutex( const UBaseType_t uxCeilingPriority )
+	{
+	QueueHandle_t xNewQueue;
+	const UBaseType_t uxMutexLength = ( UBaseType_t ) 1, uxMutexSize = ( UBaseType_t ) 0;
+
+		configASSERT( uxCeilingPriority > tskIDLE_PRIORITY );
+		configASSERT( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+		xNewQueue = xQueueGenericCreate( uxMutexLength, uxMutexSize, queueQUEUE_TYPE_MUTEX );
+		prvInitialiseMutex( ( Queue_t * ) xNewQueue );
+
+		if( xNewQueue != NULL )
+		{
+			( ( Queue_t * ) xNewQueue )->u.xSemaphore.uxCeilingPriority = uxCeilingPriority;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xNewQueue;
+	}
+
+#endif /* configUSE_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_CEILING_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateCeilingMutexStatic( const UBaseType_t uxCeilingPriority, StaticQueue_t *pxStaticQueue )
+	{
+	QueueHandle_t xNewQueue;
+	const UBaseType_t uxMutexLength = ( UBaseType_t ) 1, uxMutexSize = ( UBaseType_t ) 0;
+
+		configASSERT( uxCeilingPriority > tskIDLE_PRIORITY );
+		configASSERT( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+		xNewQueue = xQueueGenericCreateStatic( uxMutexLength, uxMutexSize, NULL, pxStaticQueue, queueQUEUE_TYPE_MUTEX );
+		prvInitialiseMutex( ( Queue_t * ) xNewQueue );
+
+		if( xNewQueue != NULL )
+		{
+			( ( Queue_t * ) xNewQueue )->u.xSemaphore.uxCeilingPriority = uxCeilingPriority;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xNewQueue;
+	}
+
+#endif /* configUSE_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) )
 
 	TaskHandle_t xQueueGetMutexHolder( QueueHandle_t xSemaphore )
@@ -737,18 +1164,148 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 #endif /* ( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
+#if( configUSE_FAST_SEMAPHORES == 1 )
+
+	static void prvInitialiseNewFastSemaphore( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, const uint8_t ucQueueType, FastSemaphore_t *pxNewFastSemaphore )
+	{
+		prvInitialiseNewQueue( uxMaxCount, queueSEMAPHORE_QUEUE_ITEM_LENGTH, NULL, ucQueueType, &( pxNewFastSemaphore->xQueue ) );
+
+		pxNewFastSemaphore->pvHolder = NULL;
+		pxNewFastSemaphore->ulCount = 0UL;
+		pxNewFastSemaphore->uxWaiters = ( UBaseType_t ) 0U;
+
+		#if( configUSE_MUTEXES == 1 )
+		{
+			if( ucQueueType == queueQUEUE_TYPE_MUTEX )
+			{
+				/* The embedded queue is configured as a normal, available,
+				mutex.  It is only used once the fast mutex becomes
+				contended. */
+				prvInitialiseMutex( &( pxNewFastSemaphore->xQueue ) );
+			}
+			else
+			{
+				pxNewFastSemaphore->ulCount = ( uint32_t ) uxInitialCount;
+				traceCREATE_COUNTING_SEMAPHORE();
+			}
+		}
+		#else
+		{
+			/* Only counting semaphores can be created without mutex support. */
+			configASSERT( ucQueueType == queueQUEUE_TYPE_COUNTING_SEMAPHORE );
+			pxNewFastSemaphore->ulCount = ( uint32_t ) uxInitialCount;
+			traceCREATE_COUNTING_SEMAPHORE();
+		}
+		#endif /* configUSE_MUTEXES */
+	}
+
+#endif /* configUSE_FAST_SEMAPHORES */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_FAST_SEMAPHORES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	FastSemaphoreHandle_t xQueueCreateFastSemaphoreStatic( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, const uint8_t ucQueueType, StaticFastSemaphore_t *pxStaticFastSemaphore )
+	{
+	FastSemaphore_t *pxNewFastSemaphore;
+
+		configASSERT( uxMaxCount != 0 );
+		configASSERT( uxInitialCount <= uxMaxCount );
+		configASSERT( ( uint32_t ) uxMaxCount < queueFAST_COUNT_CONTENDED_BIT );
+		configASSERT( !( ( ucQueueType == queueQUEUE_TYPE_MUTEX ) && ( uxMaxCount != ( UBaseType_t ) 1 ) ) );
+		configASSERT( pxStaticFastSemaphore != NULL );
+
+		#if( configASSERT_DEFINED == 1 )
+		{
+			/* Sanity check that the size of the structure used to declare a
+			variable of type StaticFastSemaphore_t equals the size of the real
+			fast semaphore structure. */
+			volatile size_t xSize = sizeof( StaticFastSemaphore_t );
+			configASSERT( xSize == sizeof( FastSemaphore_t ) );
+			( void ) xSize; /* Keeps lint quiet when configASSERT() is not defined. */
+		}
+		#endif /* configASSERT_DEFINED */
+
+		pxNewFastSemaphore = ( FastSemaphore_t * ) pxStaticFastSemaphore; /*lint !e740 !e9087 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
+		if( pxNewFastSemaphore != NULL )
+		{
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+			{
+				/* Note this fast semaphore was allocated statically in case it
+				is later deleted. */
+				pxNewFastSemaphore->xQueue.ucStaticallyAllocated = pdTRUE;
+			}
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+			prvInitialiseNewFastSemaphore( uxMaxCount, uxInitialCount, ucQueueType, pxNewFastSemaphore );
+		}
+		else
+		{
+			traceQUEUE_CREATE_FAILED( ucQueueType );
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pxNewFastSemaphore;
+	}
+
+#endif /* ( ( configUSE_FAST_SEMAPHORES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_FAST_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	FastSemaphoreHandle_t xQueueCreateFastSemaphore( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, const uint8_t ucQueueType )
+	{
+	FastSemaphore_t *pxNewFastSemaphore;
+
+		configASSERT( uxMaxCount != 0 );
+		configASSERT( uxInitialCount <= uxMaxCount );
+		configASSERT( ( uint32_t ) uxMaxCount < queueFAST_COUNT_CONTENDED_BIT );
+		configASSERT( !( ( ucQueueType == queueQUEUE_TYPE_MUTEX ) && ( uxMaxCount != ( UBaseType_t ) 1 ) ) );
+
+		/* Semaphores have no storage area, so only the structure itself is
+		allocated.  See the comments in xQueueGenericCreate() regarding the
+		alignment of the returned memory. */
+		pxNewFastSemaphore = ( FastSemaphore_t * ) pvPortMalloc( sizeof( FastSemaphore_t ) ); /*lint !e9087 !e9079 see comment above. */
+
+		if( pxNewFastSemaphore != NULL )
+		{
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				/* Note this fast semaphore was created dynamically in case it
+				is later deleted. */
+				pxNewFastSemaphore->xQueue.ucStaticallyAllocated = pdFALSE;
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+			prvInitialiseNewFastSemaphore( uxMaxCount, uxInitialCount, ucQueueType, pxNewFastSemaphore );
+		}
+		else
+		{
+			traceQUEUE_CREATE_FAILED( ucQueueType );
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pxNewFastSemaphore;
+	}
+
+#endif /* ( ( configUSE_FAST_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
 BaseType_t xQueueGenericSend( QueueHandle_t xQueue, const void * const pvItemToQueue, TickType_t xTicksToWait, const BaseType_t xCopyPosition )
 {
 BaseType_t xEntryTimeSet = pdFALSE, xYieldRequired;
 TimeOut_t xTimeOut;
 Queue_t * const pxQueue = xQueue;
+#if ( configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD > 0 )
+	int8_t *pcSlot;
+#endif
 
 	configASSERT( pxQueue );
 	configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
 	configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
 	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 	{
-		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		configASSERT( !( ( xTicksToWait != 0 ) && ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) ) );
 	}
 	#endif
 
@@ -756,22 +1313,99 @@ Queue_t * const pxQueue = xQueue;
 	/*lint -save -e904 This function relaxes the coding standard somewhat to
 	allow return statements within the function itself.  This is done in the
 	interest of execution time efficiency. */
-	for( ;; )
+
+	/* Fast path, see queueCAN_SEND_FAST().  The test is made first without a
+	critical section, so a call that is going to block does not pay for an
+	extra one, then again inside the critical section as an interrupt may
+	have changed the queue in between. */
+	if( queueCAN_SEND_FAST( pxQueue, xCopyPosition ) != pdFALSE )
 	{
 		taskENTER_CRITICAL();
 		{
-			/* Is there room on the queue now?  The running task must be the
-			highest priority task wanting to access the queue.  If the head item
-			in the queue is to be overwritten then it does not matter if the
-			queue is full. */
-			if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+			if( queueCAN_SEND_FAST( pxQueue, xCopyPosition ) != pdFALSE )
 			{
+				traceQUEUE_SEND( pxQueue );
+				( void ) prvCopyDataToQueue( pxQueue, pvItemToQueue, queueSEND_TO_BACK );
+				taskEXIT_CRITICAL();
+				return pdPASS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			/* Is there room on the queue now?  The running task must be the
+			highest priority task wanting to access the queue.  If the head item
+			in the queue is to be overwritten then it does not matter if the
+			queue is full. */
+			if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+			{
+				#if ( configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD > 0 )
+				{
+					if( ( xCopyPosition == queueSEND_TO_BACK ) && ( queueCOPY_OUTSIDE_CRITICAL( pxQueue ) != pdFALSE ) )
+					{
+						/* Claim the slot at the back of the queue then copy the
+						item into it with interrupts enabled.  See the comments
+						above queueCOPY_OUTSIDE_CRITICAL(). */
+						vTaskSuspendAll();
+						pcSlot = pxQueue->pcWriteTo;
+						pxQueue->pcWriteTo += pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+						if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+						{
+							pxQueue->pcWriteTo = pxQueue->pcHead;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+						pxQueue->uxWritesBusy = ( UBaseType_t ) 1U;
+						taskEXIT_CRITICAL();
+
+						traceQUEUE_SEND( pxQueue );
+						( void ) memcpy( ( void * ) pcSlot, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+
+						taskENTER_CRITICAL();
+						{
+							/* Publish the item, and any items sent by interrupts
+							while it was being copied.  The interrupts will have
+							dealt with their own items' waiting tasks, which
+							cannot run until the scheduler is resumed. */
+							pxQueue->uxMessagesWaiting += pxQueue->uxWritesBusy;
+							pxQueue->uxWritesBusy = ( UBaseType_t ) 0U;
+
+							/* Any required yield is held pending until the
+							scheduler is resumed. */
+							( void ) prvQueueMultipleItemsAdded( pxQueue, ( UBaseType_t ) 1U );
+						}
+						taskEXIT_CRITICAL();
+						( void ) xTaskResumeAll();
+
+						return pdPASS;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD */
+
 				traceQUEUE_SEND( pxQueue );
 
-				#if ( configUSE_QUEUE_SETS == 1 )
-				{
-				const UBaseType_t uxPreviousMessagesWaiting = pxQueue->uxMessagesWaiting;
-
+				#if ( configUSE_QUEUE_SETS == 1 )
+				{
+				const UBaseType_t uxPreviousMessagesWaiting = pxQueue->uxMessagesWaiting;
+
 					xYieldRequired = prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
 
 					if( pxQueue->pxQueueSetContainer != NULL )
@@ -908,7 +1542,7 @@ Queue_t * const pxQueue = xQueue;
 			if( prvIsQueueFull( pxQueue ) != pdFALSE )
 			{
 				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
-				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+				queuePLACE_ON_EVENT_LIST( pxQueue, &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
 
 				/* Unlocking the queue means queue events can effect the
 				event list.  It is possible that interrupts occurring now
@@ -980,7 +1614,7 @@ Queue_t * const pxQueue = xQueue;
 	post). */
 	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 	{
-		if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+		if( ( ( queueSLOTS_IN_USE( pxQueue ) < pxQueue->uxLength ) && ( ( xCopyPosition != queueSEND_TO_FRONT ) || ( queueCAN_SEND_TO_FRONT( pxQueue ) != pdFALSE ) ) ) || ( xCopyPosition == queueOVERWRITE ) )
 		{
 			const int8_t cTxLock = pxQueue->cTxLock;
 			const UBaseType_t uxPreviousMessagesWaiting = pxQueue->uxMessagesWaiting;
@@ -1279,6 +1913,9 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue, void * const pvBuffer, TickType_
 BaseType_t xEntryTimeSet = pdFALSE;
 TimeOut_t xTimeOut;
 Queue_t * const pxQueue = xQueue;
+#if ( configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD > 0 )
+	int8_t *pcSlot;
+#endif
 
 	/* Check the pointer is not NULL. */
 	configASSERT( ( pxQueue ) );
@@ -1290,7 +1927,7 @@ Queue_t * const pxQueue = xQueue;
 	/* Cannot block if the scheduler is suspended. */
 	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 	{
-		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		configASSERT( !( ( xTicksToWait != 0 ) && ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) ) );
 	}
 	#endif
 
@@ -1298,6 +1935,33 @@ Queue_t * const pxQueue = xQueue;
 	/*lint -save -e904  This function relaxes the coding standard somewhat to
 	allow return statements within the function itself.  This is done in the
 	interest of execution time efficiency. */
+
+	/* Fast path, see queueCAN_RECEIVE_FAST().  As in xQueueGenericSend() the
+	test is repeated inside the critical section. */
+	if( queueCAN_RECEIVE_FAST( pxQueue ) != pdFALSE )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( queueCAN_RECEIVE_FAST( pxQueue ) != pdFALSE )
+			{
+				prvCopyDataFromQueue( pxQueue, pvBuffer );
+				traceQUEUE_RECEIVE( pxQueue );
+				pxQueue->uxMessagesWaiting--;
+				taskEXIT_CRITICAL();
+				return pdPASS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
 	for( ;; )
 	{
 		taskENTER_CRITICAL();
@@ -1308,6 +1972,52 @@ Queue_t * const pxQueue = xQueue;
 			must be the highest priority task wanting to access the queue. */
 			if( uxMessagesWaiting > ( UBaseType_t ) 0 )
 			{
+				#if ( configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD > 0 )
+				{
+					if( queueCOPY_OUTSIDE_CRITICAL( pxQueue ) != pdFALSE )
+					{
+						/* Claim the slot at the front of the queue then copy
+						the item out of it with interrupts enabled.  See the
+						comments above queueCOPY_OUTSIDE_CRITICAL(). */
+						vTaskSuspendAll();
+						pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+						if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+						{
+							pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+						pcSlot = pxQueue->u.xQueue.pcReadFrom;
+						pxQueue->uxMessagesWaiting = uxMessagesWaiting - ( UBaseType_t ) 1;
+						pxQueue->uxReadsBusy = ( UBaseType_t ) 1U;
+						taskEXIT_CRITICAL();
+
+						( void ) memcpy( pvBuffer, ( void * ) pcSlot, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+						traceQUEUE_RECEIVE( pxQueue );
+
+						taskENTER_CRITICAL();
+						{
+							/* Free the slot, and any slots freed by interrupts
+							while the item was being copied, then unblock a task
+							waiting to send.  Any required yield is held pending
+							until the scheduler is resumed. */
+							pxQueue->uxReadsBusy = ( UBaseType_t ) 0U;
+							( void ) prvUnblockMultipleWaiters( &( pxQueue->xTasksWaitingToSend ), ( UBaseType_t ) 1U );
+						}
+						taskEXIT_CRITICAL();
+						( void ) xTaskResumeAll();
+
+						return pdPASS;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD */
+
 				/* Data available, remove one item. */
 				prvCopyDataFromQueue( pxQueue, pvBuffer );
 				traceQUEUE_RECEIVE( pxQueue );
@@ -1375,7 +2085,7 @@ Queue_t * const pxQueue = xQueue;
 			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
 			{
 				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
-				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+				queuePLACE_ON_EVENT_LIST( pxQueue, &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
 				prvUnlockQueue( pxQueue );
 				if( xTaskResumeAll() == pdFALSE )
 				{
@@ -1415,79 +2125,55 @@ Queue_t * const pxQueue = xQueue;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue, TickType_t xTicksToWait )
+BaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItemsToQueue, const UBaseType_t uxItemCount, TickType_t xTicksToWait )
 {
 BaseType_t xEntryTimeSet = pdFALSE;
 TimeOut_t xTimeOut;
+UBaseType_t uxItemsToSend;
 Queue_t * const pxQueue = xQueue;
 
-#if( configUSE_MUTEXES == 1 )
-	BaseType_t xInheritanceOccurred = pdFALSE;
-#endif
-
-	/* Check the queue pointer is not NULL. */
-	configASSERT( ( pxQueue ) );
+	configASSERT( pxQueue );
+	configASSERT( pvItemsToQueue );
+	configASSERT( uxItemCount > ( UBaseType_t ) 0 );
 
-	/* Check this really is a semaphore, in which case the item size will be
-	0. */
-	configASSERT( pxQueue->uxItemSize == 0 );
+	/* Only queues that hold data can be used - not semaphores or mutexes. */
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
 
-	/* Cannot block if the scheduler is suspended. */
 	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 	{
-		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		configASSERT( !( ( xTicksToWait != 0 ) && ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) ) );
 	}
 	#endif
 
-
-	/*lint -save -e904 This function relaxes the coding standard somewhat to allow return
-	statements within the function itself.  This is done in the interest
-	of execution time efficiency. */
+	/*lint -save -e904 This function relaxes the coding standard somewhat to
+	allow return statements within the function itself.  This is done in the
+	interest of execution time efficiency. */
 	for( ;; )
 	{
 		taskENTER_CRITICAL();
 		{
-			/* Semaphores are queues with an item size of 0, and where the
-			number of messages in the queue is the semaphore's count value. */
-			const UBaseType_t uxSemaphoreCount = pxQueue->uxMessagesWaiting;
+			/* Send as many items as there is space for.  All the items are
+			copied, and all the waiting tasks updated, inside the one critical
+			section, so the calling task yields at most once. */
+			uxItemsToSend = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
 
-			/* Is there data in the queue now?  To be running the calling task
-			must be the highest priority task wanting to access the queue. */
-			if( uxSemaphoreCount > ( UBaseType_t ) 0 )
+			if( uxItemsToSend > ( UBaseType_t ) 0 )
 			{
-				traceQUEUE_RECEIVE( pxQueue );
-
-				/* Semaphores are queues with a data size of zero and where the
-				messages waiting is the semaphore's count.  Reduce the count. */
-				pxQueue->uxMessagesWaiting = uxSemaphoreCount - ( UBaseType_t ) 1;
-
-				#if ( configUSE_MUTEXES == 1 )
+				if( uxItemsToSend > uxItemCount )
 				{
-					if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
-					{
-						/* Record the information required to implement
-						priority inheritance should it become necessary. */
-						pxQueue->u.xSemaphore.xMutexHolder = pvTaskIncrementMutexHeldCount();
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					uxItemsToSend = uxItemCount;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
 				}
-				#endif /* configUSE_MUTEXES */
 
-				/* Check to see if other tasks are blocked waiting to give the
-				semaphore, and if so, unblock the highest priority such task. */
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				traceQUEUE_SEND( pxQueue );
+				prvCopyMultipleToQueue( pxQueue, pvItemsToQueue, uxItemsToSend );
+
+				if( prvQueueMultipleItemsAdded( pxQueue, uxItemsToSend ) != pdFALSE )
 				{
-					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
-					{
-						queueYIELD_IF_USING_PREEMPTION();
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					queueYIELD_IF_USING_PREEMPTION();
 				}
 				else
 				{
@@ -1495,31 +2181,20 @@ Queue_t * const pxQueue = xQueue;
 				}
 
 				taskEXIT_CRITICAL();
-				return pdPASS;
+				return ( BaseType_t ) uxItemsToSend;
 			}
 			else
 			{
 				if( xTicksToWait == ( TickType_t ) 0 )
 				{
-					/* For inheritance to have occurred there must have been an
-					initial timeout, and an adjusted timeout cannot become 0, as
-					if it were 0 the function would have exited. */
-					#if( configUSE_MUTEXES == 1 )
-					{
-						configASSERT( xInheritanceOccurred == pdFALSE );
-					}
-					#endif /* configUSE_MUTEXES */
-
-					/* The semaphore count was 0 and no block time is specified
-					(or the block time has expired) so exit now. */
+					/* The queue was full and no block time is specified (or
+					the block time has expired) so leave now. */
 					taskEXIT_CRITICAL();
-					traceQUEUE_RECEIVE_FAILED( pxQueue );
-					return errQUEUE_EMPTY;
+					traceQUEUE_SEND_FAILED( pxQueue );
+					return errQUEUE_FULL;
 				}
 				else if( xEntryTimeSet == pdFALSE )
 				{
-					/* The semaphore count was 0 and a block time was specified
-					so configure the timeout structure ready to block. */
 					vTaskInternalSetTimeOutState( &xTimeOut );
 					xEntryTimeSet = pdTRUE;
 				}
@@ -1532,42 +2207,18 @@ Queue_t * const pxQueue = xQueue;
 		}
 		taskEXIT_CRITICAL();
 
-		/* Interrupts and other tasks can give to and take from the semaphore
-		now the critical section has been exited. */
-
 		vTaskSuspendAll();
 		prvLockQueue( pxQueue );
 
 		/* Update the timeout state to see if it has expired yet. */
 		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
 		{
-			/* A block time is specified and not expired.  If the semaphore
-			count is 0 then enter the Blocked state to wait for a semaphore to
-			become available.  As semaphores are implemented with queues the
-			queue being empty is equivalent to the semaphore count being 0. */
-			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			if( prvIsQueueFull( pxQueue ) != pdFALSE )
 			{
-				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
-
-				#if ( configUSE_MUTEXES == 1 )
-				{
-					if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
-					{
-						taskENTER_CRITICAL();
-						{
-							xInheritanceOccurred = xTaskPriorityInherit( pxQueue->u.xSemaphore.xMutexHolder );
-						}
-						taskEXIT_CRITICAL();
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-				#endif
-
-				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+				queuePLACE_ON_EVENT_LIST( pxQueue, &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
 				prvUnlockQueue( pxQueue );
+
 				if( xTaskResumeAll() == pdFALSE )
 				{
 					portYIELD_WITHIN_API();
@@ -1579,82 +2230,44 @@ Queue_t * const pxQueue = xQueue;
 			}
 			else
 			{
-				/* There was no timeout and the semaphore count was not 0, so
-				attempt to take the semaphore again. */
+				/* Try again. */
 				prvUnlockQueue( pxQueue );
 				( void ) xTaskResumeAll();
 			}
 		}
 		else
 		{
-			/* Timed out. */
+			/* The timeout has expired. */
 			prvUnlockQueue( pxQueue );
 			( void ) xTaskResumeAll();
 
-			/* If the semaphore count is 0 exit now as the timeout has
-			expired.  Otherwise return to attempt to take the semaphore that is
-			known to be available.  As semaphores are implemented by queues the
-			queue being empty is equivalent to the semaphore count being 0. */
-			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
-			{
-				#if ( configUSE_MUTEXES == 1 )
-				{
-					/* xInheritanceOccurred could only have be set if
-					pxQueue->uxQueueType == queueQUEUE_IS_MUTEX so no need to
-					test the mutex type again to check it is actually a mutex. */
-					if( xInheritanceOccurred != pdFALSE )
-					{
-						taskENTER_CRITICAL();
-						{
-							UBaseType_t uxHighestWaitingPriority;
-
-							/* This task blocking on the mutex caused another
-							task to inherit this task's priority.  Now this task
-							has timed out the priority should be disinherited
-							again, but only as low as the next highest priority
-							task that is waiting for the same mutex. */
-							uxHighestWaitingPriority = prvGetDisinheritPriorityAfterTimeout( pxQueue );
-							vTaskPriorityDisinheritAfterTimeout( pxQueue->u.xSemaphore.xMutexHolder, uxHighestWaitingPriority );
-						}
-						taskEXIT_CRITICAL();
-					}
-				}
-				#endif /* configUSE_MUTEXES */
-
-				traceQUEUE_RECEIVE_FAILED( pxQueue );
-				return errQUEUE_EMPTY;
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+			traceQUEUE_SEND_FAILED( pxQueue );
+			return errQUEUE_FULL;
 		}
 	} /*lint -restore */
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueuePeek( QueueHandle_t xQueue, void * const pvBuffer, TickType_t xTicksToWait )
+BaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxItems, TickType_t xTicksToWait )
 {
 BaseType_t xEntryTimeSet = pdFALSE;
 TimeOut_t xTimeOut;
-int8_t *pcOriginalReadPosition;
+UBaseType_t uxItemsToReceive;
 Queue_t * const pxQueue = xQueue;
 
-	/* Check the pointer is not NULL. */
-	configASSERT( ( pxQueue ) );
+	configASSERT( pxQueue );
+	configASSERT( pvBuffer );
+	configASSERT( uxMaxItems > ( UBaseType_t ) 0 );
 
-	/* The buffer into which data is received can only be NULL if the data size
-	is zero (so no data is copied into the buffer. */
-	configASSERT( !( ( ( pvBuffer ) == NULL ) && ( ( pxQueue )->uxItemSize != ( UBaseType_t ) 0U ) ) );
+	/* Only queues that hold data can be used - not semaphores or mutexes. */
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
 
-	/* Cannot block if the scheduler is suspended. */
 	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 	{
-		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		configASSERT( !( ( xTicksToWait != 0 ) && ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) ) );
 	}
 	#endif
 
-
 	/*lint -save -e904  This function relaxes the coding standard somewhat to
 	allow return statements within the function itself.  This is done in the
 	interest of execution time efficiency. */
@@ -1662,36 +2275,27 @@ Queue_t * const pxQueue = xQueue;
 	{
 		taskENTER_CRITICAL();
 		{
-			const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+			uxItemsToReceive = pxQueue->uxMessagesWaiting;
 
-			/* Is there data in the queue now?  To be running the calling task
-			must be the highest priority task wanting to access the queue. */
-			if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+			if( uxItemsToReceive > ( UBaseType_t ) 0 )
 			{
-				/* Remember the read position so it can be reset after the data
-				is read from the queue as this function is only peeking the
-				data, not removing it. */
-				pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
-
-				prvCopyDataFromQueue( pxQueue, pvBuffer );
-				traceQUEUE_PEEK( pxQueue );
+				if( uxItemsToReceive > uxMaxItems )
+				{
+					uxItemsToReceive = uxMaxItems;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 
-				/* The data is not being removed, so reset the read pointer. */
-				pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+				prvCopyMultipleFromQueue( pxQueue, pvBuffer, uxItemsToReceive );
+				traceQUEUE_RECEIVE( pxQueue );
 
-				/* The data is being left in the queue, so see if there are
-				any other tasks waiting for the data. */
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				/* There is now space for uxItemsToReceive items, so unblock
+				up to that many waiting senders, yielding at most once. */
+				if( prvUnblockMultipleWaiters( &( pxQueue->xTasksWaitingToSend ), uxItemsToReceive ) != pdFALSE )
 				{
-					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
-					{
-						/* The task waiting has a higher priority than this task. */
-						queueYIELD_IF_USING_PREEMPTION();
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					queueYIELD_IF_USING_PREEMPTION();
 				}
 				else
 				{
@@ -1699,7 +2303,7 @@ Queue_t * const pxQueue = xQueue;
 				}
 
 				taskEXIT_CRITICAL();
-				return pdPASS;
+				return ( BaseType_t ) uxItemsToReceive;
 			}
 			else
 			{
@@ -1708,14 +2312,11 @@ Queue_t * const pxQueue = xQueue;
 					/* The queue was empty and no block time is specified (or
 					the block time has expired) so leave now. */
 					taskEXIT_CRITICAL();
-					traceQUEUE_PEEK_FAILED( pxQueue );
+					traceQUEUE_RECEIVE_FAILED( pxQueue );
 					return errQUEUE_EMPTY;
 				}
 				else if( xEntryTimeSet == pdFALSE )
 				{
-					/* The queue was empty and a block time was specified so
-					configure the timeout structure ready to enter the blocked
-					state. */
 					vTaskInternalSetTimeOutState( &xTimeOut );
 					xEntryTimeSet = pdTRUE;
 				}
@@ -1728,22 +2329,18 @@ Queue_t * const pxQueue = xQueue;
 		}
 		taskEXIT_CRITICAL();
 
-		/* Interrupts and other tasks can send to and receive from the queue
-		now the critical section has been exited. */
-
 		vTaskSuspendAll();
 		prvLockQueue( pxQueue );
 
 		/* Update the timeout state to see if it has expired yet. */
 		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
 		{
-			/* Timeout has not expired yet, check to see if there is data in the
-			queue now, and if not enter the Blocked state to wait for data. */
 			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
 			{
-				traceBLOCKING_ON_QUEUE_PEEK( pxQueue );
-				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+				queuePLACE_ON_EVENT_LIST( pxQueue, &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
 				prvUnlockQueue( pxQueue );
+
 				if( xTaskResumeAll() == pdFALSE )
 				{
 					portYIELD_WITHIN_API();
@@ -1755,22 +2352,22 @@ Queue_t * const pxQueue = xQueue;
 			}
 			else
 			{
-				/* There is data in the queue now, so don't enter the blocked
-				state, instead return to try and obtain the data. */
+				/* The queue contains data again.  Loop back to try and read
+				the data. */
 				prvUnlockQueue( pxQueue );
 				( void ) xTaskResumeAll();
 			}
 		}
 		else
 		{
-			/* The timeout has expired.  If there is still no data in the queue
-			exit, otherwise go back and try to read the data again. */
+			/* Timed out.  If there is no data in the queue exit, otherwise
+			loop back and attempt to read the data. */
 			prvUnlockQueue( pxQueue );
 			( void ) xTaskResumeAll();
 
 			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
 			{
-				traceQUEUE_PEEK_FAILED( pxQueue );
+				traceQUEUE_RECEIVE_FAILED( pxQueue );
 				return errQUEUE_EMPTY;
 			}
 			else
@@ -1782,65 +2379,108 @@ Queue_t * const pxQueue = xQueue;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue, void * const pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken )
+BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue, TickType_t xTicksToWait )
 {
-BaseType_t xReturn;
-UBaseType_t uxSavedInterruptStatus;
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
 Queue_t * const pxQueue = xQueue;
 
-	configASSERT( pxQueue );
-	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+#if( configUSE_MUTEXES == 1 )
+	BaseType_t xInheritanceOccurred = pdFALSE;
+#endif
 
-	/* RTOS ports that support interrupt nesting have the concept of a maximum
-	system call (or maximum API call) interrupt priority.  Interrupts that are
-	above the maximum system call priority are kept permanently enabled, even
-	when the RTOS kernel is in a critical section, but cannot make any calls to
-	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-	failure if a FreeRTOS API function is called from an interrupt that has been
-	assigned a priority above the configured maximum system call priority.
-	Only FreeRTOS functions that end in FromISR can be called from interrupts
-	that have been assigned a priority at or (logically) below the maximum
-	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
-	safe API to ensure interrupt entry is as fast and as simple as possible.
-	More information (albeit Cortex-M specific) is provided on the following
-	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
-	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+	/* Check the queue pointer is not NULL. */
+	configASSERT( ( pxQueue ) );
 
-	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	/* Check this really is a semaphore, in which case the item size will be
+	0. */
+	configASSERT( pxQueue->uxItemSize == 0 );
+
+	/* Cannot block if the scheduler is suspended. */
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 	{
-		const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+		configASSERT( !( ( xTicksToWait != 0 ) && ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) ) );
+	}
+	#endif
 
-		/* Cannot block in an ISR, so check there is data available. */
-		if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+
+	/*lint -save -e904 This function relaxes the coding standard somewhat to allow return
+	statements within the function itself.  This is done in the interest
+	of execution time efficiency. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
 		{
-			const int8_t cRxLock = pxQueue->cRxLock;
+			/* Semaphores are queues with an item size of 0, and where the
+			number of messages in the queue is the semaphore's count value. */
+			const UBaseType_t uxSemaphoreCount = pxQueue->uxMessagesWaiting;
 
-			traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+			/* Is there data in the queue now?  To be running the calling task
+			must be the highest priority task wanting to access the queue. */
+			if( uxSemaphoreCount > ( UBaseType_t ) 0 )
+			{
+				traceQUEUE_RECEIVE( pxQueue );
 
-			prvCopyDataFromQueue( pxQueue, pvBuffer );
-			pxQueue->uxMessagesWaiting = uxMessagesWaiting - ( UBaseType_t ) 1;
+				/* Semaphores are queues with a data size of zero and where the
+				messages waiting is the semaphore's count.  Reduce the count. */
+				pxQueue->uxMessagesWaiting = uxSemaphoreCount - ( UBaseType_t ) 1;
 
-			/* If the queue is locked the event list will not be modified.
-			Instead update the lock count so the task that unlocks the queue
-			will know that an ISR has removed data while the queue was
-			locked. */
-			if( cRxLock == queueUNLOCKED )
-			{
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				#if ( configUSE_MUTEXES == 1 )
 				{
-					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+					if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
 					{
-						/* The task waiting has a higher priority than us so
-						force a context switch. */
-						if( pxHigherPriorityTaskWoken != NULL )
+						/* Record the information required to implement
+						priority inheritance should it become necessary. */
+						pxQueue->u.xSemaphore.xMutexHolder = pvTaskIncrementMutexHeldCount();
+
+						#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
 						{
-							*pxHigherPriorityTaskWoken = pdTRUE;
+						UBaseType_t uxPriorityToInherit = prvGetDisinheritPriorityAfterTimeout( pxQueue );
+
+							#if ( configUSE_CEILING_MUTEXES == 1 )
+							{
+								/* The holder of a ceiling mutex runs at the
+								ceiling whether or not a task is waiting. */
+								if( queueIS_CEILING_MUTEX( pxQueue ) != pdFALSE )
+								{
+									uxPriorityToInherit = pxQueue->u.xSemaphore.uxCeilingPriority;
+								}
+								else
+								{
+									mtCOVERAGE_TEST_MARKER();
+								}
+							}
+							#endif /* configUSE_CEILING_MUTEXES */
+
+							vTaskPriorityMutexTaken( pxQueue->u.xSemaphore.xMutexHolder, &( pxQueue->xMutexHeldListItem ), uxPriorityToInherit );
 						}
-						else
+						#elif ( configUSE_CEILING_MUTEXES == 1 )
 						{
-							mtCOVERAGE_TEST_MARKER();
+							if( queueIS_CEILING_MUTEX( pxQueue ) != pdFALSE )
+							{
+								vTaskPriorityRaiseToCeiling( pxQueue->u.xSemaphore.uxCeilingPriority );
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
 						}
+						#endif
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_MUTEXES */
+
+				/* Check to see if other tasks are blocked waiting to give the
+				semaphore, and if so, unblock the highest priority such task. */
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
 					}
 					else
 					{
@@ -1851,287 +2491,2574 @@ Queue_t * const pxQueue = xQueue;
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
+
+				taskEXIT_CRITICAL();
+				return pdPASS;
 			}
 			else
 			{
-				/* Increment the lock count so the task that unlocks the queue
-				knows that data was removed while it was locked. */
-				pxQueue->cRxLock = ( int8_t ) ( cRxLock + 1 );
-			}
+				if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					/* For inheritance to have occurred there must have been an
+					initial timeout, and an adjusted timeout cannot become 0, as
+					if it were 0 the function would have exited. */
+					#if( configUSE_MUTEXES == 1 )
+					{
+						configASSERT( xInheritanceOccurred == pdFALSE );
+					}
+					#endif /* configUSE_MUTEXES */
 
-			xReturn = pdPASS;
-		}
-		else
-		{
-			xReturn = pdFAIL;
-			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+					/* The semaphore count was 0 and no block time is specified
+					(or the block time has expired) so exit now. */
+					taskEXIT_CRITICAL();
+					traceQUEUE_RECEIVE_FAILED( pxQueue );
+					return errQUEUE_EMPTY;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					/* The semaphore count was 0 and a block time was specified
+					so configure the timeout structure ready to block. */
+					vTaskInternalSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					/* Entry time was already set. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
 		}
-	}
-	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
-
-	return xReturn;
-}
-/*-----------------------------------------------------------*/
-
-BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,  void * const pvBuffer )
-{
-BaseType_t xReturn;
-UBaseType_t uxSavedInterruptStatus;
-int8_t *pcOriginalReadPosition;
-Queue_t * const pxQueue = xQueue;
+		taskEXIT_CRITICAL();
 
-	configASSERT( pxQueue );
-	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
-	configASSERT( pxQueue->uxItemSize != 0 ); /* Can't peek a semaphore. */
+		/* Interrupts and other tasks can give to and take from the semaphore
+		now the critical section has been exited. */
 
-	/* RTOS ports that support interrupt nesting have the concept of a maximum
-	system call (or maximum API call) interrupt priority.  Interrupts that are
-	above the maximum system call priority are kept permanently enabled, even
-	when the RTOS kernel is in a critical section, but cannot make any calls to
-	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-	failure if a FreeRTOS API function is called from an interrupt that has been
-	assigned a priority above the configured maximum system call priority.
-	Only FreeRTOS functions that end in FromISR can be called from interrupts
-	that have been assigned a priority at or (logically) below the maximum
-	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
-	safe API to ensure interrupt entry is as fast and as simple as possible.
-	More information (albeit Cortex-M specific) is provided on the following
-	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
-	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
 
-	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
-	{
-		/* Cannot block in an ISR, so check there is data available. */
-		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+		/* Update the timeout state to see if it has expired yet. */
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
 		{
-			traceQUEUE_PEEK_FROM_ISR( pxQueue );
+			/* A block time is specified and not expired.  If the semaphore
+			count is 0 then enter the Blocked state to wait for a semaphore to
+			become available.  As semaphores are implemented with queues the
+			queue being empty is equivalent to the semaphore count being 0. */
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+
+				#if ( configUSE_MUTEXES == 1 )
+				{
+					/* The holder of a ceiling mutex already runs at a priority
+					at least as high as any task that uses the mutex, so there
+					is nothing to inherit. */
+					if( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) && ( queueIS_CEILING_MUTEX( pxQueue ) == pdFALSE ) )
+					{
+						taskENTER_CRITICAL();
+						{
+							#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+							{
+								xInheritanceOccurred = xTaskPriorityInheritFromMutex( &( pxQueue->xMutexHeldListItem ) );
+							}
+							#else
+							{
+								xInheritanceOccurred = xTaskPriorityInherit( pxQueue->u.xSemaphore.xMutexHolder );
+							}
+							#endif
+						}
+						taskEXIT_CRITICAL();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif
+
+				queuePLACE_ON_EVENT_LIST( pxQueue, &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+				prvUnlockQueue( pxQueue );
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* There was no timeout and the semaphore count was not 0, so
+				attempt to take the semaphore again. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+			}
+		}
+		else
+		{
+			/* Timed out. */
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
+
+			#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+			{
+				/* This task is no longer waiting for the mutex, whether or not
+				it goes on to take it, so the holder need only keep the
+				priority of the tasks that still are. */
+				if( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) && ( queueIS_CEILING_MUTEX( pxQueue ) == pdFALSE ) )
+				{
+					taskENTER_CRITICAL();
+					{
+						vTaskPriorityMutexWaitEnded( &( pxQueue->xMutexHeldListItem ), prvGetDisinheritPriorityAfterTimeout( pxQueue ) );
+					}
+					taskEXIT_CRITICAL();
+					xInheritanceOccurred = pdFALSE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_PRECISE_PRIORITY_INHERITANCE */
+
+			/* If the semaphore count is 0 exit now as the timeout has
+			expired.  Otherwise return to attempt to take the semaphore that is
+			known to be available.  As semaphores are implemented by queues the
+			queue being empty is equivalent to the semaphore count being 0. */
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				#if ( configUSE_MUTEXES == 1 )
+				{
+					/* xInheritanceOccurred could only have be set if
+					pxQueue->uxQueueType == queueQUEUE_IS_MUTEX so no need to
+					test the mutex type again to check it is actually a mutex. */
+					if( xInheritanceOccurred != pdFALSE )
+					{
+						taskENTER_CRITICAL();
+						{
+							UBaseType_t uxHighestWaitingPriority;
+
+							/* This task blocking on the mutex caused another
+							task to inherit this task's priority.  Now this task
+							has timed out the priority should be disinherited
+							again, but only as low as the next highest priority
+							task that is waiting for the same mutex. */
+							uxHighestWaitingPriority = prvGetDisinheritPriorityAfterTimeout( pxQueue );
+							vTaskPriorityDisinheritAfterTimeout( pxQueue->u.xSemaphore.xMutexHolder, uxHighestWaitingPriority );
+						}
+						taskEXIT_CRITICAL();
+					}
+				}
+				#endif /* configUSE_MUTEXES */
+
+				traceQUEUE_RECEIVE_FAILED( pxQueue );
+				return errQUEUE_EMPTY;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	} /*lint -restore */
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_FAST_SEMAPHORES == 1 )
+
+	BaseType_t xQueueFastSemaphoreTake( FastSemaphoreHandle_t xFastSemaphore, TickType_t xTicksToWait )
+	{
+	FastSemaphore_t * const pxFastSemaphore = xFastSemaphore;
+	Queue_t * const pxQueue = &( pxFastSemaphore->xQueue );
+	BaseType_t xReturn = pdFAIL, xMustBlock = pdFALSE;
+	uint32_t ulCount;
+
+		configASSERT( pxFastSemaphore );
+
+		#if( configUSE_MUTEXES == 1 )
+		if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+		{
+		TaskHandle_t xCurrentTask = xTaskGetCurrentTaskHandle();
+		void *pvHolder;
+
+			/* Mutexes cannot be taken before the scheduler has started. */
+			configASSERT( xCurrentTask );
+
+			/* Fast path - the mutex is available and nobody is waiting. */
+			if( Atomic_CompareAndSwapPointers_p32( &( pxFastSemaphore->pvHolder ), xCurrentTask, NULL ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS )
+			{
+				traceQUEUE_RECEIVE( pxQueue );
+				return pdPASS;
+			}
+
+			taskENTER_CRITICAL();
+			{
+				pvHolder = pxFastSemaphore->pvHolder;
+
+				if( pvHolder == NULL )
+				{
+					/* The mutex was given back since the fast path was
+					attempted. */
+					pxFastSemaphore->pvHolder = xCurrentTask;
+					xReturn = pdPASS;
+				}
+				else if( pvHolder == queueFAST_MUTEX_CONTENDED( pxFastSemaphore ) )
+				{
+					/* Already contended, the embedded mutex tracks the holder. */
+					xMustBlock = pdTRUE;
+				}
+				else if( xTicksToWait != ( TickType_t ) 0 )
+				{
+					/* The mutex is held by a task that took it using the fast
+					path.  Hand the mutex to the kernel, exactly as if the
+					holder had taken the embedded mutex, so that this task can
+					block on it and the holder inherits this task's priority. */
+					configASSERT( pvHolder != xCurrentTask );
+					pxQueue->u.xSemaphore.xMutexHolder = ( TaskHandle_t ) pvHolder;
+					pxQueue->uxMessagesWaiting = ( UBaseType_t ) 0;
+					vTaskIncrementMutexHeldCount( ( TaskHandle_t ) pvHolder );
+					#if( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+					{
+						vTaskPriorityMutexTaken( ( TaskHandle_t ) pvHolder, &( pxQueue->xMutexHeldListItem ), tskIDLE_PRIORITY );
+					}
+					#endif
+					pxFastSemaphore->pvHolder = queueFAST_MUTEX_CONTENDED( pxFastSemaphore );
+					xMustBlock = pdTRUE;
+				}
+				else
+				{
+					/* Held, and the caller does not want to wait. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( xMustBlock != pdFALSE )
+				{
+					( pxFastSemaphore->uxWaiters )++;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
+		}
+		else
+		#endif /* configUSE_MUTEXES */
+		{
+			/* Fast path - take a count if one is available and nobody is
+			waiting.  Only retried if the count changed under our feet. */
+			for( ;; )
+			{
+				ulCount = pxFastSemaphore->ulCount;
+
+				if( ( ulCount == 0UL ) || ( ( ulCount & queueFAST_COUNT_CONTENDED_BIT ) != 0UL ) )
+				{
+					break;
+				}
+
+				if( Atomic_CompareAndSwap_u32( &( pxFastSemaphore->ulCount ), ulCount - 1UL, ulCount ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS )
+				{
+					traceQUEUE_RECEIVE( pxQueue );
+					return pdPASS;
+				}
+			}
+
+			taskENTER_CRITICAL();
+			{
+				ulCount = pxFastSemaphore->ulCount;
+
+				if( ( ulCount & queueFAST_COUNT_CONTENDED_BIT ) != 0UL )
+				{
+					/* Already contended, the embedded semaphore holds the
+					count. */
+					xMustBlock = pdTRUE;
+				}
+				else if( ulCount != 0UL )
+				{
+					/* A count was given since the fast path was attempted. */
+					pxFastSemaphore->ulCount = ulCount - 1UL;
+					xReturn = pdPASS;
+				}
+				else if( xTicksToWait != ( TickType_t ) 0 )
+				{
+					/* The count is zero.  Move it (zero) into the embedded
+					semaphore so this task can block on it, and make gives go
+					through the embedded semaphore too. */
+					pxQueue->uxMessagesWaiting = ( UBaseType_t ) 0;
+					pxFastSemaphore->ulCount = queueFAST_COUNT_CONTENDED_BIT;
+					xMustBlock = pdTRUE;
+				}
+				else
+				{
+					/* Not available, and the caller does not want to wait. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( xMustBlock != pdFALSE )
+				{
+					( pxFastSemaphore->uxWaiters )++;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
+		}
+
+		if( xMustBlock != pdFALSE )
+		{
+			/* Contended - use the kernel's blocking path, including priority
+			inheritance when the fast semaphore is a mutex. */
+			xReturn = xQueueSemaphoreTake( pxQueue, xTicksToWait );
+
+			taskENTER_CRITICAL();
+			{
+				( pxFastSemaphore->uxWaiters )--;
+				prvFastSemaphoreLeaveContended( pxFastSemaphore );
+			}
+			taskEXIT_CRITICAL();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_FAST_SEMAPHORES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_FAST_SEMAPHORES == 1 )
+
+	BaseType_t xQueueFastSemaphoreGive( FastSemaphoreHandle_t xFastSemaphore )
+	{
+	FastSemaphore_t * const pxFastSemaphore = xFastSemaphore;
+	Queue_t * const pxQueue = &( pxFastSemaphore->xQueue );
+	BaseType_t xReturn = pdFAIL;
+	uint32_t ulCount;
+
+		configASSERT( pxFastSemaphore );
+
+		#if( configUSE_MUTEXES == 1 )
+		if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+		{
+		TaskHandle_t xCurrentTask = xTaskGetCurrentTaskHandle();
+
+			/* Fast path - the calling task holds the mutex and nobody is
+			waiting for it. */
+			if( Atomic_CompareAndSwapPointers_p32( &( pxFastSemaphore->pvHolder ), NULL, xCurrentTask ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS )
+			{
+				traceQUEUE_SEND( pxQueue );
+				return pdPASS;
+			}
+
+			taskENTER_CRITICAL();
+			{
+				/* Only the holder can give a mutex, and the holder is known to
+				the embedded mutex once the fast mutex is contended. */
+				if( ( pxFastSemaphore->pvHolder == queueFAST_MUTEX_CONTENDED( pxFastSemaphore ) ) &&
+					( pxQueue->u.xSemaphore.xMutexHolder == xCurrentTask ) )
+				{
+					/* Wakes the highest priority waiter and disinherits any
+					priority the calling task inherited while holding the
+					mutex. */
+					xReturn = xQueueGenericSend( pxQueue, NULL, queueMUTEX_GIVE_BLOCK_TIME, queueSEND_TO_BACK );
+					prvFastSemaphoreLeaveContended( pxFastSemaphore );
+				}
+				else
+				{
+					traceQUEUE_SEND_FAILED( pxQueue );
+				}
+			}
+			taskEXIT_CRITICAL();
+		}
+		else
+		#endif /* configUSE_MUTEXES */
+		{
+			/* Fast path - increment the count if nobody is waiting. */
+			for( ;; )
+			{
+				ulCount = pxFastSemaphore->ulCount;
+
+				if( ( ulCount & queueFAST_COUNT_CONTENDED_BIT ) != 0UL )
+				{
+					break;
+				}
+
+				if( ulCount >= ( uint32_t ) pxQueue->uxLength )
+				{
+					/* The semaphore is already at its maximum count. */
+					traceQUEUE_SEND_FAILED( pxQueue );
+					return pdFAIL;
+				}
+
+				if( Atomic_CompareAndSwap_u32( &( pxFastSemaphore->ulCount ), ulCount + 1UL, ulCount ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS )
+				{
+					traceQUEUE_SEND( pxQueue );
+					return pdPASS;
+				}
+			}
+
+			/* Contended, so the count is held by the embedded semaphore.  It
+			is only moved back out when the last waiter leaves, which happens
+			inside a critical section, so the test is repeated. */
+			taskENTER_CRITICAL();
+			{
+				ulCount = pxFastSemaphore->ulCount;
+
+				if( ( ulCount & queueFAST_COUNT_CONTENDED_BIT ) != 0UL )
+				{
+					xReturn = xQueueGenericSend( pxQueue, NULL, ( TickType_t ) 0U, queueSEND_TO_BACK );
+				}
+				else if( ulCount < ( uint32_t ) pxQueue->uxLength )
+				{
+					pxFastSemaphore->ulCount = ulCount + 1UL;
+					xReturn = pdPASS;
+				}
+				else
+				{
+					traceQUEUE_SEND_FAILED( pxQueue );
+				}
+			}
+			taskEXIT_CRITICAL();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_FAST_SEMAPHORES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_FAST_SEMAPHORES == 1 )
+
+	BaseType_t xQueueFastSemaphoreGiveFromISR( FastSemaphoreHandle_t xFastSemaphore, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	FastSemaphore_t * const pxFastSemaphore = xFastSemaphore;
+	Queue_t * const pxQueue = &( pxFastSemaphore->xQueue );
+	BaseType_t xReturn = pdFAIL;
+	UBaseType_t uxSavedInterruptStatus;
+	uint32_t ulCount;
+
+		configASSERT( pxFastSemaphore );
+
+		/* Mutexes have an owner so cannot be given from an interrupt. */
+		configASSERT( pxQueue->uxQueueType != queueQUEUE_IS_MUTEX );
+
+		/* See the comments in xQueueGenericSendFromISR(). */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		/* Fast path - increment the count if no task is waiting. */
+		for( ;; )
+		{
+			ulCount = pxFastSemaphore->ulCount;
+
+			if( ( ulCount & queueFAST_COUNT_CONTENDED_BIT ) != 0UL )
+			{
+				break;
+			}
+
+			if( ulCount >= ( uint32_t ) pxQueue->uxLength )
+			{
+				traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+				return pdFAIL;
+			}
+
+			if( Atomic_CompareAndSwap_u32( &( pxFastSemaphore->ulCount ), ulCount + 1UL, ulCount ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS )
+			{
+				traceQUEUE_SEND_FROM_ISR( pxQueue );
+				return pdPASS;
+			}
+		}
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ulCount = pxFastSemaphore->ulCount;
+
+			if( ( ulCount & queueFAST_COUNT_CONTENDED_BIT ) != 0UL )
+			{
+				xReturn = xQueueGiveFromISR( pxQueue, pxHigherPriorityTaskWoken );
+			}
+			else if( ulCount < ( uint32_t ) pxQueue->uxLength )
+			{
+				pxFastSemaphore->ulCount = ulCount + 1UL;
+				xReturn = pdPASS;
+			}
+			else
+			{
+				traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
+	}
+
+#endif /* configUSE_FAST_SEMAPHORES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_FAST_SEMAPHORES == 1 )
+
+	static void prvFastSemaphoreLeaveContended( FastSemaphore_t * const pxFastSemaphore )
+	{
+	Queue_t * const pxQueue = &( pxFastSemaphore->xQueue );
+
+		/* A task that has been unblocked but not yet run is still counted in
+		uxWaiters, so the state cannot be moved out from under it. */
+		if( pxFastSemaphore->uxWaiters == ( UBaseType_t ) 0 )
+		{
+			#if( configUSE_MUTEXES == 1 )
+			if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+			{
+				/* Once contended, the mutex is only returned to the fast path
+				when the embedded mutex is available.  A task that took the
+				embedded mutex gives it back through the embedded mutex. */
+				if( ( pxFastSemaphore->pvHolder == queueFAST_MUTEX_CONTENDED( pxFastSemaphore ) ) &&
+					( pxQueue->uxMessagesWaiting != ( UBaseType_t ) 0 ) )
+				{
+					pxFastSemaphore->pvHolder = NULL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			#endif /* configUSE_MUTEXES */
+			{
+				if( ( pxFastSemaphore->ulCount & queueFAST_COUNT_CONTENDED_BIT ) != 0UL )
+				{
+					pxFastSemaphore->ulCount = ( uint32_t ) pxQueue->uxMessagesWaiting;
+					pxQueue->uxMessagesWaiting = ( UBaseType_t ) 0;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_FAST_SEMAPHORES */
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueuePeek( QueueHandle_t xQueue, void * const pvBuffer, TickType_t xTicksToWait )
+{
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+int8_t *pcOriginalReadPosition;
+Queue_t * const pxQueue = xQueue;
+
+	/* Check the pointer is not NULL. */
+	configASSERT( ( pxQueue ) );
+
+	/* The buffer into which data is received can only be NULL if the data size
+	is zero (so no data is copied into the buffer. */
+	configASSERT( !( ( ( pvBuffer ) == NULL ) && ( ( pxQueue )->uxItemSize != ( UBaseType_t ) 0U ) ) );
+
+	/* Cannot block if the scheduler is suspended. */
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTicksToWait != 0 ) && ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) ) );
+	}
+	#endif
+
+
+	/*lint -save -e904  This function relaxes the coding standard somewhat to
+	allow return statements within the function itself.  This is done in the
+	interest of execution time efficiency. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+			/* Is there data in the queue now?  To be running the calling task
+			must be the highest priority task wanting to access the queue. */
+			if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+			{
+				/* Remember the read position so it can be reset after the data
+				is read from the queue as this function is only peeking the
+				data, not removing it. */
+				pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
+
+				prvCopyDataFromQueue( pxQueue, pvBuffer );
+				traceQUEUE_PEEK( pxQueue );
+
+				/* The data is not being removed, so reset the read pointer. */
+				pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+
+				/* The data is being left in the queue, so see if there are
+				any other tasks waiting for the data. */
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+					{
+						/* The task waiting has a higher priority than this task. */
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				taskEXIT_CRITICAL();
+				return pdPASS;
+			}
+			else
+			{
+				if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					/* The queue was empty and no block time is specified (or
+					the block time has expired) so leave now. */
+					taskEXIT_CRITICAL();
+					traceQUEUE_PEEK_FAILED( pxQueue );
+					return errQUEUE_EMPTY;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					/* The queue was empty and a block time was specified so
+					configure the timeout structure ready to enter the blocked
+					state. */
+					vTaskInternalSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					/* Entry time was already set. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		/* Interrupts and other tasks can send to and receive from the queue
+		now the critical section has been exited. */
+
+		vTaskSuspendAll();
+		prvLockQueue( pxQueue );
+
+		/* Update the timeout state to see if it has expired yet. */
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+		{
+			/* Timeout has not expired yet, check to see if there is data in the
+			queue now, and if not enter the Blocked state to wait for data. */
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				traceBLOCKING_ON_QUEUE_PEEK( pxQueue );
+				queuePLACE_ON_EVENT_LIST( pxQueue, &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+				prvUnlockQueue( pxQueue );
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* There is data in the queue now, so don't enter the blocked
+				state, instead return to try and obtain the data. */
+				prvUnlockQueue( pxQueue );
+				( void ) xTaskResumeAll();
+			}
+		}
+		else
+		{
+			/* The timeout has expired.  If there is still no data in the queue
+			exit, otherwise go back and try to read the data again. */
+			prvUnlockQueue( pxQueue );
+			( void ) xTaskResumeAll();
+
+			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+			{
+				traceQUEUE_PEEK_FAILED( pxQueue );
+				return errQUEUE_EMPTY;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	} /*lint -restore */
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue, void * const pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+BaseType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+
+	/* RTOS ports that support interrupt nesting have the concept of a maximum
+	system call (or maximum API call) interrupt priority.  Interrupts that are
+	above the maximum system call priority are kept permanently enabled, even
+	when the RTOS kernel is in a critical section, but cannot make any calls to
+	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+	failure if a FreeRTOS API function is called from an interrupt that has been
+	assigned a priority above the configured maximum system call priority.
+	Only FreeRTOS functions that end in FromISR can be called from interrupts
+	that have been assigned a priority at or (logically) below the maximum
+	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
+	safe API to ensure interrupt entry is as fast and as simple as possible.
+	More information (albeit Cortex-M specific) is provided on the following
+	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		const UBaseType_t uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+		/* Cannot block in an ISR, so check there is data available. */
+		if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+		{
+			const int8_t cRxLock = pxQueue->cRxLock;
+
+			traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+
+			prvCopyDataFromQueue( pxQueue, pvBuffer );
+			pxQueue->uxMessagesWaiting = uxMessagesWaiting - ( UBaseType_t ) 1;
+
+			#if ( configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD > 0 )
+			{
+				/* If a task is copying an earlier item out of the queue then
+				the slot is freed by that task, see xQueueReceive(). */
+				if( pxQueue->uxReadsBusy != ( UBaseType_t ) 0U )
+				{
+					pxQueue->uxReadsBusy++;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
+			/* If the queue is locked the event list will not be modified.
+			Instead update the lock count so the task that unlocks the queue
+			will know that an ISR has removed data while the queue was
+			locked. */
+			if( cRxLock == queueUNLOCKED )
+			{
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+					{
+						/* The task waiting has a higher priority than us so
+						force a context switch. */
+						if( pxHigherPriorityTaskWoken != NULL )
+						{
+							*pxHigherPriorityTaskWoken = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* Increment the lock count so the task that unlocks the queue
+				knows that data was removed while it was locked. */
+				pxQueue->cRxLock = ( int8_t ) ( cRxLock + 1 );
+			}
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItemsToQueue, const UBaseType_t uxItemCount, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+UBaseType_t uxItemsToSend;
+UBaseType_t uxSavedInterruptStatus;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( pvItemsToQueue );
+	configASSERT( uxItemCount > ( UBaseType_t ) 0 );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+	/* See the comments in xQueueGenericSendFromISR() regarding interrupt
+	priorities. */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		uxItemsToSend = pxQueue->uxLength - queueSLOTS_IN_USE( pxQueue );
+
+		if( uxItemsToSend > ( UBaseType_t ) 0 )
+		{
+			const int8_t cTxLock = pxQueue->cTxLock;
+
+			if( uxItemsToSend > uxItemCount )
+			{
+				uxItemsToSend = uxItemCount;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			traceQUEUE_SEND_FROM_ISR( pxQueue );
+			prvCopyMultipleToQueue( pxQueue, pvItemsToQueue, uxItemsToSend );
+
+			/* The event lists are not updated if the queue is locked.
+			Instead the lock count is incremented by the number of items
+			added so the task that unlocks the queue will unblock as many
+			receivers as would have been unblocked here. */
+			if( cTxLock == queueUNLOCKED )
+			{
+				if( prvQueueMultipleItemsAdded( pxQueue, uxItemsToSend ) != pdFALSE )
+				{
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* The lock count is an int8_t, and it is pointless counting
+				beyond the number of tasks that could be waiting anyway. */
+				if( uxItemsToSend > ( UBaseType_t ) ( queueMAX_LOCK_COUNT - cTxLock ) )
+				{
+					pxQueue->cTxLock = queueMAX_LOCK_COUNT;
+				}
+				else
+				{
+					pxQueue->cTxLock = ( int8_t ) ( cTxLock + ( int8_t ) uxItemsToSend );
+				}
+			}
+		}
+		else
+		{
+			traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+			uxItemsToSend = ( UBaseType_t ) 0;
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return ( BaseType_t ) uxItemsToSend;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, const UBaseType_t uxMaxItems, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+UBaseType_t uxItemsToReceive;
+UBaseType_t uxSavedInterruptStatus;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( pvBuffer );
+	configASSERT( uxMaxItems > ( UBaseType_t ) 0 );
+	configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+	/* See the comments in xQueueGenericSendFromISR() regarding interrupt
+	priorities. */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		uxItemsToReceive = pxQueue->uxMessagesWaiting;
+
+		if( uxItemsToReceive > ( UBaseType_t ) 0 )
+		{
+			const int8_t cRxLock = pxQueue->cRxLock;
+
+			if( uxItemsToReceive > uxMaxItems )
+			{
+				uxItemsToReceive = uxMaxItems;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+			prvCopyMultipleFromQueue( pxQueue, pvBuffer, uxItemsToReceive );
+
+			#if ( configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD > 0 )
+			{
+				/* See xQueueReceiveFromISR(). */
+				if( pxQueue->uxReadsBusy != ( UBaseType_t ) 0U )
+				{
+					pxQueue->uxReadsBusy += uxItemsToReceive;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
+			/* As xQueueSendMultipleFromISR(), but for tasks waiting to
+			send. */
+			if( cRxLock == queueUNLOCKED )
+			{
+				if( prvUnblockMultipleWaiters( &( pxQueue->xTasksWaitingToSend ), uxItemsToReceive ) != pdFALSE )
+				{
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				if( uxItemsToReceive > ( UBaseType_t ) ( queueMAX_LOCK_COUNT - cRxLock ) )
+				{
+					pxQueue->cRxLock = queueMAX_LOCK_COUNT;
+				}
+				else
+				{
+					pxQueue->cRxLock = ( int8_t ) ( cRxLock + ( int8_t ) uxItemsToReceive );
+				}
+			}
+		}
+		else
+		{
+			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return ( BaseType_t ) uxItemsToReceive;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,  void * const pvBuffer )
+{
+BaseType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
+int8_t *pcOriginalReadPosition;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+	configASSERT( pxQueue->uxItemSize != 0 ); /* Can't peek a semaphore. */
+
+	/* RTOS ports that support interrupt nesting have the concept of a maximum
+	system call (or maximum API call) interrupt priority.  Interrupts that are
+	above the maximum system call priority are kept permanently enabled, even
+	when the RTOS kernel is in a critical section, but cannot make any calls to
+	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+	failure if a FreeRTOS API function is called from an interrupt that has been
+	assigned a priority above the configured maximum system call priority.
+	Only FreeRTOS functions that end in FromISR can be called from interrupts
+	that have been assigned a priority at or (logically) below the maximum
+	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
+	safe API to ensure interrupt entry is as fast and as simple as possible.
+	More information (albeit Cortex-M specific) is provided on the following
+	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* Cannot block in an ISR, so check there is data available. */
+		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+		{
+			traceQUEUE_PEEK_FROM_ISR( pxQueue );
+
+			/* Remember the read position so it can be reset as nothing is
+			actually being removed from the queue. */
+			pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
+			prvCopyDataFromQueue( pxQueue, pvBuffer );
+			pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+			traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
+{
+UBaseType_t uxReturn;
+
+	configASSERT( xQueue );
+
+	taskENTER_CRITICAL();
+	{
+		uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
+	}
+	taskEXIT_CRITICAL();
+
+	return uxReturn;
+} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
+{
+UBaseType_t uxReturn;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+
+	taskENTER_CRITICAL();
+	{
+		uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+	}
+	taskEXIT_CRITICAL();
+
+	return uxReturn;
+} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
+{
+UBaseType_t uxReturn;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	uxReturn = pxQueue->uxMessagesWaiting;
+
+	return uxReturn;
+} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+/*-----------------------------------------------------------*/
+
+void vQueueDelete( QueueHandle_t xQueue )
+{
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	traceQUEUE_DELETE( pxQueue );
+
+	#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+	{
+		/* A mutex must not be deleted while it is held, as the list of
+		mutexes held by the mutex holder references it. */
+		configASSERT( !( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) && ( listLIST_ITEM_CONTAINER( &( pxQueue->xMutexHeldListItem ) ) != NULL ) ) );
+	}
+	#endif
+
+	#if ( configQUEUE_REGISTRY_SIZE > 0 )
+	{
+		vQueueUnregisterQueue( pxQueue );
+	}
+	#endif
+
+	#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+	{
+		/* The queue can only have been allocated dynamically - free it
+		again. */
+		vPortFree( pxQueue );
+	}
+	#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+	{
+		/* The queue could have been allocated statically or dynamically, so
+		check before attempting to free the memory. */
+		if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+		{
+			vPortFree( pxQueue );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#else
+	{
+		/* The queue must have been statically allocated, so is not going to be
+		deleted.  Avoid compiler warnings about the unused parameter. */
+		( void ) pxQueue;
+	}
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_WAIT_POLICY == 1 )
+
+	void vQueueSetWaitPolicy( QueueHandle_t xQueue, const uint8_t ucWaitPolicy )
+	{
+	Queue_t * const pxQueue = xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( ( ucWaitPolicy == queueWAIT_POLICY_PRIORITY ) || ( ucWaitPolicy == queueWAIT_POLICY_FIFO ) );
+
+		/* Priority inheritance relies on the tasks waiting for a mutex being
+		held in priority order. */
+		configASSERT( !( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) && ( ucWaitPolicy == queueWAIT_POLICY_FIFO ) ) );
+
+		taskENTER_CRITICAL();
+		{
+			/* Tasks already blocked on the queue would not be reordered, so
+			the policy can only be changed while no task is blocked. */
+			configASSERT( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE );
+			configASSERT( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE );
+
+			pxQueue->ucWaitPolicy = ucWaitPolicy;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_QUEUE_WAIT_POLICY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue )
+	{
+		return ( ( Queue_t * ) xQueue )->uxQueueNumber;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	void vQueueSetQueueNumber( QueueHandle_t xQueue, UBaseType_t uxQueueNumber )
+	{
+		( ( Queue_t * ) xQueue )->uxQueueNumber = uxQueueNumber;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	uint8_t ucQueueGetQueueType( QueueHandle_t xQueue )
+	{
+		return ( ( Queue_t * ) xQueue )->ucQueueType;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MUTEXES == 1 )
+
+	static UBaseType_t prvGetDisinheritPriorityAfterTimeout( const Queue_t * const pxQueue )
+	{
+	UBaseType_t uxHighestPriorityOfWaitingTasks;
+
+		/* If a task waiting for a mutex causes the mutex holder to inherit a
+		priority, but the waiting task times out, then the holder should
+		disinherit the priority - but only down to the highest priority of any
+		other tasks that are waiting for the same mutex.  For this purpose,
+		return the priority of the highest priority task that is waiting for the
+		mutex. */
+		if( listCURRENT_LIST_LENGTH( &( pxQueue->xTasksWaitingToReceive ) ) > 0U )
+		{
+			uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxQueue->xTasksWaitingToReceive ) );
+		}
+		else
+		{
+			uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
+		}
+
+		return uxHighestPriorityOfWaitingTasks;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvItemToQueue, const BaseType_t xPosition )
+{
+BaseType_t xReturn = pdFALSE;
+UBaseType_t uxMessagesWaiting;
+
+	/* This function is called from a critical section. */
+
+	uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+
+	if( pxQueue->uxItemSize == ( UBaseType_t ) 0 )
+	{
+		#if ( configUSE_MUTEXES == 1 )
+		{
+			if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+			{
+				/* The mutex is no longer being held. */
+				#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+				{
+					xReturn = xTaskPriorityDisinheritFromMutex( &( pxQueue->xMutexHeldListItem ) );
+				}
+				#else
+				{
+					xReturn = xTaskPriorityDisinherit( pxQueue->u.xSemaphore.xMutexHolder );
+				}
+				#endif
+				pxQueue->u.xSemaphore.xMutexHolder = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_MUTEXES */
+	}
+	else if( xPosition == queueSEND_TO_BACK )
+	{
+		( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports, plus previous logic ensures a null pointer can only be passed to memcpy() if the copy size is 0.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+		pxQueue->pcWriteTo += pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+		if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+		{
+			pxQueue->pcWriteTo = pxQueue->pcHead;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		( void ) memcpy( ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e9087 !e418 MISRA exception as the casts are only redundant for some ports.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes.  Assert checks null pointer only used when length is 0. */
+		pxQueue->u.xQueue.pcReadFrom -= pxQueue->uxItemSize;
+		if( pxQueue->u.xQueue.pcReadFrom < pxQueue->pcHead ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+		{
+			pxQueue->u.xQueue.pcReadFrom = ( pxQueue->u.xQueue.pcTail - pxQueue->uxItemSize );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( xPosition == queueOVERWRITE )
+		{
+			if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+			{
+				/* An item is not being added but overwritten, so subtract
+				one from the recorded number of items in the queue so when
+				one is added again below the number of recorded items remains
+				correct. */
+				--uxMessagesWaiting;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	#if ( configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD > 0 )
+	{
+		if( ( pxQueue->uxWritesBusy != ( UBaseType_t ) 0U ) && ( xPosition == queueSEND_TO_BACK ) )
+		{
+			/* An interrupt is sending while a task copies an earlier item into
+			the queue.  The item is published by that task so items become
+			visible in order, see xQueueGenericSend(). */
+			pxQueue->uxWritesBusy++;
+		}
+		else
+		{
+			pxQueue->uxMessagesWaiting = uxMessagesWaiting + ( UBaseType_t ) 1;
+		}
+	}
+	#else
+	{
+		pxQueue->uxMessagesWaiting = uxMessagesWaiting + ( UBaseType_t ) 1;
+	}
+	#endif
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer )
+{
+	if( pxQueue->uxItemSize != ( UBaseType_t ) 0 )
+	{
+		pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+		if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+		{
+			pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+		( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports.  Also previous logic ensures a null pointer can only be passed to memcpy() when the count is 0.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyMultipleToQueue( Queue_t * const pxQueue, const void *pvItemsToQueue, const UBaseType_t uxItemCount )
+{
+size_t xBytesToCopy, xBytesToEnd;
+
+	/* This function is called from a critical section. */
+
+	xBytesToCopy = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+	xBytesToEnd = ( size_t ) ( pxQueue->u.xQueue.pcTail - pxQueue->pcWriteTo );
+
+	if( xBytesToCopy < xBytesToEnd )
+	{
+		( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemsToQueue, xBytesToCopy ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+		pxQueue->pcWriteTo += xBytesToCopy; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+	}
+	else
+	{
+		/* The items wrap around the end of the storage area, so copy them in
+		two runs. */
+		( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemsToQueue, xBytesToEnd ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+		( void ) memcpy( ( void * ) pxQueue->pcHead, ( const void * ) &( ( ( const int8_t * ) pvItemsToQueue )[ xBytesToEnd ] ), xBytesToCopy - xBytesToEnd ); /*lint !e961 !e418 !e9087 !e9079 MISRA exception as the casts are only redundant for some ports.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+		pxQueue->pcWriteTo = pxQueue->pcHead + ( xBytesToCopy - xBytesToEnd ); /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+	}
+
+	#if ( configQUEUE_COPY_OUTSIDE_CRITICAL_THRESHOLD > 0 )
+	{
+		/* See prvCopyDataToQueue(). */
+		if( pxQueue->uxWritesBusy != ( UBaseType_t ) 0U )
+		{
+			pxQueue->uxWritesBusy += uxItemCount;
+		}
+		else
+		{
+			pxQueue->uxMessagesWaiting += uxItemCount;
+		}
+	}
+	#else
+	{
+		pxQueue->uxMessagesWaiting += uxItemCount;
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyMultipleFromQueue( Queue_t * const pxQueue, void * const pvBuffer, const UBaseType_t uxItemCount )
+{
+size_t xBytesToCopy, xBytesToEnd;
+int8_t *pcReadFrom, *pcNextRead;
+
+	/* This function is called from a critical section. */
+
+	/* pcReadFrom points to the last item read, so the first item to read is
+	the one after it. */
+	pcReadFrom = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+	if( pcReadFrom >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+	{
+		pcReadFrom = pxQueue->pcHead;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xBytesToCopy = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+	xBytesToEnd = ( size_t ) ( pxQueue->u.xQueue.pcTail - pcReadFrom );
+
+	if( xBytesToCopy < xBytesToEnd )
+	{
+		( void ) memcpy( pvBuffer, ( void * ) pcReadFrom, xBytesToCopy ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+		pcNextRead = pcReadFrom + xBytesToCopy; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+	}
+	else
+	{
+		( void ) memcpy( pvBuffer, ( void * ) pcReadFrom, xBytesToEnd ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+		( void ) memcpy( ( void * ) &( ( ( int8_t * ) pvBuffer )[ xBytesToEnd ] ), ( void * ) pxQueue->pcHead, xBytesToCopy - xBytesToEnd ); /*lint !e961 !e418 !e9087 !e9079 MISRA exception as the casts are only redundant for some ports.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+		pcNextRead = pxQueue->pcHead + ( xBytesToCopy - xBytesToEnd ); /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
+	}
+
+	/* Leave pcReadFrom pointing to the last item read, as
+	prvCopyDataFromQueue() would. */
+	if( pcNextRead == pxQueue->pcHead )
+	{
+		pxQueue->u.xQueue.pcReadFrom = pxQueue->u.xQueue.pcTail - pxQueue->uxItemSize;
+	}
+	else
+	{
+		pxQueue->u.xQueue.pcReadFrom = pcNextRead - pxQueue->uxItemSize;
+	}
+
+	pxQueue->uxMessagesWaiting -= uxItemCount;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvUnblockMultipleWaiters( List_t * const pxEventList, const UBaseType_t uxMaxToUnblock )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+UBaseType_t uxUnblocked;
+
+	/* This function is called from a critical section.  Usually only one task
+	is waiting, in which case only one task is unblocked whatever the number of
+	items moved. */
+	for( uxUnblocked = ( UBaseType_t ) 0; uxUnblocked < uxMaxToUnblock; uxUnblocked++ )
+	{
+		if( listLIST_IS_EMPTY( pxEventList ) != pdFALSE )
+		{
+			break;
+		}
+		else if( xTaskRemoveFromEventList( pxEventList ) != pdFALSE )
+		{
+			xHigherPriorityTaskWoken = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return xHigherPriorityTaskWoken;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvQueueMultipleItemsAdded( Queue_t * const pxQueue, const UBaseType_t uxItemCount )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	/* This function is called from a critical section. */
+
+	#if ( configUSE_QUEUE_SETS == 1 )
+	{
+		UBaseType_t uxItem;
+
+		if( pxQueue->pxQueueSetContainer != NULL )
+		{
+			/* The queue set holds one entry per item in the member queues. */
+			for( uxItem = ( UBaseType_t ) 0; uxItem < uxItemCount; uxItem++ )
+			{
+				if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+				{
+					xHigherPriorityTaskWoken = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		else
+		{
+			xHigherPriorityTaskWoken = prvUnblockMultipleWaiters( &( pxQueue->xTasksWaitingToReceive ), uxItemCount );
+		}
+	}
+	#else /* configUSE_QUEUE_SETS */
+	{
+		xHigherPriorityTaskWoken = prvUnblockMultipleWaiters( &( pxQueue->xTasksWaitingToReceive ), uxItemCount );
+	}
+	#endif /* configUSE_QUEUE_SETS */
+
+	return xHigherPriorityTaskWoken;
+}
+/*-----------------------------------------------------------*/
+
+static void prvUnlockQueue( Queue_t * const pxQueue )
+{
+	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
+
+	/* The lock counts contains the number of extra data items placed or
+	removed from the queue while the queue was locked.  When a queue is
+	locked items can be added or removed, but the event lists cannot be
+	updated. */
+	taskENTER_CRITICAL();
+	{
+		int8_t cTxLock = pxQueue->cTxLock;
+
+		/* See if data was added to the queue while it was locked. */
+		while( cTxLock > queueLOCKED_UNMODIFIED )
+		{
+			/* Data was posted while the queue was locked.  Are any tasks
+			blocked waiting for data to become available? */
+			#if ( configUSE_QUEUE_SETS == 1 )
+			{
+				if( pxQueue->pxQueueSetContainer != NULL )
+				{
+					if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+					{
+						/* The queue is a member of a queue set, and posting to
+						the queue set caused a higher priority task to unblock.
+						A context switch is required. */
+						vTaskMissedYield();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* Tasks that are removed from the event list will get
+					added to the pending ready list as the scheduler is still
+					suspended. */
+					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					{
+						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+						{
+							/* The task waiting has a higher priority so record that a
+							context	switch is required. */
+							vTaskMissedYield();
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						break;
+					}
+				}
+			}
+			#else /* configUSE_QUEUE_SETS */
+			{
+				/* Tasks that are removed from the event list will get added to
+				the pending ready list as the scheduler is still suspended. */
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+					{
+						/* The task waiting has a higher priority so record that
+						a context switch is required. */
+						vTaskMissedYield();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					break;
+				}
+			}
+			#endif /* configUSE_QUEUE_SETS */
+
+			--cTxLock;
+		}
+
+		pxQueue->cTxLock = queueUNLOCKED;
+
+		/* In the common case nothing was removed from the queue while it was
+		locked either, so the Rx lock can be released now rather than in a
+		second critical section. */
+		if( pxQueue->cRxLock == queueLOCKED_UNMODIFIED )
+		{
+			pxQueue->cRxLock = queueUNLOCKED;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	/* Do the same for the Rx lock, if it is still locked.  Interrupts do not
+	modify cRxLock once it is queueUNLOCKED, so it can be tested outside of the
+	critical section. */
+	if( pxQueue->cRxLock != queueUNLOCKED )
+	{
+		taskENTER_CRITICAL();
+		{
+			int8_t cRxLock = pxQueue->cRxLock;
+
+			while( cRxLock > queueLOCKED_UNMODIFIED )
+			{
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+					{
+						vTaskMissedYield();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					--cRxLock;
+				}
+				else
+				{
+					break;
+				}
+			}
+
+			pxQueue->cRxLock = queueUNLOCKED;
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvIsQueueEmpty( const Queue_t *pxQueue )
+{
+BaseType_t xReturn;
+
+	/* uxMessagesWaiting is read in a single access, as it is by
+	xQueueIsQueueEmptyFromISR(), so no critical section is needed.  When the
+	queue is locked an interrupt that adds data after the read updates cTxLock,
+	so a task that then blocks is unblocked by prvUnlockQueue(), and in all
+	other cases the caller re-tests the queue inside a critical section. */
+	if( pxQueue->uxMessagesWaiting == ( UBaseType_t )  0 )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueIsQueueEmptyFromISR( const QueueHandle_t xQueue )
+{
+BaseType_t xReturn;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+} /*lint !e818 xQueue could not be pointer to const because it is a typedef. */
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvIsQueueFull( const Queue_t *pxQueue )
+{
+BaseType_t xReturn;
+
+	/* No critical section is needed, see the comments in prvIsQueueEmpty(). */
+	if( pxQueue->uxMessagesWaiting == pxQueue->uxLength )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
+{
+BaseType_t xReturn;
+Queue_t * const pxQueue = xQueue;
+
+	configASSERT( pxQueue );
+	if( queueSLOTS_IN_USE( pxQueue ) == pxQueue->uxLength )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+} /*lint !e818 xQueue could not be pointer to const because it is a typedef. */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_CO_ROUTINES == 1 )
+
+	BaseType_t xQueueCRSend( QueueHandle_t xQueue, const void *pvItemToQueue, TickType_t xTicksToWait )
+	{
+	BaseType_t xReturn;
+	Queue_t * const pxQueue = xQueue;
+
+		/* If the queue is already full we may have to block.  A critical section
+		is required to prevent an interrupt removing something from the queue
+		between the check to see if the queue is full and blocking on the queue. */
+		portDISABLE_INTERRUPTS();
+		{
+			if( prvIsQueueFull( pxQueue ) != pdFALSE )
+			{
+				/* The queue is full - do we want to block or just leave without
+				posting? */
+				if( xTicksToWait > ( TickType_t ) 0 )
+				{
+					/* As this is called from a coroutine we cannot block directly, but
+					return indicating that we need to block. */
+					vCoRoutineAddToDelayedList( xTicksToWait, &( pxQueue->xTasksWaitingToSend ) );
+					portENABLE_INTERRUPTS();
+					return errQUEUE_BLOCKED;
+				}
+				else
+				{
+					portENABLE_INTERRUPTS();
+					return errQUEUE_FULL;
+				}
+			}
+		}
+		portENABLE_INTERRUPTS();
+
+		portDISABLE_INTERRUPTS();
+		{
+			if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
+			{
+				/* There is room in the queue, copy the data into the queue. */
+				prvCopyDataToQueue( pxQueue, pvItemToQueue, queueSEND_TO_BACK );
+				xReturn = pdPASS;
+
+				/* Were any co-routines waiting for data to become available? */
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				{
+					/* In this instance the co-routine could be placed directly
+					into the ready list as we are within a critical section.
+					Instead the same pending ready list mechanism is used as if
+					the event were caused from within an interrupt. */
+					if( xCoRoutineRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+					{
+						/* The co-routine waiting has a higher priority so record
+						that a yield might be appropriate. */
+						xReturn = errQUEUE_YIELD;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				xReturn = errQUEUE_FULL;
+			}
+		}
+		portENABLE_INTERRUPTS();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_CO_ROUTINES == 1 )
+
+	BaseType_t xQueueCRReceive( QueueHandle_t xQueue, void *pvBuffer, TickType_t xTicksToWait )
+	{
+	BaseType_t xReturn;
+	Queue_t * const pxQueue = xQueue;
+
+		/* If the queue is already empty we may have to block.  A critical section
+		is required to prevent an interrupt adding something to the queue
+		between the check to see if the queue is empty and blocking on the queue. */
+		portDISABLE_INTERRUPTS();
+		{
+			if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 )
+			{
+				/* There are no messages in the queue, do we want to block or just
+				leave with nothing? */
+				if( xTicksToWait > ( TickType_t ) 0 )
+				{
+					/* As this is a co-routine we cannot block directly, but return
+					indicating that we need to block. */
+					vCoRoutineAddToDelayedList( xTicksToWait, &( pxQueue->xTasksWaitingToReceive ) );
+					portENABLE_INTERRUPTS();
+					return errQUEUE_BLOCKED;
+				}
+				else
+				{
+					portENABLE_INTERRUPTS();
+					return errQUEUE_FULL;
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portENABLE_INTERRUPTS();
+
+		portDISABLE_INTERRUPTS();
+		{
+			if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+			{
+				/* Data is available from the queue. */
+				pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
+				if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
+				{
+					pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+				--( pxQueue->uxMessagesWaiting );
+				( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
+
+				xReturn = pdPASS;
+
+				/* Were any co-routines waiting for space to become available? */
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				{
+					/* In this instance the co-routine could be placed directly
+					into the ready list as we are within a critical section.
+					Instead the same pending ready list mechanism is used as if
+					the event were caused from within an interrupt. */
+					if( xCoRoutineRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+					{
+						xReturn = errQUEUE_YIELD;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				xReturn = pdFAIL;
+			}
+		}
+		portENABLE_INTERRUPTS();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_CO_ROUTINES == 1 )
+
+	BaseType_t xQueueCRSendFromISR( QueueHandle_t xQueue, const void *pvItemToQueue, BaseType_t xCoRoutinePreviouslyWoken )
+	{
+	Queue_t * const pxQueue = xQueue;
+
+		/* Cannot block within an ISR so if there is no space on the queue then
+		exit without doing anything. */
+		if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
+		{
+			prvCopyDataToQueue( pxQueue, pvItemToQueue, queueSEND_TO_BACK );
+
+			/* We only want to wake one co-routine per ISR, so check that a
+			co-routine has not already been woken. */
+			if( xCoRoutinePreviouslyWoken == pdFALSE )
+			{
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				{
+					if( xCoRoutineRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+					{
+						return pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xCoRoutinePreviouslyWoken;
+	}
+
+#endif /* configUSE_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_CO_ROUTINES == 1 )
+
+	BaseType_t xQueueCRReceiveFromISR( QueueHandle_t xQueue, void *pvBuffer, BaseType_t *pxCoRoutineWoken )
+	{
+	BaseType_t xReturn;
+	Queue_t * const pxQueue = xQueue;
+
+		/* We cannot block from an ISR, so check there is data available. If
+		not then just leave without doing anything. */
+		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+		{
+			/* Copy the data from the queue. */
+			pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
+			if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
+			{
+				pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+			--( pxQueue->uxMessagesWaiting );
+			( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
+
+			if( ( *pxCoRoutineWoken ) == pdFALSE )
+			{
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				{
+					if( xCoRoutineRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+					{
+						*pxCoRoutineWoken = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
+#if ( configQUEUE_REGISTRY_SIZE > 0 )
+
+	void vQueueAddToRegistry( QueueHandle_t xQueue, const char *pcQueueName ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+	UBaseType_t ux;
+
+		/* See if there is an empty space in the registry.  A NULL name denotes
+		a free slot. */
+		for( ux = ( UBaseType_t ) 0U; ux < ( UBaseType_t ) configQUEUE_REGISTRY_SIZE; ux++ )
+		{
+			if( xQueueRegistry[ ux ].pcQueueName == NULL )
+			{
+				/* Store the information on this queue. */
+				xQueueRegistry[ ux ].pcQueueName = pcQueueName;
+				xQueueRegistry[ ux ].xHandle = xQueue;
+
+				traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName );
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+
+#endif /* configQUEUE_REGISTRY_SIZE */
+/*-----------------------------------------------------------*/
+
+#if ( configQUEUE_REGISTRY_SIZE > 0 )
+
+	const char *pcQueueGetName( QueueHandle_t xQueue ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+	UBaseType_t ux;
+	const char *pcReturn = NULL; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+		/* Note there is nothing here to protect against another task adding or
+		removing entries from the registry while it is being searched. */
+		for( ux = ( UBaseType_t ) 0U; ux < ( UBaseType_t ) configQUEUE_REGISTRY_SIZE; ux++ )
+		{
+			if( xQueueRegistry[ ux ].xHandle == xQueue )
+			{
+				pcReturn = xQueueRegistry[ ux ].pcQueueName;
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return pcReturn;
+	} /*lint !e818 xQueue cannot be a pointer to const because it is a typedef. */
+
+#endif /* configQUEUE_REGISTRY_SIZE */
+/*-----------------------------------------------------------*/
+
+#if ( configQUEUE_REGISTRY_SIZE > 0 )
+
+	void vQueueUnregisterQueue( QueueHandle_t xQueue )
+	{
+	UBaseType_t ux;
+
+		/* See if the handle of the queue being unregistered in actually in the
+		registry. */
+		for( ux = ( UBaseType_t ) 0U; ux < ( UBaseType_t ) configQUEUE_REGISTRY_SIZE; ux++ )
+		{
+			if( xQueueRegistry[ ux ].xHandle == xQueue )
+			{
+				/* Set the name to NULL to show that this slot if free again. */
+				xQueueRegistry[ ux ].pcQueueName = NULL;
+
+				/* Set the handle to NULL to ensure the same queue handle cannot
+				appear in the registry twice if it is added, removed, then
+				added again. */
+				xQueueRegistry[ ux ].xHandle = ( QueueHandle_t ) 0;
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+	} /*lint !e818 xQueue could not be pointer to const because it is a typedef. */
+
+#endif /* configQUEUE_REGISTRY_SIZE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMERS == 1 )
+
+	void vQueueWaitForMessageRestricted( QueueHandle_t xQueue, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely )
+	{
+	Queue_t * const pxQueue = xQueue;
+
+		/* This function should not be called by application code hence the
+		'Restricted' in its name.  It is not part of the public API.  It is
+		designed for use by kernel code, and has special calling requirements.
+		It can result in vListInsert() being called on a list that can only
+		possibly ever have one item in it, so the list will be fast, but even
+		so it should be called with the scheduler locked and not from a critical
+		section. */
+
+		/* Only do anything if there are no messages in the queue.  This function
+		will not actually cause the task to block, just place it on a blocked
+		list.  It will not block until the scheduler is unlocked - at which
+		time a yield will be performed.  If an item is added to the queue while
+		the queue is locked, and the calling task blocks on the queue, then the
+		calling task will be immediately unblocked when the queue is unlocked. */
+		prvLockQueue( pxQueue );
+		if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0U )
+		{
+			/* There is nothing in the queue, block for the specified period. */
+			vTaskPlaceOnEventListRestricted( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait, xWaitIndefinitely );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+		prvUnlockQueue( pxQueue );
+	}
+
+#endif /* configUSE_TIMERS */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_QUEUE_SETS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	QueueSetHandle_t xQueueCreateSet( const UBaseType_t uxEventQueueLength )
+	{
+	QueueSetHandle_t pxQueue;
+
+		pxQueue = xQueueGenericCreate( uxEventQueueLength, ( UBaseType_t ) sizeof( Queue_t * ), queueQUEUE_TYPE_SET );
+
+		return pxQueue;
+	}
+
+#endif /* configUSE_QUEUE_SETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_SETS == 1 )
+
+	BaseType_t xQueueAddToSet( QueueSetMemberHandle_t xQueueOrSemaphore, QueueSetHandle_t xQueueSet )
+	{
+	BaseType_t xReturn;
+
+		taskENTER_CRITICAL();
+		{
+			if( ( ( Queue_t * ) xQueueOrSemaphore )->pxQueueSetContainer != NULL )
+			{
+				/* Cannot add a queue/semaphore to more than one queue set. */
+				xReturn = pdFAIL;
+			}
+			else if( ( ( Queue_t * ) xQueueOrSemaphore )->uxMessagesWaiting != ( UBaseType_t ) 0 )
+			{
+				/* Cannot add a queue/semaphore to a queue set if there are already
+				items in the queue/semaphore. */
+				xReturn = pdFAIL;
+			}
+			else
+			{
+				( ( Queue_t * ) xQueueOrSemaphore )->pxQueueSetContainer = xQueueSet;
+				xReturn = pdPASS;
+			}
+		}
+		taskEXIT_CRITICAL();
 
-			/* Remember the read position so it can be reset as nothing is
-			actually being removed from the queue. */
-			pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
-			prvCopyDataFromQueue( pxQueue, pvBuffer );
-			pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+		return xReturn;
+	}
 
-			xReturn = pdPASS;
+#endif /* configUSE_QUEUE_SETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_SETS == 1 )
+
+	BaseType_t xQueueRemoveFromSet( QueueSetMemberHandle_t xQueueOrSemaphore, QueueSetHandle_t xQueueSet )
+	{
+	BaseType_t xReturn;
+	Queue_t * const pxQueueOrSemaphore = ( Queue_t * ) xQueueOrSemaphore;
+
+		if( pxQueueOrSemaphore->pxQueueSetContainer != xQueueSet )
+		{
+			/* The queue was not a member of the set. */
+			xReturn = pdFAIL;
 		}
-		else
+		else if( pxQueueOrSemaphore->uxMessagesWaiting != ( UBaseType_t ) 0 )
 		{
+			/* It is dangerous to remove a queue from a set when the queue is
+			not empty because the queue set will still hold pending events for
+			the queue. */
 			xReturn = pdFAIL;
-			traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
 		}
-	}
-	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		else
+		{
+			taskENTER_CRITICAL();
+			{
+				/* The queue is no longer contained in the set. */
+				pxQueueOrSemaphore->pxQueueSetContainer = NULL;
+			}
+			taskEXIT_CRITICAL();
+			xReturn = pdPASS;
+		}
 
-	return xReturn;
-}
-/*-----------------------------------------------------------*/
+		return xReturn;
+	} /*lint !e818 xQueueSet could not be declared as pointing to const as it is a typedef. */
 
-UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
-{
-UBaseType_t uxReturn;
+#endif /* configUSE_QUEUE_SETS */
+/*-----------------------------------------------------------*/
 
-	configASSERT( xQueue );
+#if ( configUSE_QUEUE_SETS == 1 )
 
-	taskENTER_CRITICAL();
+	QueueSetMemberHandle_t xQueueSelectFromSet( QueueSetHandle_t xQueueSet, TickType_t const xTicksToWait )
 	{
-		uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
+	QueueSetMemberHandle_t xReturn = NULL;
+
+		( void ) xQueueReceive( ( QueueHandle_t ) xQueueSet, &xReturn, xTicksToWait ); /*lint !e961 Casting from one typedef to another is not redundant. */
+		return xReturn;
 	}
-	taskEXIT_CRITICAL();
 
-	return uxReturn;
-} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+#endif /* configUSE_QUEUE_SETS */
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
-{
-UBaseType_t uxReturn;
-Queue_t * const pxQueue = xQueue;
-
-	configASSERT( pxQueue );
+#if ( configUSE_QUEUE_SETS == 1 )
 
-	taskENTER_CRITICAL();
+	QueueSetMemberHandle_t xQueueSelectFromSetFromISR( QueueSetHandle_t xQueueSet )
 	{
-		uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+	QueueSetMemberHandle_t xReturn = NULL;
+
+		( void ) xQueueReceiveFromISR( ( QueueHandle_t ) xQueueSet, &xReturn, NULL ); /*lint !e961 Casting from one typedef to another is not redundant. */
+		return xReturn;
 	}
-	taskEXIT_CRITICAL();
 
-	return uxReturn;
-} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
+#endif /* configUSE_QUEUE_SETS */
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
-{
-UBaseType_t uxReturn;
-Queue_t * const pxQueue = xQueue;
+#if ( configUSE_QUEUE_SETS == 1 )
 
-	configASSERT( pxQueue );
-	uxReturn = pxQueue->uxMessagesWaiting;
+	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue )
+	{
+	Queue_t *pxQueueSetContainer = pxQueue->pxQueueSetContainer;
+	BaseType_t xReturn = pdFALSE;
 
-	return uxReturn;
-} /*lint !e818 Pointer cannot be declared const as xQueue is a typedef not pointer. */
-/*-----------------------------------------------------------*/
+		/* This function must be called form a critical section. */
 
-void vQueueDelete( QueueHandle_t xQueue )
-{
-Queue_t * const pxQueue = xQueue;
+		configASSERT( pxQueueSetContainer );
+		configASSERT( pxQueueSetContainer->uxMessagesWaiting < pxQueueSetContainer->uxLength );
 
-	configASSERT( pxQueue );
-	traceQUEUE_DELETE( pxQueue );
+		if( pxQueueSetContainer->uxMessagesWaiting < pxQueueSetContainer->uxLength )
+		{
+			const int8_t cTxLock = pxQueueSetContainer->cTxLock;
 
-	#if ( configQUEUE_REGISTRY_SIZE > 0 )
-	{
-		vQueueUnregisterQueue( pxQueue );
+			traceQUEUE_SEND( pxQueueSetContainer );
+
+			/* The data copied is the handle of the queue that contains data. */
+			xReturn = prvCopyDataToQueue( pxQueueSetContainer, &pxQueue, queueSEND_TO_BACK );
+
+			if( cTxLock == queueUNLOCKED )
+			{
+				if( listLIST_IS_EMPTY( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) != pdFALSE )
+					{
+						/* The task waiting has a higher priority. */
+						xReturn = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				pxQueueSetContainer->cTxLock = ( int8_t ) ( cTxLock + 1 );
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
 	}
-	#endif
 
-	#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+#endif /* configUSE_QUEUE_SETS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_SPSC_QUEUES == 1 )
+
+	static void prvInitialiseNewSPSCQueue( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, SPSCQueue_t *pxNewQueue )
 	{
-		/* The queue can only have been allocated dynamically - free it
-		again. */
-		vPortFree( pxQueue );
+		pxNewQueue->pcStorage = ( int8_t * ) pucQueueStorage;
+		pxNewQueue->uxLength = uxQueueLength;
+		pxNewQueue->uxItemSize = uxItemSize;
+		pxNewQueue->uxHead = ( UBaseType_t ) 0U;
+		pxNewQueue->uxTail = ( UBaseType_t ) 0U;
+		pxNewQueue->xTaskWaitingToReceive = NULL;
+
+		traceQUEUE_CREATE( pxNewQueue );
 	}
-	#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+#endif /* configUSE_SPSC_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_SPSC_QUEUES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	SPSCQueueHandle_t xQueueCreateSPSCStatic( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, StaticSPSCQueue_t *pxStaticQueue )
 	{
-		/* The queue could have been allocated statically or dynamically, so
-		check before attempting to free the memory. */
-		if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+	SPSCQueue_t *pxNewQueue;
+
+		configASSERT( uxQueueLength > ( UBaseType_t ) 0 );
+		configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+		configASSERT( pucQueueStorage != NULL );
+		configASSERT( pxStaticQueue != NULL );
+
+		/* The indexes count up to twice the queue length. */
+		configASSERT( uxQueueLength <= ( ( ( UBaseType_t ) ~( UBaseType_t ) 0 ) / ( UBaseType_t ) 2 ) );
+
+		#if( configASSERT_DEFINED == 1 )
 		{
-			vPortFree( pxQueue );
+			/* Sanity check that the size of the structure used to declare a
+			variable of type StaticSPSCQueue_t equals the size of the real SPSC
+			queue structure. */
+			volatile size_t xSize = sizeof( StaticSPSCQueue_t );
+			configASSERT( xSize == sizeof( SPSCQueue_t ) );
+			( void ) xSize; /* Keeps lint quiet when configASSERT() is not defined. */
+		}
+		#endif /* configASSERT_DEFINED */
+
+		pxNewQueue = ( SPSCQueue_t * ) pxStaticQueue; /*lint !e740 !e9087 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
+		if( pxNewQueue != NULL )
+		{
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+			{
+				pxNewQueue->ucStaticallyAllocated = pdTRUE;
+			}
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+			prvInitialiseNewSPSCQueue( uxQueueLength, uxItemSize, pucQueueStorage, pxNewQueue );
 		}
 		else
 		{
+			traceQUEUE_CREATE_FAILED( queueQUEUE_TYPE_BASE );
 			mtCOVERAGE_TEST_MARKER();
 		}
+
+		return pxNewQueue;
 	}
-	#else
-	{
-		/* The queue must have been statically allocated, so is not going to be
-		deleted.  Avoid compiler warnings about the unused parameter. */
-		( void ) pxQueue;
-	}
-	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
-}
+
+#endif /* ( ( configUSE_SPSC_QUEUES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if( ( configUSE_SPSC_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
-	UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue )
+	SPSCQueueHandle_t xQueueCreateSPSC( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize )
 	{
-		return ( ( Queue_t * ) xQueue )->uxQueueNumber;
+	SPSCQueue_t *pxNewQueue;
+	uint8_t *pucQueueStorage;
+
+		configASSERT( uxQueueLength > ( UBaseType_t ) 0 );
+		configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+
+		/* The indexes count up to twice the queue length. */
+		configASSERT( uxQueueLength <= ( ( ( UBaseType_t ) ~( UBaseType_t ) 0 ) / ( UBaseType_t ) 2 ) );
+
+		/* Allocate the queue structure and storage area together.  See the
+		comments in xQueueGenericCreate() regarding alignment. */
+		pxNewQueue = ( SPSCQueue_t * ) pvPortMalloc( sizeof( SPSCQueue_t ) + ( size_t ) ( uxQueueLength * uxItemSize ) ); /*lint !e9087 !e9079 see comment above. */
+
+		if( pxNewQueue != NULL )
+		{
+			pucQueueStorage = ( uint8_t * ) pxNewQueue;
+			pucQueueStorage += sizeof( SPSCQueue_t ); /*lint !e9016 Pointer arithmetic allowed on char types, especially when it assists conveying intent. */
+
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				pxNewQueue->ucStaticallyAllocated = pdFALSE;
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+			prvInitialiseNewSPSCQueue( uxQueueLength, uxItemSize, pucQueueStorage, pxNewQueue );
+		}
+		else
+		{
+			traceQUEUE_CREATE_FAILED( queueQUEUE_TYPE_BASE );
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pxNewQueue;
 	}
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* ( ( configUSE_SPSC_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if( configUSE_SPSC_QUEUES == 1 )
 
-	void vQueueSetQueueNumber( QueueHandle_t xQueue, UBaseType_t uxQueueNumber )
+	void vQueueSPSCDelete( SPSCQueueHandle_t xQueue )
 	{
-		( ( Queue_t * ) xQueue )->uxQueueNumber = uxQueueNumber;
+	SPSCQueue_t * const pxQueue = xQueue;
+
+		configASSERT( pxQueue );
+		traceQUEUE_DELETE( pxQueue );
+
+		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+		{
+			vPortFree( pxQueue );
+		}
+		#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+		{
+			if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+			{
+				vPortFree( pxQueue );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#else
+		{
+			/* The queue must have been statically allocated, so is not going
+			to be deleted. */
+			( void ) pxQueue;
+		}
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 	}
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* configUSE_SPSC_QUEUES */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if( configUSE_SPSC_QUEUES == 1 )
 
-	uint8_t ucQueueGetQueueType( QueueHandle_t xQueue )
+	static UBaseType_t prvSPSCItemsWaiting( const SPSCQueue_t * const pxQueue, const UBaseType_t uxHead, const UBaseType_t uxTail )
 	{
-		return ( ( Queue_t * ) xQueue )->ucQueueType;
+	UBaseType_t uxItems;
+
+		if( uxHead >= uxTail )
+		{
+			uxItems = uxHead - uxTail;
+		}
+		else
+		{
+			uxItems = ( uxHead + ( pxQueue->uxLength * ( UBaseType_t ) 2 ) ) - uxTail;
+		}
+
+		return uxItems;
 	}
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* configUSE_SPSC_QUEUES */
 /*-----------------------------------------------------------*/
 
-#if( configUSE_MUTEXES == 1 )
+#if( configUSE_SPSC_QUEUES == 1 )
 
-	static UBaseType_t prvGetDisinheritPriorityAfterTimeout( const Queue_t * const pxQueue )
+	static BaseType_t prvSPSCWrite( SPSCQueue_t * const pxQueue, const void * const pvItemToQueue )
 	{
-	UBaseType_t uxHighestPriorityOfWaitingTasks;
+	UBaseType_t uxHead, uxSlot;
+	BaseType_t xReturn;
 
-		/* If a task waiting for a mutex causes the mutex holder to inherit a
-		priority, but the waiting task times out, then the holder should
-		disinherit the priority - but only down to the highest priority of any
-		other tasks that are waiting for the same mutex.  For this purpose,
-		return the priority of the highest priority task that is waiting for the
-		mutex. */
-		if( listCURRENT_LIST_LENGTH( &( pxQueue->xTasksWaitingToReceive ) ) > 0U )
+		/* uxHead is only written by this context, uxTail may be advanced by
+		the consumer at any time but that can only make more space. */
+		uxHead = pxQueue->uxHead;
+
+		if( prvSPSCItemsWaiting( pxQueue, uxHead, pxQueue->uxTail ) < pxQueue->uxLength )
 		{
-			uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxQueue->xTasksWaitingToReceive ) );
+			uxSlot = ( uxHead < pxQueue->uxLength ) ? uxHead : ( uxHead - pxQueue->uxLength );
+			( void ) memcpy( ( void * ) &( pxQueue->pcStorage[ uxSlot * pxQueue->uxItemSize ] ), pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports, plus previous logic ensures a null pointer can only be passed to memcpy() when the count is 0.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+
+			/* The item must be in the storage area before the consumer can see
+			the new head. */
+			portMEMORY_BARRIER();
+
+			uxHead++;
+			if( uxHead == ( pxQueue->uxLength * ( UBaseType_t ) 2 ) )
+			{
+				uxHead = ( UBaseType_t ) 0U;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxQueue->uxHead = uxHead;
+
+			/* The new head must be visible before xTaskWaitingToReceive is
+			read, otherwise a consumer that registers in between would neither
+			see the item nor be notified. */
+			portMEMORY_BARRIER();
+
+			xReturn = pdTRUE;
 		}
 		else
 		{
-			uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
+			xReturn = pdFALSE;
 		}
 
-		return uxHighestPriorityOfWaitingTasks;
+		return xReturn;
 	}
 
-#endif /* configUSE_MUTEXES */
+#endif /* configUSE_SPSC_QUEUES */
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue, const void *pvItemToQueue, const BaseType_t xPosition )
-{
-BaseType_t xReturn = pdFALSE;
-UBaseType_t uxMessagesWaiting;
+#if( configUSE_SPSC_QUEUES == 1 )
 
-	/* This function is called from a critical section. */
+	static BaseType_t prvSPSCRead( SPSCQueue_t * const pxQueue, void * const pvBuffer )
+	{
+	UBaseType_t uxTail, uxSlot;
+	BaseType_t xReturn;
 
-	uxMessagesWaiting = pxQueue->uxMessagesWaiting;
+		uxTail = pxQueue->uxTail;
 
-	if( pxQueue->uxItemSize == ( UBaseType_t ) 0 )
-	{
-		#if ( configUSE_MUTEXES == 1 )
+		if( pxQueue->uxHead != uxTail )
 		{
-			if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+			/* Do not read the item before the head that published it. */
+			portMEMORY_BARRIER();
+
+			uxSlot = ( uxTail < pxQueue->uxLength ) ? uxTail : ( uxTail - pxQueue->uxLength );
+			( void ) memcpy( pvBuffer, ( void * ) &( pxQueue->pcStorage[ uxSlot * pxQueue->uxItemSize ] ), ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports.  Also previous logic ensures a null pointer can only be passed to memcpy() when the count is 0.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+
+			/* The item must have been copied out before the producer can
+			reuse the slot. */
+			portMEMORY_BARRIER();
+
+			uxTail++;
+			if( uxTail == ( pxQueue->uxLength * ( UBaseType_t ) 2 ) )
 			{
-				/* The mutex is no longer being held. */
-				xReturn = xTaskPriorityDisinherit( pxQueue->u.xSemaphore.xMutexHolder );
-				pxQueue->u.xSemaphore.xMutexHolder = NULL;
+				uxTail = ( UBaseType_t ) 0U;
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
-		}
-		#endif /* configUSE_MUTEXES */
-	}
-	else if( xPosition == queueSEND_TO_BACK )
-	{
-		( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports, plus previous logic ensures a null pointer can only be passed to memcpy() if the copy size is 0.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
-		pxQueue->pcWriteTo += pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
-		if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
-		{
-			pxQueue->pcWriteTo = pxQueue->pcHead;
+
+			pxQueue->uxTail = uxTail;
+			xReturn = pdTRUE;
 		}
 		else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			xReturn = pdFALSE;
 		}
+
+		return xReturn;
 	}
-	else
+
+#endif /* configUSE_SPSC_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_SPSC_QUEUES == 1 )
+
+	BaseType_t xQueueSPSCSend( SPSCQueueHandle_t xQueue, const void * const pvItemToQueue )
 	{
-		( void ) memcpy( ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e9087 !e418 MISRA exception as the casts are only redundant for some ports.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes.  Assert checks null pointer only used when length is 0. */
-		pxQueue->u.xQueue.pcReadFrom -= pxQueue->uxItemSize;
-		if( pxQueue->u.xQueue.pcReadFrom < pxQueue->pcHead ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
-		{
-			pxQueue->u.xQueue.pcReadFrom = ( pxQueue->u.xQueue.pcTail - pxQueue->uxItemSize );
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
+	SPSCQueue_t * const pxQueue = xQueue;
+	TaskHandle_t xTaskToNotify;
+	BaseType_t xReturn;
 
-		if( xPosition == queueOVERWRITE )
+		configASSERT( pxQueue );
+		configASSERT( pvItemToQueue );
+
+		xReturn = prvSPSCWrite( pxQueue, pvItemToQueue );
+
+		if( xReturn != pdFALSE )
 		{
-			if( uxMessagesWaiting > ( UBaseType_t ) 0 )
+			traceQUEUE_SEND( pxQueue );
+
+			xTaskToNotify = pxQueue->xTaskWaitingToReceive;
+
+			if( xTaskToNotify != NULL )
 			{
-				/* An item is not being added but overwritten, so subtract
-				one from the recorded number of items in the queue so when
-				one is added again below the number of recorded items remains
-				correct. */
-				--uxMessagesWaiting;
+				( void ) xTaskNotifyIndexed( xTaskToNotify, configKERNEL_NOTIFICATION_INDEX, ( uint32_t ) 0, eNoAction );
 			}
 			else
 			{
@@ -2140,287 +5067,415 @@ UBaseType_t uxMessagesWaiting;
 		}
 		else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			traceQUEUE_SEND_FAILED( pxQueue );
 		}
-	}
 
-	pxQueue->uxMessagesWaiting = uxMessagesWaiting + ( UBaseType_t ) 1;
+		return xReturn;
+	}
 
-	return xReturn;
-}
+#endif /* configUSE_SPSC_QUEUES */
 /*-----------------------------------------------------------*/
 
-static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer )
-{
-	if( pxQueue->uxItemSize != ( UBaseType_t ) 0 )
+#if( configUSE_SPSC_QUEUES == 1 )
+
+	BaseType_t xQueueSPSCSendFromISR( SPSCQueueHandle_t xQueue, const void * const pvItemToQueue, BaseType_t * const pxHigherPriorityTaskWoken )
 	{
-		pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize; /*lint !e9016 Pointer arithmetic on char types ok, especially in this use case where it is the clearest way of conveying intent. */
-		if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
+	SPSCQueue_t * const pxQueue = xQueue;
+	TaskHandle_t xTaskToNotify;
+	BaseType_t xReturn;
+
+		configASSERT( pxQueue );
+		configASSERT( pvItemToQueue );
+
+		/* See the comments in xQueueGenericSendFromISR() regarding interrupt
+		priorities.  No interrupt masking is needed to add the item itself. */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		xReturn = prvSPSCWrite( pxQueue, pvItemToQueue );
+
+		if( xReturn != pdFALSE )
 		{
-			pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+			traceQUEUE_SEND_FROM_ISR( pxQueue );
+
+			/* Interrupts are only masked, inside the notify function, if the
+			consumer is actually waiting. */
+			xTaskToNotify = pxQueue->xTaskWaitingToReceive;
+
+			if( xTaskToNotify != NULL )
+			{
+				( void ) xTaskNotifyIndexedFromISR( xTaskToNotify, configKERNEL_NOTIFICATION_INDEX, ( uint32_t ) 0, eNoAction, pxHigherPriorityTaskWoken );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
 		else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
 		}
-		( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 !e418 !e9087 MISRA exception as the casts are only redundant for some ports.  Also previous logic ensures a null pointer can only be passed to memcpy() when the count is 0.  Cast to void required by function signature and safe as no alignment requirement and copy length specified in bytes. */
+
+		return xReturn;
 	}
-}
+
+#endif /* configUSE_SPSC_QUEUES */
 /*-----------------------------------------------------------*/
 
-static void prvUnlockQueue( Queue_t * const pxQueue )
-{
-	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
+#if( configUSE_SPSC_QUEUES == 1 )
 
-	/* The lock counts contains the number of extra data items placed or
-	removed from the queue while the queue was locked.  When a queue is
-	locked items can be added or removed, but the event lists cannot be
-	updated. */
-	taskENTER_CRITICAL();
+	BaseType_t xQueueSPSCReceive( SPSCQueueHandle_t xQueue, void * const pvBuffer, TickType_t xTicksToWait )
 	{
-		int8_t cTxLock = pxQueue->cTxLock;
+	SPSCQueue_t * const pxQueue = xQueue;
+	TimeOut_t xTimeOut;
+	BaseType_t xReturn;
 
-		/* See if data was added to the queue while it was locked. */
-		while( cTxLock > queueLOCKED_UNMODIFIED )
+		configASSERT( pxQueue );
+		configASSERT( pvBuffer );
+
+		/* Cannot block if the scheduler is suspended. */
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 		{
-			/* Data was posted while the queue was locked.  Are any tasks
-			blocked waiting for data to become available? */
-			#if ( configUSE_QUEUE_SETS == 1 )
+			configASSERT( !( ( xTicksToWait != 0 ) && ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) ) );
+		}
+		#endif
+
+		vTaskSetTimeOutState( &xTimeOut );
+
+		for( ;; )
+		{
+			xReturn = prvSPSCRead( pxQueue, pvBuffer );
+
+			if( ( xReturn != pdFALSE ) || ( xTicksToWait == ( TickType_t ) 0 ) )
 			{
-				if( pxQueue->pxQueueSetContainer != NULL )
-				{
-					if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
-					{
-						/* The queue is a member of a queue set, and posting to
-						the queue set caused a higher priority task to unblock.
-						A context switch is required. */
-						vTaskMissedYield();
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-				else
-				{
-					/* Tasks that are removed from the event list will get
-					added to the pending ready list as the scheduler is still
-					suspended. */
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
-					{
-						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
-						{
-							/* The task waiting has a higher priority so record that a
-							context	switch is required. */
-							vTaskMissedYield();
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
-					}
-					else
-					{
-						break;
-					}
-				}
+				break;
 			}
-			#else /* configUSE_QUEUE_SETS */
+
+			/* Clear any stale notification, register as the waiting task,
+			then check for an item again - the producer publishes the item
+			before it reads xTaskWaitingToReceive, so either the item is seen
+			here or the producer sends a notification. */
+			( void ) xTaskNotifyStateClearIndexed( NULL, configKERNEL_NOTIFICATION_INDEX );
+			pxQueue->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+			portMEMORY_BARRIER();
+
+			if( pxQueue->uxHead == pxQueue->uxTail )
 			{
-				/* Tasks that are removed from the event list will get added to
-				the pending ready list as the scheduler is still suspended. */
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
-				{
-					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
-					{
-						/* The task waiting has a higher priority so record that
-						a context switch is required. */
-						vTaskMissedYield();
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-				else
-				{
-					break;
-				}
+				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+				( void ) xTaskNotifyWaitIndexed( configKERNEL_NOTIFICATION_INDEX, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
 			}
-			#endif /* configUSE_QUEUE_SETS */
 
-			--cTxLock;
+			pxQueue->xTaskWaitingToReceive = NULL;
+
+			/* Sets xTicksToWait to zero if the block time has expired, in
+			which case the queue is checked one final time. */
+			( void ) xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait );
 		}
 
-		pxQueue->cTxLock = queueUNLOCKED;
+		if( xReturn != pdFALSE )
+		{
+			traceQUEUE_RECEIVE( pxQueue );
+		}
+		else
+		{
+			traceQUEUE_RECEIVE_FAILED( pxQueue );
+		}
+
+		return xReturn;
 	}
-	taskEXIT_CRITICAL();
 
-	/* Do the same for the Rx lock. */
-	taskENTER_CRITICAL();
+#endif /* configUSE_SPSC_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_SPSC_QUEUES == 1 )
+
+	UBaseType_t uxQueueSPSCMessagesWaiting( const SPSCQueueHandle_t xQueue )
+	{
+	const SPSCQueue_t * const pxQueue = xQueue;
+
+		configASSERT( pxQueue );
+
+		/* Only a snapshot, as either end may move as soon as it is read. */
+		return prvSPSCItemsWaiting( pxQueue, pxQueue->uxHead, pxQueue->uxTail );
+	}
+
+#endif /* configUSE_SPSC_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_ZERO_COPY_QUEUES == 1 )
+
+	static void prvInitialiseNewZeroCopyQueue( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, uint8_t *pucPoolStorage, ZeroCopyQueue_t *pxNewQueue )
+	{
+	UBaseType_t uxBuffer;
+
+		/* The queue itself only ever holds pointers to buffers in the pool. */
+		prvInitialiseNewQueue( uxQueueLength, ( UBaseType_t ) sizeof( void * ), pucQueueStorage, queueQUEUE_TYPE_BASE, &( pxNewQueue->xQueue ) );
+
+		pxNewQueue->pucPool = pucPoolStorage;
+		pxNewQueue->uxBufferSize = ( UBaseType_t ) queueZERO_COPY_BUFFER_SIZE( uxItemSize );
+		pxNewQueue->pvFreeBuffers = NULL;
+
+		/* Build the free list back to front so buffers are handed out in
+		address order. */
+		for( uxBuffer = uxQueueLength; uxBuffer > ( UBaseType_t ) 0; uxBuffer-- )
+		{
+			prvZeroCopyPushFreeBuffer( pxNewQueue, ( void * ) &( pucPoolStorage[ ( uxBuffer - ( UBaseType_t ) 1 ) * pxNewQueue->uxBufferSize ] ) );
+		}
+	}
+
+#endif /* configUSE_ZERO_COPY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_ZERO_COPY_QUEUES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	ZeroCopyQueueHandle_t xQueueCreateZeroCopyStatic( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, uint8_t *pucPoolStorage, StaticZeroCopyQueue_t *pxStaticQueue )
 	{
-		int8_t cRxLock = pxQueue->cRxLock;
+	ZeroCopyQueue_t *pxNewQueue;
+
+		configASSERT( uxQueueLength > ( UBaseType_t ) 0 );
+		configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+		configASSERT( pucQueueStorage != NULL );
+		configASSERT( pxStaticQueue != NULL );
+
+		/* The free list is threaded through the buffers themselves, so the
+		pool must be suitably aligned. */
+		configASSERT( pucPoolStorage != NULL );
+		configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pucPoolStorage ) & ( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) == 0U );
 
-		while( cRxLock > queueLOCKED_UNMODIFIED )
+		#if( configASSERT_DEFINED == 1 )
 		{
-			if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
-			{
-				if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
-				{
-					vTaskMissedYield();
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+			/* Sanity check that the size of the structure used to declare a
+			variable of type StaticZeroCopyQueue_t equals the size of the real
+			zero copy queue structure. */
+			volatile size_t xSize = sizeof( StaticZeroCopyQueue_t );
+			configASSERT( xSize == sizeof( ZeroCopyQueue_t ) );
+			( void ) xSize; /* Keeps lint quiet when configASSERT() is not defined. */
+		}
+		#endif /* configASSERT_DEFINED */
 
-				--cRxLock;
-			}
-			else
+		pxNewQueue = ( ZeroCopyQueue_t * ) pxStaticQueue; /*lint !e740 !e9087 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
+		if( pxNewQueue != NULL )
+		{
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 			{
-				break;
+				/* Note this queue was allocated statically in case it is later
+				deleted. */
+				pxNewQueue->xQueue.ucStaticallyAllocated = pdTRUE;
 			}
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+			prvInitialiseNewZeroCopyQueue( uxQueueLength, uxItemSize, pucQueueStorage, pucPoolStorage, pxNewQueue );
+		}
+		else
+		{
+			traceQUEUE_CREATE_FAILED( queueQUEUE_TYPE_BASE );
+			mtCOVERAGE_TEST_MARKER();
 		}
 
-		pxQueue->cRxLock = queueUNLOCKED;
+		return pxNewQueue;
 	}
-	taskEXIT_CRITICAL();
-}
+
+#endif /* ( ( configUSE_ZERO_COPY_QUEUES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvIsQueueEmpty( const Queue_t *pxQueue )
-{
-BaseType_t xReturn;
+#if( ( configUSE_ZERO_COPY_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
-	taskENTER_CRITICAL();
+	ZeroCopyQueueHandle_t xQueueCreateZeroCopy( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize )
 	{
-		if( pxQueue->uxMessagesWaiting == ( UBaseType_t )  0 )
+	ZeroCopyQueue_t *pxNewQueue;
+	size_t xStructureSize, xPoolSizeInBytes;
+	uint8_t *pucPoolStorage;
+
+		configASSERT( uxQueueLength > ( UBaseType_t ) 0 );
+		configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+
+		/* The structure, the buffer pool and the queue's storage area for the
+		buffer pointers are allocated in one block.  The structure size is
+		rounded up so the pool that follows it has the alignment returned by
+		pvPortMalloc(). */
+		xStructureSize = ( sizeof( ZeroCopyQueue_t ) + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+		xPoolSizeInBytes = ( size_t ) uxQueueLength * queueZERO_COPY_BUFFER_SIZE( uxItemSize ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+		pxNewQueue = ( ZeroCopyQueue_t * ) pvPortMalloc( xStructureSize + xPoolSizeInBytes + ( ( size_t ) uxQueueLength * sizeof( void * ) ) ); /*lint !e9087 !e9079 see comment above. */
+
+		if( pxNewQueue != NULL )
 		{
-			xReturn = pdTRUE;
+			pucPoolStorage = ( uint8_t * ) pxNewQueue;
+			pucPoolStorage += xStructureSize; /*lint !e9016 Pointer arithmetic allowed on char types, especially when it assists conveying intent. */
+
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				/* Queues can be created either statically or dynamically, so
+				note this queue was created dynamically in case it is later
+				deleted. */
+				pxNewQueue->xQueue.ucStaticallyAllocated = pdFALSE;
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+			prvInitialiseNewZeroCopyQueue( uxQueueLength, uxItemSize, pucPoolStorage + xPoolSizeInBytes, pucPoolStorage, pxNewQueue );
 		}
 		else
 		{
-			xReturn = pdFALSE;
+			traceQUEUE_CREATE_FAILED( queueQUEUE_TYPE_BASE );
+			mtCOVERAGE_TEST_MARKER();
 		}
+
+		return pxNewQueue;
 	}
-	taskEXIT_CRITICAL();
 
-	return xReturn;
-}
+#endif /* ( ( configUSE_ZERO_COPY_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueueIsQueueEmptyFromISR( const QueueHandle_t xQueue )
-{
-BaseType_t xReturn;
-Queue_t * const pxQueue = xQueue;
+#if( configUSE_ZERO_COPY_QUEUES == 1 )
 
-	configASSERT( pxQueue );
-	if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 )
-	{
-		xReturn = pdTRUE;
-	}
-	else
+	void vQueueZeroCopyDelete( ZeroCopyQueueHandle_t xQueue )
 	{
-		xReturn = pdFALSE;
+		configASSERT( xQueue );
+		vQueueDelete( &( xQueue->xQueue ) );
 	}
 
-	return xReturn;
-} /*lint !e818 xQueue could not be pointer to const because it is a typedef. */
+#endif /* configUSE_ZERO_COPY_QUEUES */
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvIsQueueFull( const Queue_t *pxQueue )
-{
-BaseType_t xReturn;
+#if( configUSE_ZERO_COPY_QUEUES == 1 )
 
-	taskENTER_CRITICAL();
+	static void *prvZeroCopyPopFreeBuffer( ZeroCopyQueue_t * const pxQueue )
 	{
-		if( pxQueue->uxMessagesWaiting == pxQueue->uxLength )
+	void *pvBuffer = pxQueue->pvFreeBuffers;
+
+		if( pvBuffer != NULL )
 		{
-			xReturn = pdTRUE;
+			pxQueue->pvFreeBuffers = *( ( void ** ) pvBuffer ); /*lint !e9079 !e9087 Buffers are aligned to portBYTE_ALIGNMENT so can hold a pointer. */
 		}
 		else
 		{
-			xReturn = pdFALSE;
+			mtCOVERAGE_TEST_MARKER();
 		}
+
+		return pvBuffer;
 	}
-	taskEXIT_CRITICAL();
 
-	return xReturn;
-}
+#endif /* configUSE_ZERO_COPY_QUEUES */
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
-{
-BaseType_t xReturn;
-Queue_t * const pxQueue = xQueue;
+#if( configUSE_ZERO_COPY_QUEUES == 1 )
 
-	configASSERT( pxQueue );
-	if( pxQueue->uxMessagesWaiting == pxQueue->uxLength )
+	static void prvZeroCopyPushFreeBuffer( ZeroCopyQueue_t * const pxQueue, void *pvBuffer )
 	{
-		xReturn = pdTRUE;
+		*( ( void ** ) pvBuffer ) = pxQueue->pvFreeBuffers; /*lint !e9079 !e9087 Buffers are aligned to portBYTE_ALIGNMENT so can hold a pointer. */
+		pxQueue->pvFreeBuffers = pvBuffer;
 	}
-	else
+
+#endif /* configUSE_ZERO_COPY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_ZERO_COPY_QUEUES == 1 )
+
+	static BaseType_t prvIsZeroCopyPoolEmpty( ZeroCopyQueue_t *pxQueue )
 	{
-		xReturn = pdFALSE;
+	BaseType_t xReturn;
+
+		taskENTER_CRITICAL();
+		{
+			if( pxQueue->pvFreeBuffers == NULL )
+			{
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				xReturn = pdFALSE;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
 	}
 
-	return xReturn;
-} /*lint !e818 xQueue could not be pointer to const because it is a typedef. */
+#endif /* configUSE_ZERO_COPY_QUEUES */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_CO_ROUTINES == 1 )
+#if( configUSE_ZERO_COPY_QUEUES == 1 )
 
-	BaseType_t xQueueCRSend( QueueHandle_t xQueue, const void *pvItemToQueue, TickType_t xTicksToWait )
+	void *pvQueueZeroCopyAcquire( ZeroCopyQueueHandle_t xQueue, TickType_t xTicksToWait )
 	{
-	BaseType_t xReturn;
-	Queue_t * const pxQueue = xQueue;
+	BaseType_t xEntryTimeSet = pdFALSE;
+	TimeOut_t xTimeOut;
+	ZeroCopyQueue_t * const pxQueue = xQueue;
+	void *pvBuffer;
 
-		/* If the queue is already full we may have to block.  A critical section
-		is required to prevent an interrupt removing something from the queue
-		between the check to see if the queue is full and blocking on the queue. */
-		portDISABLE_INTERRUPTS();
+		configASSERT( pxQueue );
+
+		/* Cannot block if the scheduler is suspended. */
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 		{
-			if( prvIsQueueFull( pxQueue ) != pdFALSE )
+			configASSERT( !( ( xTicksToWait != 0 ) && ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) ) );
+		}
+		#endif
+
+		/*lint -save -e904 This function relaxes the coding standard somewhat to
+		allow return statements within the function itself.  This is done in the
+		interest of execution time efficiency. */
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
 			{
-				/* The queue is full - do we want to block or just leave without
-				posting? */
-				if( xTicksToWait > ( TickType_t ) 0 )
+				/* Is there a free buffer now?  The running task must be the
+				highest priority task wanting a buffer. */
+				pvBuffer = prvZeroCopyPopFreeBuffer( pxQueue );
+
+				if( pvBuffer != NULL )
 				{
-					/* As this is called from a coroutine we cannot block directly, but
-					return indicating that we need to block. */
-					vCoRoutineAddToDelayedList( xTicksToWait, &( pxQueue->xTasksWaitingToSend ) );
-					portENABLE_INTERRUPTS();
-					return errQUEUE_BLOCKED;
+					taskEXIT_CRITICAL();
+					return pvBuffer;
 				}
 				else
 				{
-					portENABLE_INTERRUPTS();
-					return errQUEUE_FULL;
+					if( xTicksToWait == ( TickType_t ) 0 )
+					{
+						/* Every buffer is in use and no block time is specified
+						(or the block time has expired) so leave now. */
+						taskEXIT_CRITICAL();
+						traceQUEUE_SEND_FAILED( &( pxQueue->xQueue ) );
+						return NULL;
+					}
+					else if( xEntryTimeSet == pdFALSE )
+					{
+						vTaskInternalSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else
+					{
+						/* Entry time was already set. */
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
 			}
-		}
-		portENABLE_INTERRUPTS();
+			taskEXIT_CRITICAL();
 
-		portDISABLE_INTERRUPTS();
-		{
-			if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
-			{
-				/* There is room in the queue, copy the data into the queue. */
-				prvCopyDataToQueue( pxQueue, pvItemToQueue, queueSEND_TO_BACK );
-				xReturn = pdPASS;
+			vTaskSuspendAll();
+			prvLockQueue( &( pxQueue->xQueue ) );
 
-				/* Were any co-routines waiting for data to become available? */
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+			/* Update the timeout state to see if it has expired yet. */
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				if( prvIsZeroCopyPoolEmpty( pxQueue ) != pdFALSE )
 				{
-					/* In this instance the co-routine could be placed directly
-					into the ready list as we are within a critical section.
-					Instead the same pending ready list mechanism is used as if
-					the event were caused from within an interrupt. */
-					if( xCoRoutineRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+					/* Wait on the same list as a task waiting for space in a
+					normal queue, so buffers released from an interrupt while
+					the queue is locked are accounted for by cRxLock.  The list
+					is also signalled each time a pointer is received, in which
+					case the task loops and blocks again. */
+					traceBLOCKING_ON_QUEUE_SEND( &( pxQueue->xQueue ) );
+					vTaskPlaceOnEventList( &( pxQueue->xQueue.xTasksWaitingToSend ), xTicksToWait );
+					prvUnlockQueue( &( pxQueue->xQueue ) );
+
+					if( xTaskResumeAll() == pdFALSE )
 					{
-						/* The co-routine waiting has a higher priority so record
-						that a yield might be appropriate. */
-						xReturn = errQUEUE_YIELD;
+						portYIELD_WITHIN_API();
 					}
 					else
 					{
@@ -2429,50 +5484,169 @@ Queue_t * const pxQueue = xQueue;
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					/* Try again. */
+					prvUnlockQueue( &( pxQueue->xQueue ) );
+					( void ) xTaskResumeAll();
 				}
 			}
 			else
 			{
-				xReturn = errQUEUE_FULL;
+				/* The timeout has expired. */
+				prvUnlockQueue( &( pxQueue->xQueue ) );
+				( void ) xTaskResumeAll();
+
+				traceQUEUE_SEND_FAILED( &( pxQueue->xQueue ) );
+				return NULL;
 			}
+		} /*lint -restore */
+	}
+
+#endif /* configUSE_ZERO_COPY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_ZERO_COPY_QUEUES == 1 )
+
+	void *pvQueueZeroCopyAcquireFromISR( ZeroCopyQueueHandle_t xQueue )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+	ZeroCopyQueue_t * const pxQueue = xQueue;
+	void *pvBuffer;
+
+		configASSERT( pxQueue );
+
+		/* See the comments in xQueueGenericSendFromISR() regarding interrupt
+		priorities. */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			pvBuffer = prvZeroCopyPopFreeBuffer( pxQueue );
 		}
-		portENABLE_INTERRUPTS();
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		if( pvBuffer == NULL )
+		{
+			traceQUEUE_SEND_FROM_ISR_FAILED( &( pxQueue->xQueue ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pvBuffer;
+	}
+
+#endif /* configUSE_ZERO_COPY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_ZERO_COPY_QUEUES == 1 )
+
+	BaseType_t xQueueZeroCopyCommit( ZeroCopyQueueHandle_t xQueue, void *pvBuffer )
+	{
+	BaseType_t xReturn;
+
+		configASSERT( xQueue );
+		configASSERT( pvBuffer );
+
+		/* There is a queue slot for every buffer in the pool, so posting the
+		pointer never needs to block. */
+		xReturn = xQueueGenericSend( &( xQueue->xQueue ), ( void * ) &pvBuffer, ( TickType_t ) 0, queueSEND_TO_BACK );
+		configASSERT( xReturn == pdPASS );
 
 		return xReturn;
 	}
 
-#endif /* configUSE_CO_ROUTINES */
+#endif /* configUSE_ZERO_COPY_QUEUES */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_CO_ROUTINES == 1 )
+#if( configUSE_ZERO_COPY_QUEUES == 1 )
 
-	BaseType_t xQueueCRReceive( QueueHandle_t xQueue, void *pvBuffer, TickType_t xTicksToWait )
+	BaseType_t xQueueZeroCopyCommitFromISR( ZeroCopyQueueHandle_t xQueue, void *pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken )
 	{
 	BaseType_t xReturn;
-	Queue_t * const pxQueue = xQueue;
 
-		/* If the queue is already empty we may have to block.  A critical section
-		is required to prevent an interrupt adding something to the queue
-		between the check to see if the queue is empty and blocking on the queue. */
-		portDISABLE_INTERRUPTS();
+		configASSERT( xQueue );
+		configASSERT( pvBuffer );
+
+		xReturn = xQueueGenericSendFromISR( &( xQueue->xQueue ), ( void * ) &pvBuffer, pxHigherPriorityTaskWoken, queueSEND_TO_BACK );
+		configASSERT( xReturn == pdPASS );
+
+		return xReturn;
+	}
+
+#endif /* configUSE_ZERO_COPY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_ZERO_COPY_QUEUES == 1 )
+
+	void *pvQueueZeroCopyReceive( ZeroCopyQueueHandle_t xQueue, TickType_t xTicksToWait )
+	{
+	void *pvBuffer = NULL;
+
+		configASSERT( xQueue );
+
+		if( xQueueReceive( &( xQueue->xQueue ), ( void * ) &pvBuffer, xTicksToWait ) != pdPASS )
+		{
+			pvBuffer = NULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pvBuffer;
+	}
+
+#endif /* configUSE_ZERO_COPY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_ZERO_COPY_QUEUES == 1 )
+
+	void *pvQueueZeroCopyReceiveFromISR( ZeroCopyQueueHandle_t xQueue, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	void *pvBuffer = NULL;
+
+		configASSERT( xQueue );
+
+		if( xQueueReceiveFromISR( &( xQueue->xQueue ), ( void * ) &pvBuffer, pxHigherPriorityTaskWoken ) != pdPASS )
+		{
+			pvBuffer = NULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pvBuffer;
+	}
+
+#endif /* configUSE_ZERO_COPY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_ZERO_COPY_QUEUES == 1 )
+
+	void vQueueZeroCopyRelease( ZeroCopyQueueHandle_t xQueue, void *pvBuffer )
+	{
+	ZeroCopyQueue_t * const pxQueue = xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( ( ( uint8_t * ) pvBuffer >= pxQueue->pucPool ) && ( ( uint8_t * ) pvBuffer < &( pxQueue->pucPool[ pxQueue->xQueue.uxLength * pxQueue->uxBufferSize ] ) ) );
+
+		taskENTER_CRITICAL();
 		{
-			if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 )
+			prvZeroCopyPushFreeBuffer( pxQueue, pvBuffer );
+
+			/* Unblock the highest priority task waiting for a buffer, if
+			any. */
+			if( listLIST_IS_EMPTY( &( pxQueue->xQueue.xTasksWaitingToSend ) ) == pdFALSE )
 			{
-				/* There are no messages in the queue, do we want to block or just
-				leave with nothing? */
-				if( xTicksToWait > ( TickType_t ) 0 )
+				if( xTaskRemoveFromEventList( &( pxQueue->xQueue.xTasksWaitingToSend ) ) != pdFALSE )
 				{
-					/* As this is a co-routine we cannot block directly, but return
-					indicating that we need to block. */
-					vCoRoutineAddToDelayedList( xTicksToWait, &( pxQueue->xTasksWaitingToReceive ) );
-					portENABLE_INTERRUPTS();
-					return errQUEUE_BLOCKED;
+					queueYIELD_IF_USING_PREEMPTION();
 				}
 				else
 				{
-					portENABLE_INTERRUPTS();
-					return errQUEUE_FULL;
+					mtCOVERAGE_TEST_MARKER();
 				}
 			}
 			else
@@ -2480,37 +5654,49 @@ Queue_t * const pxQueue = xQueue;
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-		portENABLE_INTERRUPTS();
+		taskEXIT_CRITICAL();
+	}
 
-		portDISABLE_INTERRUPTS();
+#endif /* configUSE_ZERO_COPY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_ZERO_COPY_QUEUES == 1 )
+
+	void vQueueZeroCopyReleaseFromISR( ZeroCopyQueueHandle_t xQueue, void *pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+	ZeroCopyQueue_t * const pxQueue = xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( ( ( uint8_t * ) pvBuffer >= pxQueue->pucPool ) && ( ( uint8_t * ) pvBuffer < &( pxQueue->pucPool[ pxQueue->xQueue.uxLength * pxQueue->uxBufferSize ] ) ) );
+
+		/* See the comments in xQueueGenericSendFromISR() regarding interrupt
+		priorities. */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 		{
-			if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
-			{
-				/* Data is available from the queue. */
-				pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
-				if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
-				{
-					pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
-				--( pxQueue->uxMessagesWaiting );
-				( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
+			const int8_t cRxLock = pxQueue->xQueue.cRxLock;
 
-				xReturn = pdPASS;
+			prvZeroCopyPushFreeBuffer( pxQueue, pvBuffer );
 
-				/* Were any co-routines waiting for space to become available? */
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+			/* If the queue is locked the event list will not be modified.
+			Instead update the lock count so the task that unlocks the queue
+			will unblock a task waiting for a buffer. */
+			if( cRxLock == queueUNLOCKED )
+			{
+				if( listLIST_IS_EMPTY( &( pxQueue->xQueue.xTasksWaitingToSend ) ) == pdFALSE )
 				{
-					/* In this instance the co-routine could be placed directly
-					into the ready list as we are within a critical section.
-					Instead the same pending ready list mechanism is used as if
-					the event were caused from within an interrupt. */
-					if( xCoRoutineRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+					if( xTaskRemoveFromEventList( &( pxQueue->xQueue.xTasksWaitingToSend ) ) != pdFALSE )
 					{
-						xReturn = errQUEUE_YIELD;
+						if( pxHigherPriorityTaskWoken != NULL )
+						{
+							*pxHigherPriorityTaskWoken = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
 					}
 					else
 					{
@@ -2524,101 +5710,172 @@ Queue_t * const pxQueue = xQueue;
 			}
 			else
 			{
-				xReturn = pdFAIL;
+				pxQueue->xQueue.cRxLock = ( int8_t ) ( cRxLock + 1 );
 			}
 		}
-		portENABLE_INTERRUPTS();
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
 
-		return xReturn;
+#endif /* configUSE_ZERO_COPY_QUEUES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_RW_LOCKS == 1 )
+
+	static void prvInitialiseNewRWLock( const UBaseType_t uxMaxReaders, TaskHandle_t *pxReaderStorage, RWLock_t *pxNewRWLock )
+	{
+		vListInitialise( &( pxNewRWLock->xTasksWaitingToRead ) );
+		vListInitialise( &( pxNewRWLock->xTasksWaitingToWrite ) );
+		pxNewRWLock->xWriter = NULL;
+		pxNewRWLock->pxReaders = pxReaderStorage;
+		pxNewRWLock->uxReaders = ( UBaseType_t ) 0U;
+		pxNewRWLock->uxMaxReaders = uxMaxReaders;
 	}
 
-#endif /* configUSE_CO_ROUTINES */
+#endif /* configUSE_RW_LOCKS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_CO_ROUTINES == 1 )
+#if( ( configUSE_RW_LOCKS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
 
-	BaseType_t xQueueCRSendFromISR( QueueHandle_t xQueue, const void *pvItemToQueue, BaseType_t xCoRoutinePreviouslyWoken )
+	RWLockHandle_t xQueueCreateRWLockStatic( const UBaseType_t uxMaxReaders, TaskHandle_t *pxReaderBuffer, StaticRWLock_t *pxStaticRWLock )
 	{
-	Queue_t * const pxQueue = xQueue;
+	RWLock_t *pxNewRWLock;
 
-		/* Cannot block within an ISR so if there is no space on the queue then
-		exit without doing anything. */
-		if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
+		configASSERT( uxMaxReaders > ( UBaseType_t ) 0 );
+		configASSERT( pxReaderBuffer != NULL );
+		configASSERT( pxStaticRWLock != NULL );
+
+		#if( configASSERT_DEFINED == 1 )
 		{
-			prvCopyDataToQueue( pxQueue, pvItemToQueue, queueSEND_TO_BACK );
+			/* Sanity check that the size of the structure used to declare a
+			variable of type StaticRWLock_t equals the size of the real lock
+			structure. */
+			volatile size_t xSize = sizeof( StaticRWLock_t );
+			configASSERT( xSize == sizeof( RWLock_t ) );
+			( void ) xSize; /* Keeps lint quiet when configASSERT() is not defined. */
+		}
+		#endif /* configASSERT_DEFINED */
 
-			/* We only want to wake one co-routine per ISR, so check that a
-			co-routine has not already been woken. */
-			if( xCoRoutinePreviouslyWoken == pdFALSE )
+		pxNewRWLock = ( RWLock_t * ) pxStaticRWLock; /*lint !e740 !e9087 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
+		if( pxNewRWLock != NULL )
+		{
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 			{
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
-				{
-					if( xCoRoutineRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
-					{
-						return pdTRUE;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+				/* Note this lock was allocated statically in case it is later
+				deleted. */
+				pxNewRWLock->ucStaticallyAllocated = pdTRUE;
 			}
-			else
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+			prvInitialiseNewRWLock( uxMaxReaders, pxReaderBuffer, pxNewRWLock );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pxNewRWLock;
+	}
+
+#endif /* ( ( configUSE_RW_LOCKS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_RW_LOCKS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	RWLockHandle_t xQueueCreateRWLock( const UBaseType_t uxMaxReaders )
+	{
+	RWLock_t *pxNewRWLock;
+	uint8_t *pucReaderStorage;
+
+		configASSERT( uxMaxReaders > ( UBaseType_t ) 0 );
+
+		/* The structure and the table of reading tasks are allocated in one
+		block.  The structure contains pointers so its size is a multiple of
+		the alignment required by the table that follows it. */
+		pxNewRWLock = ( RWLock_t * ) pvPortMalloc( sizeof( RWLock_t ) + ( ( size_t ) uxMaxReaders * sizeof( TaskHandle_t ) ) ); /*lint !e9087 !e9079 see comment above. */
+
+		if( pxNewRWLock != NULL )
+		{
+			pucReaderStorage = ( uint8_t * ) pxNewRWLock;
+			pucReaderStorage += sizeof( RWLock_t ); /*lint !e9016 Pointer arithmetic allowed on char types, especially when it assists conveying intent. */
+
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{
-				mtCOVERAGE_TEST_MARKER();
+				/* Locks can be created either statically or dynamically, so
+				note this lock was created dynamically in case it is later
+				deleted. */
+				pxNewRWLock->ucStaticallyAllocated = pdFALSE;
 			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+			prvInitialiseNewRWLock( uxMaxReaders, ( TaskHandle_t * ) pucReaderStorage, pxNewRWLock ); /*lint !e9087 !e740 The table follows the structure in the same block. */
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
 
-		return xCoRoutinePreviouslyWoken;
+		return pxNewRWLock;
 	}
 
-#endif /* configUSE_CO_ROUTINES */
+#endif /* ( ( configUSE_RW_LOCKS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_CO_ROUTINES == 1 )
+#if( configUSE_RW_LOCKS == 1 )
 
-	BaseType_t xQueueCRReceiveFromISR( QueueHandle_t xQueue, void *pvBuffer, BaseType_t *pxCoRoutineWoken )
+	void vQueueDeleteRWLock( RWLockHandle_t xRWLock )
 	{
-	BaseType_t xReturn;
-	Queue_t * const pxQueue = xQueue;
+	RWLock_t * const pxRWLock = xRWLock;
 
-		/* We cannot block from an ISR, so check there is data available. If
-		not then just leave without doing anything. */
-		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+		configASSERT( pxRWLock );
+
+		/* A lock cannot be deleted while it is held or while tasks are blocked
+		on it. */
+		configASSERT( pxRWLock->xWriter == NULL );
+		configASSERT( pxRWLock->uxReaders == ( UBaseType_t ) 0 );
+		configASSERT( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToRead ) ) != pdFALSE );
+		configASSERT( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToWrite ) ) != pdFALSE );
+
+		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
 		{
-			/* Copy the data from the queue. */
-			pxQueue->u.xQueue.pcReadFrom += pxQueue->uxItemSize;
-			if( pxQueue->u.xQueue.pcReadFrom >= pxQueue->u.xQueue.pcTail )
+			vPortFree( pxRWLock );
+		}
+		#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+		{
+			if( pxRWLock->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
 			{
-				pxQueue->u.xQueue.pcReadFrom = pxQueue->pcHead;
+				vPortFree( pxRWLock );
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
-			--( pxQueue->uxMessagesWaiting );
-			( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
+		}
+		#else
+		{
+			/* The lock must have been statically allocated, so is not going
+			to be deleted. */
+			( void ) pxRWLock;
+		}
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+	}
 
-			if( ( *pxCoRoutineWoken ) == pdFALSE )
+#endif /* configUSE_RW_LOCKS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_RW_LOCKS == 1 )
+
+	static BaseType_t prvRWLockIsAvailable( const RWLock_t * const pxRWLock, const BaseType_t xExclusive )
+	{
+	BaseType_t xReturn = pdFALSE;
+
+		if( pxRWLock->xWriter == NULL )
+		{
+			if( xExclusive != pdFALSE )
 			{
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				if( pxRWLock->uxReaders == ( UBaseType_t ) 0 )
 				{
-					if( xCoRoutineRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
-					{
-						*pxCoRoutineWoken = pdTRUE;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					xReturn = pdTRUE;
 				}
 				else
 				{
@@ -2627,291 +5884,432 @@ Queue_t * const pxQueue = xQueue;
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				/* Writers are preferred, so a new reader must queue behind
+				any writer that is already waiting. */
+				if( ( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToWrite ) ) != pdFALSE ) && ( pxRWLock->uxReaders < pxRWLock->uxMaxReaders ) )
+				{
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
-
-			xReturn = pdPASS;
 		}
 		else
 		{
-			xReturn = pdFAIL;
+			mtCOVERAGE_TEST_MARKER();
 		}
 
 		return xReturn;
 	}
 
-#endif /* configUSE_CO_ROUTINES */
+#endif /* configUSE_RW_LOCKS */
 /*-----------------------------------------------------------*/
 
-#if ( configQUEUE_REGISTRY_SIZE > 0 )
+#if( configUSE_RW_LOCKS == 1 )
 
-	void vQueueAddToRegistry( QueueHandle_t xQueue, const char *pcQueueName ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	static BaseType_t prvRWLockIsHeldBy( const RWLock_t * const pxRWLock, const BaseType_t xExclusive, const TaskHandle_t xTask )
 	{
-	UBaseType_t ux;
+	BaseType_t xReturn = pdFALSE;
+	UBaseType_t uxReader;
 
-		/* See if there is an empty space in the registry.  A NULL name denotes
-		a free slot. */
-		for( ux = ( UBaseType_t ) 0U; ux < ( UBaseType_t ) configQUEUE_REGISTRY_SIZE; ux++ )
+		if( xExclusive != pdFALSE )
 		{
-			if( xQueueRegistry[ ux ].pcQueueName == NULL )
+			if( pxRWLock->xWriter == xTask )
 			{
-				/* Store the information on this queue. */
-				xQueueRegistry[ ux ].pcQueueName = pcQueueName;
-				xQueueRegistry[ ux ].xHandle = xQueue;
-
-				traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName );
-				break;
+				xReturn = pdTRUE;
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-	}
-
-#endif /* configQUEUE_REGISTRY_SIZE */
-/*-----------------------------------------------------------*/
-
-#if ( configQUEUE_REGISTRY_SIZE > 0 )
-
-	const char *pcQueueGetName( QueueHandle_t xQueue ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-	{
-	UBaseType_t ux;
-	const char *pcReturn = NULL; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-
-		/* Note there is nothing here to protect against another task adding or
-		removing entries from the registry while it is being searched. */
-		for( ux = ( UBaseType_t ) 0U; ux < ( UBaseType_t ) configQUEUE_REGISTRY_SIZE; ux++ )
+		else
 		{
-			if( xQueueRegistry[ ux ].xHandle == xQueue )
-			{
-				pcReturn = xQueueRegistry[ ux ].pcQueueName;
-				break;
-			}
-			else
+			for( uxReader = ( UBaseType_t ) 0; uxReader < pxRWLock->uxReaders; uxReader++ )
 			{
-				mtCOVERAGE_TEST_MARKER();
+				if( pxRWLock->pxReaders[ uxReader ] == xTask )
+				{
+					xReturn = pdTRUE;
+					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 		}
 
-		return pcReturn;
-	} /*lint !e818 xQueue cannot be a pointer to const because it is a typedef. */
+		return xReturn;
+	}
 
-#endif /* configQUEUE_REGISTRY_SIZE */
+#endif /* configUSE_RW_LOCKS */
 /*-----------------------------------------------------------*/
 
-#if ( configQUEUE_REGISTRY_SIZE > 0 )
+#if( configUSE_RW_LOCKS == 1 )
 
-	void vQueueUnregisterQueue( QueueHandle_t xQueue )
+	static BaseType_t prvRWLockInherit( const RWLock_t * const pxRWLock )
 	{
-	UBaseType_t ux;
+	BaseType_t xReturn = pdFALSE;
+	UBaseType_t uxReader;
 
-		/* See if the handle of the queue being unregistered in actually in the
-		registry. */
-		for( ux = ( UBaseType_t ) 0U; ux < ( UBaseType_t ) configQUEUE_REGISTRY_SIZE; ux++ )
+		if( pxRWLock->xWriter != NULL )
 		{
-			if( xQueueRegistry[ ux ].xHandle == xQueue )
-			{
-				/* Set the name to NULL to show that this slot if free again. */
-				xQueueRegistry[ ux ].pcQueueName = NULL;
-
-				/* Set the handle to NULL to ensure the same queue handle cannot
-				appear in the registry twice if it is added, removed, then
-				added again. */
-				xQueueRegistry[ ux ].xHandle = ( QueueHandle_t ) 0;
-				break;
-			}
-			else
+			xReturn = xTaskPriorityInherit( pxRWLock->xWriter );
+		}
+		else
+		{
+			/* The lock is held for reading, so every reader is holding up the
+			calling task. */
+			for( uxReader = ( UBaseType_t ) 0; uxReader < pxRWLock->uxReaders; uxReader++ )
 			{
-				mtCOVERAGE_TEST_MARKER();
+				if( xTaskPriorityInherit( pxRWLock->pxReaders[ uxReader ] ) != pdFALSE )
+				{
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 		}
 
-	} /*lint !e818 xQueue could not be pointer to const because it is a typedef. */
+		return xReturn;
+	}
 
-#endif /* configQUEUE_REGISTRY_SIZE */
+#endif /* configUSE_RW_LOCKS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TIMERS == 1 )
+#if( configUSE_RW_LOCKS == 1 )
 
-	void vQueueWaitForMessageRestricted( QueueHandle_t xQueue, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely )
+	static void prvRWLockDisinheritAfterTimeout( const RWLock_t * const pxRWLock )
 	{
-	Queue_t * const pxQueue = xQueue;
-
-		/* This function should not be called by application code hence the
-		'Restricted' in its name.  It is not part of the public API.  It is
-		designed for use by kernel code, and has special calling requirements.
-		It can result in vListInsert() being called on a list that can only
-		possibly ever have one item in it, so the list will be fast, but even
-		so it should be called with the scheduler locked and not from a critical
-		section. */
+	UBaseType_t uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY, uxPriority, uxReader;
 
-		/* Only do anything if there are no messages in the queue.  This function
-		will not actually cause the task to block, just place it on a blocked
-		list.  It will not block until the scheduler is unlocked - at which
-		time a yield will be performed.  If an item is added to the queue while
-		the queue is locked, and the calling task blocks on the queue, then the
-		calling task will be immediately unblocked when the queue is unlocked. */
-		prvLockQueue( pxQueue );
-		if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0U )
+		/* The holders should disinherit the priority of the task that timed
+		out, but only down to the highest priority of any task still waiting
+		for the lock, whichever list that task is waiting on. */
+		if( listCURRENT_LIST_LENGTH( &( pxRWLock->xTasksWaitingToWrite ) ) > 0U )
 		{
-			/* There is nothing in the queue, block for the specified period. */
-			vTaskPlaceOnEventListRestricted( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait, xWaitIndefinitely );
+			uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxRWLock->xTasksWaitingToWrite ) );
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
-		prvUnlockQueue( pxQueue );
-	}
-
-#endif /* configUSE_TIMERS */
-/*-----------------------------------------------------------*/
-
-#if( ( configUSE_QUEUE_SETS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
-	QueueSetHandle_t xQueueCreateSet( const UBaseType_t uxEventQueueLength )
-	{
-	QueueSetHandle_t pxQueue;
+		if( listCURRENT_LIST_LENGTH( &( pxRWLock->xTasksWaitingToRead ) ) > 0U )
+		{
+			uxPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxRWLock->xTasksWaitingToRead ) );
 
-		pxQueue = xQueueGenericCreate( uxEventQueueLength, ( UBaseType_t ) sizeof( Queue_t * ), queueQUEUE_TYPE_SET );
+			if( uxPriority > uxHighestPriorityOfWaitingTasks )
+			{
+				uxHighestPriorityOfWaitingTasks = uxPriority;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-		return pxQueue;
+		if( pxRWLock->xWriter != NULL )
+		{
+			vTaskPriorityDisinheritAfterTimeout( pxRWLock->xWriter, uxHighestPriorityOfWaitingTasks );
+		}
+		else
+		{
+			for( uxReader = ( UBaseType_t ) 0; uxReader < pxRWLock->uxReaders; uxReader++ )
+			{
+				vTaskPriorityDisinheritAfterTimeout( pxRWLock->pxReaders[ uxReader ], uxHighestPriorityOfWaitingTasks );
+			}
+		}
 	}
 
-#endif /* configUSE_QUEUE_SETS */
+#endif /* configUSE_RW_LOCKS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_QUEUE_SETS == 1 )
+#if( configUSE_RW_LOCKS == 1 )
 
-	BaseType_t xQueueAddToSet( QueueSetMemberHandle_t xQueueOrSemaphore, QueueSetHandle_t xQueueSet )
+	static BaseType_t prvRWLockHandOver( RWLock_t * const pxRWLock )
 	{
-	BaseType_t xReturn;
+	TaskHandle_t xTask;
+	BaseType_t xReturn = pdFALSE;
 
-		taskENTER_CRITICAL();
+		if( pxRWLock->xWriter == NULL )
 		{
-			if( ( ( Queue_t * ) xQueueOrSemaphore )->pxQueueSetContainer != NULL )
-			{
-				/* Cannot add a queue/semaphore to more than one queue set. */
-				xReturn = pdFAIL;
-			}
-			else if( ( ( Queue_t * ) xQueueOrSemaphore )->uxMessagesWaiting != ( UBaseType_t ) 0 )
+			if( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToWrite ) ) == pdFALSE )
 			{
-				/* Cannot add a queue/semaphore to a queue set if there are already
-				items in the queue/semaphore. */
-				xReturn = pdFAIL;
+				/* The highest priority writer is given the lock as soon as
+				the last reader has released it. */
+				if( pxRWLock->uxReaders == ( UBaseType_t ) 0 )
+				{
+					xTask = ( TaskHandle_t ) listGET_OWNER_OF_HEAD_ENTRY( &( pxRWLock->xTasksWaitingToWrite ) ); /*lint !e9079 The owner of an event list item is always a task. */
+					pxRWLock->xWriter = xTask;
+					vTaskIncrementMutexHeldCount( xTask );
+					xReturn = xTaskRemoveFromEventList( &( pxRWLock->xTasksWaitingToWrite ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 			else
 			{
-				( ( Queue_t * ) xQueueOrSemaphore )->pxQueueSetContainer = xQueueSet;
-				xReturn = pdPASS;
+				/* No writer is waiting, so admit as many waiting readers as
+				the reader table can hold, highest priority first. */
+				while( ( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToRead ) ) == pdFALSE ) && ( pxRWLock->uxReaders < pxRWLock->uxMaxReaders ) )
+				{
+					xTask = ( TaskHandle_t ) listGET_OWNER_OF_HEAD_ENTRY( &( pxRWLock->xTasksWaitingToRead ) ); /*lint !e9079 The owner of an event list item is always a task. */
+					pxRWLock->pxReaders[ pxRWLock->uxReaders ] = xTask;
+					( pxRWLock->uxReaders )++;
+					vTaskIncrementMutexHeldCount( xTask );
+
+					if( xTaskRemoveFromEventList( &( pxRWLock->xTasksWaitingToRead ) ) != pdFALSE )
+					{
+						xReturn = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
 			}
 		}
-		taskEXIT_CRITICAL();
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
 		return xReturn;
 	}
 
-#endif /* configUSE_QUEUE_SETS */
+#endif /* configUSE_RW_LOCKS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_QUEUE_SETS == 1 )
+#if( configUSE_RW_LOCKS == 1 )
 
-	BaseType_t xQueueRemoveFromSet( QueueSetMemberHandle_t xQueueOrSemaphore, QueueSetHandle_t xQueueSet )
+	BaseType_t xQueueTakeRWLock( RWLockHandle_t xRWLock, const BaseType_t xExclusive, TickType_t xTicksToWait )
 	{
-	BaseType_t xReturn;
-	Queue_t * const pxQueueOrSemaphore = ( Queue_t * ) xQueueOrSemaphore;
+	RWLock_t * const pxRWLock = xRWLock;
+	BaseType_t xEntryTimeSet = pdFALSE, xInheritanceOccurred = pdFALSE, xYieldRequired;
+	TimeOut_t xTimeOut;
+	TaskHandle_t xHolder;
+	List_t *pxWaitingList;
 
-		if( pxQueueOrSemaphore->pxQueueSetContainer != xQueueSet )
+		configASSERT( pxRWLock );
+
+		/* Cannot block if the scheduler is suspended. */
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 		{
-			/* The queue was not a member of the set. */
-			xReturn = pdFAIL;
+			configASSERT( !( ( xTicksToWait != 0 ) && ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) ) );
 		}
-		else if( pxQueueOrSemaphore->uxMessagesWaiting != ( UBaseType_t ) 0 )
+		#endif
+
+		if( xExclusive != pdFALSE )
 		{
-			/* It is dangerous to remove a queue from a set when the queue is
-			not empty because the queue set will still hold pending events for
-			the queue. */
-			xReturn = pdFAIL;
+			pxWaitingList = &( pxRWLock->xTasksWaitingToWrite );
 		}
 		else
+		{
+			pxWaitingList = &( pxRWLock->xTasksWaitingToRead );
+		}
+
+		/*lint -save -e904 This function relaxes the coding standard somewhat to
+		allow return statements within the function itself.  This is done in the
+		interest of execution time efficiency. */
+		for( ;; )
 		{
 			taskENTER_CRITICAL();
 			{
-				/* The queue is no longer contained in the set. */
-				pxQueueOrSemaphore->pxQueueSetContainer = NULL;
-			}
-			taskEXIT_CRITICAL();
-			xReturn = pdPASS;
-		}
+				/* A task that was blocked on the lock is given the lock by the
+				task that released it, so does not need to take it again. */
+				if( ( xEntryTimeSet != pdFALSE ) && ( prvRWLockIsHeldBy( pxRWLock, xExclusive, xTaskGetCurrentTaskHandle() ) != pdFALSE ) )
+				{
+					taskEXIT_CRITICAL();
+					return pdPASS;
+				}
+				else if( prvRWLockIsAvailable( pxRWLock, xExclusive ) != pdFALSE )
+				{
+					/* Record the holder so it can inherit the priority of any
+					task that later blocks on the lock. */
+					xHolder = pvTaskIncrementMutexHeldCount();
 
-		return xReturn;
-	} /*lint !e818 xQueueSet could not be declared as pointing to const as it is a typedef. */
+					if( xExclusive != pdFALSE )
+					{
+						pxRWLock->xWriter = xHolder;
+					}
+					else
+					{
+						pxRWLock->pxReaders[ pxRWLock->uxReaders ] = xHolder;
+						( pxRWLock->uxReaders )++;
+					}
 
-#endif /* configUSE_QUEUE_SETS */
-/*-----------------------------------------------------------*/
+					taskEXIT_CRITICAL();
+					return pdPASS;
+				}
+				else if( xTicksToWait == ( TickType_t ) 0 )
+				{
+					if( xInheritanceOccurred != pdFALSE )
+					{
+						/* The task timed out after raising the priority of the
+						holders, so lower it again. */
+						prvRWLockDisinheritAfterTimeout( pxRWLock );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 
-#if ( configUSE_QUEUE_SETS == 1 )
+					if( xEntryTimeSet != pdFALSE )
+					{
+						/* A writer that stops waiting may have been all that
+						was holding waiting readers back. */
+						xYieldRequired = prvRWLockHandOver( pxRWLock );
+					}
+					else
+					{
+						xYieldRequired = pdFALSE;
+					}
 
-	QueueSetMemberHandle_t xQueueSelectFromSet( QueueSetHandle_t xQueueSet, TickType_t const xTicksToWait )
-	{
-	QueueSetMemberHandle_t xReturn = NULL;
+					taskEXIT_CRITICAL();
 
-		( void ) xQueueReceive( ( QueueHandle_t ) xQueueSet, &xReturn, xTicksToWait ); /*lint !e961 Casting from one typedef to another is not redundant. */
-		return xReturn;
-	}
+					if( xYieldRequired != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 
-#endif /* configUSE_QUEUE_SETS */
-/*-----------------------------------------------------------*/
+					return pdFAIL;
+				}
+				else if( xEntryTimeSet == pdFALSE )
+				{
+					/* A task cannot wait for a lock it already holds, whether
+					to take it again or to upgrade a read lock to a write
+					lock. */
+					configASSERT( pxRWLock->xWriter != xTaskGetCurrentTaskHandle() );
+					configASSERT( prvRWLockIsHeldBy( pxRWLock, pdFALSE, xTaskGetCurrentTaskHandle() ) == pdFALSE );
 
-#if ( configUSE_QUEUE_SETS == 1 )
+					vTaskInternalSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					/* Entry time was already set. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
 
-	QueueSetMemberHandle_t xQueueSelectFromSetFromISR( QueueSetHandle_t xQueueSet )
-	{
-	QueueSetMemberHandle_t xReturn = NULL;
+			/* Interrupts cannot use the lock, so suspending the scheduler is
+			enough to keep the lock state and the waiting lists stable while
+			this task blocks. */
+			vTaskSuspendAll();
 
-		( void ) xQueueReceiveFromISR( ( QueueHandle_t ) xQueueSet, &xReturn, NULL ); /*lint !e961 Casting from one typedef to another is not redundant. */
-		return xReturn;
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				if( prvRWLockIsAvailable( pxRWLock, xExclusive ) == pdFALSE )
+				{
+					taskENTER_CRITICAL();
+					{
+						if( prvRWLockInherit( pxRWLock ) != pdFALSE )
+						{
+							xInheritanceOccurred = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					taskEXIT_CRITICAL();
+
+					vTaskPlaceOnEventList( pxWaitingList, xTicksToWait );
+
+					if( xTaskResumeAll() == pdFALSE )
+					{
+						portYIELD_WITHIN_API();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* The lock was released before the scheduler was
+					suspended.  Try again. */
+					( void ) xTaskResumeAll();
+				}
+			}
+			else
+			{
+				/* Timed out.  xTicksToWait is now zero, so the next iteration
+				either takes the lock or returns. */
+				( void ) xTaskResumeAll();
+			}
+		} /*lint -restore */
 	}
 
-#endif /* configUSE_QUEUE_SETS */
+#endif /* configUSE_RW_LOCKS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_QUEUE_SETS == 1 )
+#if( configUSE_RW_LOCKS == 1 )
 
-	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue )
+	BaseType_t xQueueGiveRWLock( RWLockHandle_t xRWLock )
 	{
-	Queue_t *pxQueueSetContainer = pxQueue->pxQueueSetContainer;
-	BaseType_t xReturn = pdFALSE;
-
-		/* This function must be called form a critical section. */
+	RWLock_t * const pxRWLock = xRWLock;
+	TaskHandle_t const xCurrentTask = xTaskGetCurrentTaskHandle();
+	BaseType_t xReturn = pdPASS, xYieldRequired = pdFALSE;
+	UBaseType_t uxReader;
 
-		configASSERT( pxQueueSetContainer );
-		configASSERT( pxQueueSetContainer->uxMessagesWaiting < pxQueueSetContainer->uxLength );
+		configASSERT( pxRWLock );
 
-		if( pxQueueSetContainer->uxMessagesWaiting < pxQueueSetContainer->uxLength )
+		taskENTER_CRITICAL();
 		{
-			const int8_t cTxLock = pxQueueSetContainer->cTxLock;
-
-			traceQUEUE_SEND( pxQueueSetContainer );
-
-			/* The data copied is the handle of the queue that contains data. */
-			xReturn = prvCopyDataToQueue( pxQueueSetContainer, &pxQueue, queueSEND_TO_BACK );
-
-			if( cTxLock == queueUNLOCKED )
+			if( pxRWLock->xWriter == xCurrentTask )
 			{
-				if( listLIST_IS_EMPTY( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) == pdFALSE )
+				pxRWLock->xWriter = NULL;
+			}
+			else
+			{
+				/* The calling task must hold the lock for reading.  The order
+				of the reader table is not significant, so the last entry
+				fills the gap. */
+				xReturn = pdFAIL;
+
+				for( uxReader = ( UBaseType_t ) 0; uxReader < pxRWLock->uxReaders; uxReader++ )
 				{
-					if( xTaskRemoveFromEventList( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) != pdFALSE )
+					if( pxRWLock->pxReaders[ uxReader ] == xCurrentTask )
 					{
-						/* The task waiting has a higher priority. */
-						xReturn = pdTRUE;
+						( pxRWLock->uxReaders )--;
+						pxRWLock->pxReaders[ uxReader ] = pxRWLock->pxReaders[ pxRWLock->uxReaders ];
+						xReturn = pdPASS;
+						break;
 					}
 					else
 					{
 						mtCOVERAGE_TEST_MARKER();
 					}
 				}
+			}
+
+			if( xReturn != pdFAIL )
+			{
+				/* Drop any priority inherited while the lock was held, then
+				pass the lock to whichever waiting tasks can now have it. */
+				xYieldRequired = xTaskPriorityDisinherit( xCurrentTask );
+
+				if( prvRWLockHandOver( pxRWLock ) != pdFALSE )
+				{
+					xYieldRequired = pdTRUE;
+				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
@@ -2919,9 +6317,16 @@ Queue_t * const pxQueue = xQueue;
 			}
 			else
 			{
-				pxQueueSetContainer->cTxLock = ( int8_t ) ( cTxLock + 1 );
+				/* The calling task does not hold the lock. */
+				mtCOVERAGE_TEST_MARKER();
 			}
 		}
+		taskEXIT_CRITICAL();
+
+		if( xYieldRequired != pdFALSE )
+		{
+			queueYIELD_IF_USING_PREEMPTION();
+		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
@@ -2930,7 +6335,7 @@ Queue_t * const pxQueue = xQueue;
 		return xReturn;
 	}
 
-#endif /* configUSE_QUEUE_SETS */
+#endif /* configUSE_RW_LOCKS */
 
 
 
@@ -59,9 +59,10 @@ that uses task notifications. */
 		{																				\
 			if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )						\
 			{																			\
-				( void ) xTaskNotify( ( pxStreamBuffer )->xTaskWaitingToSend,			\
-									  ( uint32_t ) 0,									\
-									  eNoAction );										\
+				( void ) xTaskNotifyIndexed( ( pxStreamBuffer )->xTaskWaitingToSend,	\
+											 configKERNEL_NOTIFICATION_INDEX,			\
+											 ( uint32_t ) 0,							\
+											 eNoAction );								\
 				( pxStreamBuffer )->xTaskWaitingToSend = NULL;							\
 			}																			\
 		}																				\
@@ -78,10 +79,11 @@ that uses task notifications. */
 		{																				\
 			if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )						\
 			{																			\
-				( void ) xTaskNotifyFromISR( ( pxStreamBuffer )->xTaskWaitingToSend,	\
-											 ( uint32_t ) 0,							\
-											 eNoAction,									\
-											 pxHigherPriorityTaskWoken );				\
+				( void ) xTaskNotifyIndexedFromISR( ( pxStreamBuffer )->xTaskWaitingToSend,	\
+													configKERNEL_NOTIFICATION_INDEX,	\
+													( uint32_t ) 0,						\
+													eNoAction,							\
+													pxHigherPriorityTaskWoken );		\
 				( pxStreamBuffer )->xTaskWaitingToSend = NULL;							\
 			}																			\
 		}																				\
@@ -98,9 +100,10 @@ that uses task notifications. */
 		{																				\
 			if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )						\
 			{																			\
-				( void ) xTaskNotify( ( pxStreamBuffer )->xTaskWaitingToReceive,		\
-									  ( uint32_t ) 0,									\
-									  eNoAction );										\
+				( void ) xTaskNotifyIndexed( ( pxStreamBuffer )->xTaskWaitingToReceive,	\
+											 configKERNEL_NOTIFICATION_INDEX,			\
+											 ( uint32_t ) 0,							\
+											 eNoAction );								\
 				( pxStreamBuffer )->xTaskWaitingToReceive = NULL;						\
 			}																			\
 		}																				\
@@ -116,10 +119,11 @@ that uses task notifications. */
 		{																				\
 			if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )						\
 			{																			\
-				( void ) xTaskNotifyFromISR( ( pxStreamBuffer )->xTaskWaitingToReceive,	\
-											 ( uint32_t ) 0,							\
-											 eNoAction,									\
-											 pxHigherPriorityTaskWoken );				\
+				( void ) xTaskNotifyIndexedFromISR( ( pxStreamBuffer )->xTaskWaitingToReceive,	\
+													configKERNEL_NOTIFICATION_INDEX,	\
+													( uint32_t ) 0,						\
+													eNoAction,							\
+													pxHigherPriorityTaskWoken );		\
 				( pxStreamBuffer )->xTaskWaitingToReceive = NULL;						\
 			}																			\
 		}																				\
@@ -134,6 +138,8 @@ that uses task notifications. */
 /* Bits stored in the ucFlags field of the stream buffer. */
 #define sbFLAGS_IS_MESSAGE_BUFFER		( ( uint8_t ) 1 ) /* Set if the stream buffer was created as a message buffer, in which case it holds discrete messages rather than a stream. */
 #define sbFLAGS_IS_STATICALLY_ALLOCATED ( ( uint8_t ) 2 ) /* Set if the stream buffer was created using statically allocated memory. */
+#define sbFLAGS_IS_MULTI_PRODUCER		( ( uint8_t ) 4 ) /* Set if the stream buffer was created to allow more than one writer at a time. */
+#define sbFLAGS_WAKE_SENDERS			( ( uint8_t ) 8 ) /* Set if an interrupt woke one of the tasks waiting for space in a multi producer buffer and the others are still to be woken. */
 
 /*-----------------------------------------------------------*/
 
@@ -152,20 +158,62 @@ typedef struct StreamBufferDef_t /*lint !e9058 Style convention uses tag. */
 	#if ( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t uxStreamBufferNumber;		/* Used for tracing purposes. */
 	#endif
+
+	#if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+		volatile size_t xReserveHead;			/* Index to the next byte to be claimed by a writer.  Only used by multi producer buffers, in which xHead trails xReserveHead while writes are in progress. */
+		volatile UBaseType_t uxWritesInProgress;	/* The number of writers that have claimed space but not yet published it. */
+		List_t xTasksWaitingToSend;				/* List of tasks that are blocked waiting for space in a multi producer buffer.  Stored in priority order. */
+	#endif
 } StreamBuffer_t;
 
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	/* Marks the end of a chain of blocks, or a channel that holds no blocks. */
+	#define sbMUX_NO_BLOCK	( ~( ( UBaseType_t ) 0 ) )
+
+	/* The state of one channel of a multiplexed stream buffer.  A channel holds
+	its bytes in a chain of blocks borrowed from the shared pool.  The chain
+	runs from the block being read to the block being written. */
+	typedef struct StreamBufferMuxChannel_t
+	{
+		volatile size_t xBytesAvailable;	/* The number of bytes that have been written to the channel and not yet read. */
+		volatile size_t xBytesInFlight;		/* The number of bytes claimed by a write that has not yet completed. */
+		UBaseType_t uxHeadBlock;			/* The block that holds the next byte to be claimed, or sbMUX_NO_BLOCK if the channel holds no blocks. */
+		size_t xHeadOffset;					/* The offset of the next byte to be claimed within uxHeadBlock. */
+		UBaseType_t uxTailBlock;			/* The block that holds the next byte to be read. */
+		size_t xTailOffset;					/* The offset of the next byte to be read within uxTailBlock. */
+		size_t xTriggerLevelBytes;			/* The number of bytes that must be in the channel before a task that is waiting for data is unblocked. */
+		volatile TaskHandle_t xTaskWaitingToReceive; /* Holds the handle of a task waiting for data on this channel, or NULL if no tasks are waiting. */
+		volatile TaskHandle_t xTaskWaitingToSend;	/* Holds the handle of a task waiting for blocks to write to this channel, or NULL if no tasks are waiting. */
+	} StreamBufferMuxChannel_t;
+
+	/* Structure that holds the state of a multiplexed stream buffer. */
+	typedef struct StreamBufferMuxDef_t /*lint !e9058 Style convention uses tag. */
+	{
+		StreamBufferMuxChannel_t *pxChannels;	/* Array of uxChannels channel structures. */
+		UBaseType_t *puxNextBlock;				/* Links each block to the next block in the same channel, or to the next free block. */
+		uint8_t *pucPool;						/* The storage shared by all the channels, uxBlockCount blocks of xBlockSizeBytes bytes each. */
+		UBaseType_t uxChannels;
+		UBaseType_t uxBlockCount;
+		size_t xBlockSizeBytes;
+		UBaseType_t uxFreeBlock;				/* The first block in the list of free blocks, or sbMUX_NO_BLOCK if the pool is exhausted. */
+		volatile UBaseType_t uxFreeBlocks;		/* The number of blocks in the list of free blocks. */
+	} StreamBufferMux_t;
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+
 /*
  * The number of bytes available to be read from the buffer.
  */
 static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
 
 /*
- * Add xCount bytes from pucData into the pxStreamBuffer message buffer.
- * Returns the number of bytes written, which will either equal xCount in the
- * success case, or 0 if there was not enough space in the buffer (in which case
- * no data is written into the buffer).
+ * Copy xCount bytes from pucData into the pxStreamBuffer buffer starting at
+ * index xHead, wrapping back to the start of the buffer if necessary.  Returns
+ * the index of the byte after the last byte written.  The caller must already
+ * know there is space for the bytes and is responsible for updating xHead.
  */
-static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount ) PRIVILEGED_FUNCTION;
+static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount, size_t xHead ) PRIVILEGED_FUNCTION;
 
 /*
  * If the stream buffer is being used as a message buffer, then reads an entire
@@ -188,11 +236,31 @@ static size_t prvReadMessageFromBuffer( StreamBuffer_t *pxStreamBuffer,
  * data storage area.
  */
 static size_t prvWriteMessageToBuffer(  StreamBuffer_t * const pxStreamBuffer,
-										const void * pvTxData,
+										const StreamBufferFragment_t *pxFragments,
+										UBaseType_t uxFragmentCount,
 										size_t xDataLengthBytes,
 										size_t xSpace,
 										size_t xRequiredSpace ) PRIVILEGED_FUNCTION;
 
+/*
+ * Copies the first xCount bytes held in the uxFragmentCount fragments pointed
+ * to by pxFragments into the buffer starting at index xHead, in the order the
+ * fragments appear in the array.  Returns the index of the byte after the last
+ * byte written.
+ */
+static size_t prvWriteFragmentsToBuffer( StreamBuffer_t * const pxStreamBuffer,
+										 const StreamBufferFragment_t *pxFragments,
+										 UBaseType_t uxFragmentCount,
+										 size_t xCount,
+										 size_t xHead ) PRIVILEGED_FUNCTION;
+
+/*
+ * The total number of bytes held in the uxFragmentCount fragments pointed to
+ * by pxFragments.
+ */
+static size_t prvFragmentsLength( const StreamBufferFragment_t *pxFragments,
+								  UBaseType_t uxFragmentCount ) PRIVILEGED_FUNCTION;
+
 /*
  * Read xMaxCount bytes from the pxStreamBuffer message buffer and write them
  * to pucData.
@@ -202,6 +270,203 @@ static size_t prvReadBytesFromBuffer( StreamBuffer_t *pxStreamBuffer,
 									  size_t xMaxCount,
 									  size_t xBytesAvailable ) PRIVILEGED_FUNCTION;
 
+/*
+ * Blocks the calling task for up to xTicksToWait ticks waiting for at least
+ * xRequiredSpace bytes to be free in the buffer.  Returns the number of bytes
+ * that are free, which is less than xRequiredSpace if the wait timed out.
+ */
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer,
+							   size_t xRequiredSpace,
+							   TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Blocks the calling task for up to xTicksToWait ticks waiting for more than
+ * xBytesToStoreMessageLength bytes to be in the buffer.  Returns the number of
+ * bytes in the buffer.
+ */
+static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer,
+							  size_t xBytesToStoreMessageLength,
+							  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Moves xTail forward by xCount bytes, wrapping back to the start of the
+ * buffer if necessary.
+ */
+static void prvAdvanceTail( StreamBuffer_t * const pxStreamBuffer, size_t xCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Sets *ppucFirst and *pxFirstLength to describe the readable bytes that start
+ * at xTail, and *ppucSecond and *pxSecondLength to describe any that wrap
+ * around to the start of the buffer.  Returns the total number of readable
+ * bytes.
+ */
+static size_t prvGetReadableSpans( const StreamBuffer_t * const pxStreamBuffer,
+								   const uint8_t **ppucFirst,
+								   size_t *pxFirstLength,
+								   const uint8_t **ppucSecond,
+								   size_t *pxSecondLength ) PRIVILEGED_FUNCTION;
+
+/*
+ * The number of bytes that can be written to the buffer starting at xHead
+ * without wrapping back to the start of the buffer.
+ */
+static size_t prvContiguousSpaceInBuffer( const StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+
+#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+
+	/*
+	 * Writes to a buffer created with sbTYPE_MULTI_PRODUCER.  Space for the
+	 * data is claimed, the data is copied with interrupts enabled, then the
+	 * space is published.  prvSendMultiProducer() blocks for up to xTicksToWait
+	 * ticks for xRequiredSpace bytes to become free.
+	 */
+	static size_t prvSendMultiProducer( StreamBuffer_t * const pxStreamBuffer,
+										const StreamBufferFragment_t *pxFragments,
+										UBaseType_t uxFragmentCount,
+										size_t xDataLengthBytes,
+										size_t xRequiredSpace,
+										TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+	static size_t prvSendMultiProducerFromISR( StreamBuffer_t * const pxStreamBuffer,
+											   const StreamBufferFragment_t *pxFragments,
+											   UBaseType_t uxFragmentCount,
+											   size_t xDataLengthBytes,
+											   size_t xRequiredSpace ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Claims up to xRequiredSpace bytes from xReserveHead.  A message buffer
+	 * claims either all xRequiredSpace bytes or none.  Sets *pxHead to the
+	 * index of the first claimed byte and returns the number of bytes claimed.
+	 * Must be called with interrupts masked.
+	 */
+	static size_t prvClaimSpace( StreamBuffer_t * const pxStreamBuffer,
+								 size_t xRequiredSpace,
+								 size_t * const pxHead ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called by each writer once its claimed space has been written.  The
+	 * last writer to finish moves xHead up to xReserveHead, so the reader only
+	 * ever sees bytes that have been completely written, and sees them in the
+	 * order they were claimed.  Must be called with interrupts masked.
+	 */
+	static void prvPublishClaimedSpace( StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Unblocks the tasks waiting for space in a multi producer buffer.  All
+	 * the tasks are unblocked because each may be waiting for a different
+	 * amount of space - those that still do not fit will block again.  Each
+	 * task is unblocked in its own critical section, and no more are unblocked
+	 * once the buffer is full again.
+	 */
+	static void prvUnblockWaitingSenders( StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Unblocks only the highest priority task waiting for space in a multi
+	 * producer buffer, so the time for which interrupts are masked does not
+	 * depend on the number of waiting tasks.  If other tasks are waiting
+	 * sbFLAGS_WAKE_SENDERS is set, and the unblocked task calls
+	 * prvUnblockWaitingSenders() for them when it runs.
+	 */
+	static BaseType_t prvUnblockWaitingSendersFromISR( StreamBuffer_t * const pxStreamBuffer,
+														BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+	#define sbUNBLOCK_WAITING_SENDERS( pxStreamBuffer ) prvUnblockWaitingSenders( pxStreamBuffer )
+	#define sbUNBLOCK_WAITING_SENDERS_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken ) ( void ) prvUnblockWaitingSendersFromISR( pxStreamBuffer, pxHigherPriorityTaskWoken )
+
+#else
+
+	#define sbUNBLOCK_WAITING_SENDERS( pxStreamBuffer )
+	#define sbUNBLOCK_WAITING_SENDERS_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken )
+
+#endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	/*
+	 * The number of bytes that can be written to pxChannel - the free bytes
+	 * left in the block being written plus every free block in the pool.  Must
+	 * be called with interrupts masked.
+	 */
+	static size_t prvMuxSpaceForChannel( const StreamBufferMux_t * const pxMux,
+										 const StreamBufferMuxChannel_t * const pxChannel ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Claims up to xCount bytes for a write to pxChannel, taking blocks from
+	 * the pool as needed.  Sets *puxBlock and *pxOffset to the position of the
+	 * first claimed byte and returns the number of bytes claimed.  The first
+	 * claimed byte is never at the end of a full block, as the reader could
+	 * return that block to the pool before the write follows its link to the
+	 * next one.  Must be called with interrupts masked.
+	 */
+	static size_t prvMuxClaim( StreamBufferMux_t * const pxMux,
+							   StreamBufferMuxChannel_t * const pxChannel,
+							   size_t xCount,
+							   UBaseType_t * const puxBlock,
+							   size_t * const pxOffset ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Moves the tail of pxChannel forward by xCount bytes, returning to the
+	 * pool every block that has been completely read.  Returns the number of
+	 * blocks returned to the pool.  Must be called with interrupts masked.
+	 */
+	static UBaseType_t prvMuxConsume( StreamBufferMux_t * const pxMux,
+									  StreamBufferMuxChannel_t * const pxChannel,
+									  size_t xCount ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Copy xCount bytes between pucData and the chain of blocks that starts at
+	 * xOffset within uxBlock.  The blocks must already belong to the channel.
+	 */
+	static void prvMuxCopyIn( const StreamBufferMux_t * const pxMux,
+							  UBaseType_t uxBlock,
+							  size_t xOffset,
+							  const uint8_t *pucData,
+							  size_t xCount ) PRIVILEGED_FUNCTION;
+
+	static void prvMuxCopyOut( const StreamBufferMux_t * const pxMux,
+							   UBaseType_t uxBlock,
+							   size_t xOffset,
+							   uint8_t *pucData,
+							   size_t xCount ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Blocks the calling task for up to xTicksToWait ticks waiting for xCount
+	 * bytes to be free for pxChannel, then claims them.  If the block time
+	 * expires first then as many bytes as are free are claimed.  The check
+	 * and the claim are atomic, so writers to other channels cannot take the
+	 * blocks in between.
+	 */
+	static size_t prvMuxWaitAndClaim( StreamBufferMux_t * const pxMux,
+									  StreamBufferMuxChannel_t * const pxChannel,
+									  size_t xCount,
+									  UBaseType_t * const puxBlock,
+									  size_t * const pxOffset,
+									  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Blocks the calling task for up to xTicksToWait ticks waiting for data
+	 * in pxChannel.  Returns the number of bytes in the channel.
+	 */
+	static size_t prvMuxWaitForData( StreamBufferMuxChannel_t * const pxChannel,
+									 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Unblocks the task waiting to read from pxChannel, if any.
+	 */
+	static void prvMuxUnblockReceiver( StreamBufferMuxChannel_t * const pxChannel ) PRIVILEGED_FUNCTION;
+	static void prvMuxUnblockReceiverFromISR( StreamBufferMuxChannel_t * const pxChannel,
+											  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Unblocks the tasks waiting to write to every channel.  Called when
+	 * blocks are returned to the pool, as any channel can use them.
+	 */
+	static void prvMuxUnblockSenders( StreamBufferMux_t * const pxMux ) PRIVILEGED_FUNCTION;
+	static void prvMuxUnblockSendersFromISR( StreamBufferMux_t * const pxMux,
+											 BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+
 /*
  * Called by both pxStreamBufferCreate() and pxStreamBufferCreateStatic() to
  * initialise the members of the newly created stream buffer structure.
@@ -216,7 +481,7 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
 
 #if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 
-	StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, BaseType_t xIsMessageBuffer )
+	StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, BaseType_t xStreamBufferType )
 	{
 	uint8_t *pucAllocatedMemory;
 	uint8_t ucFlags;
@@ -225,7 +490,7 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
 		(that is, it will hold discrete messages with a little meta data that
 		says how big the next message is) check the buffer will be large enough
 		to hold at least one message. */
-		if( xIsMessageBuffer == pdTRUE )
+		if( ( xStreamBufferType & sbTYPE_MESSAGE_BUFFER ) != ( BaseType_t ) 0 )
 		{
 			/* Is a message buffer but not statically allocated. */
 			ucFlags = sbFLAGS_IS_MESSAGE_BUFFER;
@@ -239,6 +504,23 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
 		}
 		configASSERT( xTriggerLevelBytes <= xBufferSizeBytes );
 
+		#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+		{
+			if( ( xStreamBufferType & sbTYPE_MULTI_PRODUCER ) != ( BaseType_t ) 0 )
+			{
+				ucFlags |= sbFLAGS_IS_MULTI_PRODUCER;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#else
+		{
+			configASSERT( ( xStreamBufferType & sbTYPE_MULTI_PRODUCER ) == ( BaseType_t ) 0 );
+		}
+		#endif
+
 		/* A trigger level of 0 would cause a waiting task to unblock even when
 		the buffer was empty. */
 		if( xTriggerLevelBytes == ( size_t ) 0 )
@@ -265,11 +547,11 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
 										   xTriggerLevelBytes,
 										   ucFlags );
 
-			traceSTREAM_BUFFER_CREATE( ( ( StreamBuffer_t * ) pucAllocatedMemory ), xIsMessageBuffer );
+			traceSTREAM_BUFFER_CREATE( ( ( StreamBuffer_t * ) pucAllocatedMemory ), ( xStreamBufferType & sbTYPE_MESSAGE_BUFFER ) );
 		}
 		else
 		{
-			traceSTREAM_BUFFER_CREATE_FAILED( xIsMessageBuffer );
+			traceSTREAM_BUFFER_CREATE_FAILED( ( xStreamBufferType & sbTYPE_MESSAGE_BUFFER ) );
 		}
 
 		return ( StreamBufferHandle_t ) pucAllocatedMemory; /*lint !e9087 !e826 Safe cast as allocated memory is aligned. */
@@ -282,7 +564,7 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
 
 	StreamBufferHandle_t xStreamBufferGenericCreateStatic( size_t xBufferSizeBytes,
 														   size_t xTriggerLevelBytes,
-														   BaseType_t xIsMessageBuffer,
+														   BaseType_t xStreamBufferType,
 														   uint8_t * const pucStreamBufferStorageArea,
 														   StaticStreamBuffer_t * const pxStaticStreamBuffer )
 	{
@@ -301,7 +583,7 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
 			xTriggerLevelBytes = ( size_t ) 1;
 		}
 
-		if( xIsMessageBuffer != pdFALSE )
+		if( ( xStreamBufferType & sbTYPE_MESSAGE_BUFFER ) != ( BaseType_t ) 0 )
 		{
 			/* Statically allocated message buffer. */
 			ucFlags = sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_STATICALLY_ALLOCATED;
@@ -312,6 +594,23 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
 			ucFlags = sbFLAGS_IS_STATICALLY_ALLOCATED;
 		}
 
+		#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+		{
+			if( ( xStreamBufferType & sbTYPE_MULTI_PRODUCER ) != ( BaseType_t ) 0 )
+			{
+				ucFlags |= sbFLAGS_IS_MULTI_PRODUCER;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#else
+		{
+			configASSERT( ( xStreamBufferType & sbTYPE_MULTI_PRODUCER ) == ( BaseType_t ) 0 );
+		}
+		#endif
+
 		/* In case the stream buffer is going to be used as a message buffer
 		(that is, it will hold discrete messages with a little meta data that
 		says how big the next message is) check the buffer will be large enough
@@ -340,14 +639,14 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
 			again. */
 			pxStreamBuffer->ucFlags |= sbFLAGS_IS_STATICALLY_ALLOCATED;
 
-			traceSTREAM_BUFFER_CREATE( pxStreamBuffer, xIsMessageBuffer );
+			traceSTREAM_BUFFER_CREATE( pxStreamBuffer, ( xStreamBufferType & sbTYPE_MESSAGE_BUFFER ) );
 
 			xReturn = ( StreamBufferHandle_t ) pxStaticStreamBuffer; /*lint !e9087 Data hiding requires cast to opaque type. */
 		}
 		else
 		{
 			xReturn = NULL;
-			traceSTREAM_BUFFER_CREATE_STATIC_FAILED( xReturn, xIsMessageBuffer );
+			traceSTREAM_BUFFER_CREATE_STATIC_FAILED( xReturn, ( xStreamBufferType & sbTYPE_MESSAGE_BUFFER ) );
 		}
 
 		return xReturn;
@@ -393,6 +692,7 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
 {
 StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
 BaseType_t xReturn = pdFAIL;
+BaseType_t xWritersBusy = pdFALSE;
 
 #if( configUSE_TRACE_FACILITY == 1 )
 	UBaseType_t uxStreamBufferNumber;
@@ -411,9 +711,24 @@ BaseType_t xReturn = pdFAIL;
 	/* Can only reset a message buffer if there are no tasks blocked on it. */
 	taskENTER_CRITICAL();
 	{
+		#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+		{
+			/* Nor can a multi producer buffer be reset while writes are in
+			progress. */
+			if( ( listLIST_IS_EMPTY( &( pxStreamBuffer->xTasksWaitingToSend ) ) == pdFALSE ) || ( pxStreamBuffer->uxWritesInProgress != ( UBaseType_t ) 0 ) )
+			{
+				xWritersBusy = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif
+
 		if( pxStreamBuffer->xTaskWaitingToReceive == NULL )
 		{
-			if( pxStreamBuffer->xTaskWaitingToSend == NULL )
+			if( ( pxStreamBuffer->xTaskWaitingToSend == NULL ) && ( xWritersBusy == pdFALSE ) )
 			{
 				prvInitialiseNewStreamBuffer( pxStreamBuffer,
 											  pxStreamBuffer->pucBuffer,
@@ -475,7 +790,19 @@ size_t xSpace;
 	configASSERT( pxStreamBuffer );
 
 	xSpace = pxStreamBuffer->xLength + pxStreamBuffer->xTail;
-	xSpace -= pxStreamBuffer->xHead;
+
+	#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 )
+	{
+		/* Space claimed by writes that are still in progress is not free. */
+		xSpace -= pxStreamBuffer->xReserveHead;
+	}
+	else
+	#endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+	{
+		xSpace -= pxStreamBuffer->xHead;
+	}
+
 	xSpace -= ( size_t ) 1;
 
 	if( xSpace >= pxStreamBuffer->xLength )
@@ -508,14 +835,30 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
 						  size_t xDataLengthBytes,
 						  TickType_t xTicksToWait )
 {
-StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-size_t xReturn, xSpace = 0;
-size_t xRequiredSpace = xDataLengthBytes;
-TimeOut_t xTimeOut;
+StreamBufferFragment_t xFragment;
 
 	configASSERT( pvTxData );
+
+	xFragment.pvData = pvTxData;
+	xFragment.xLengthBytes = xDataLengthBytes;
+
+	return xStreamBufferSendV( xStreamBuffer, &xFragment, ( UBaseType_t ) 1, xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+						   const StreamBufferFragment_t *pxFragments,
+						   UBaseType_t uxFragmentCount,
+						   TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+size_t xReturn, xSpace, xDataLengthBytes, xRequiredSpace;
+
 	configASSERT( pxStreamBuffer );
 
+	xDataLengthBytes = prvFragmentsLength( pxFragments, uxFragmentCount );
+	xRequiredSpace = xDataLengthBytes;
+
 	/* This send function is used to write to both message buffers and stream
 	buffers.  If this is a message buffer then the space needed must be
 	increased by the amount of bytes needed to store the length of the
@@ -532,6 +875,126 @@ TimeOut_t xTimeOut;
 		mtCOVERAGE_TEST_MARKER();
 	}
 
+	#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 )
+	{
+		xReturn = prvSendMultiProducer( pxStreamBuffer, pxFragments, uxFragmentCount, xDataLengthBytes, xRequiredSpace, xTicksToWait );
+	}
+	else
+	#endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+	{
+		xSpace = prvWaitForSpace( pxStreamBuffer, xRequiredSpace, xTicksToWait );
+		xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pxFragments, uxFragmentCount, xDataLengthBytes, xSpace, xRequiredSpace );
+	}
+
+	if( xReturn > ( size_t ) 0 )
+	{
+		traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
+
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			sbSEND_COMPLETED( pxStreamBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+		traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
+								 const void *pvTxData,
+								 size_t xDataLengthBytes,
+								 BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBufferFragment_t xFragment;
+
+	configASSERT( pvTxData );
+
+	xFragment.pvData = pvTxData;
+	xFragment.xLengthBytes = xDataLengthBytes;
+
+	return xStreamBufferSendVFromISR( xStreamBuffer, &xFragment, ( UBaseType_t ) 1, pxHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendVFromISR( StreamBufferHandle_t xStreamBuffer,
+								  const StreamBufferFragment_t *pxFragments,
+								  UBaseType_t uxFragmentCount,
+								  BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+size_t xReturn, xSpace, xDataLengthBytes, xRequiredSpace;
+
+	configASSERT( pxStreamBuffer );
+
+	xDataLengthBytes = prvFragmentsLength( pxFragments, uxFragmentCount );
+	xRequiredSpace = xDataLengthBytes;
+
+	/* This send function is used to write to both message buffers and stream
+	buffers.  If this is a message buffer then the space needed must be
+	increased by the amount of bytes needed to store the length of the
+	message. */
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 )
+	{
+		xReturn = prvSendMultiProducerFromISR( pxStreamBuffer, pxFragments, uxFragmentCount, xDataLengthBytes, xRequiredSpace );
+	}
+	else
+	#endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+	{
+		xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+		xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pxFragments, uxFragmentCount, xDataLengthBytes, xSpace, xRequiredSpace );
+	}
+
+	if( xReturn > ( size_t ) 0 )
+	{
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer,
+							   size_t xRequiredSpace,
+							   TickType_t xTicksToWait )
+{
+size_t xSpace = 0;
+TimeOut_t xTimeOut;
+
 	if( xTicksToWait != ( TickType_t ) 0 )
 	{
 		vTaskSetTimeOutState( &xTimeOut );
@@ -547,7 +1010,7 @@ TimeOut_t xTimeOut;
 				if( xSpace < xRequiredSpace )
 				{
 					/* Clear notification state as going to wait for space. */
-					( void ) xTaskNotifyStateClear( NULL );
+					( void ) xTaskNotifyStateClearIndexed( NULL, configKERNEL_NOTIFICATION_INDEX );
 
 					/* Should only be one writer. */
 					configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
@@ -561,8 +1024,8 @@ TimeOut_t xTimeOut;
 			}
 			taskEXIT_CRITICAL();
 
-			traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
-			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			traceBLOCKING_ON_STREAM_BUFFER_SEND( pxStreamBuffer );
+			( void ) xTaskNotifyWaitIndexed( configKERNEL_NOTIFICATION_INDEX, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
 			pxStreamBuffer->xTaskWaitingToSend = NULL;
 
 		} while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
@@ -581,11 +1044,78 @@ TimeOut_t xTimeOut;
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
+	return xSpace;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+								 void **ppvData,
+								 TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+size_t xReturn;
+
+	configASSERT( ppvData );
+	configASSERT( pxStreamBuffer );
+
+	/* The data is written in place, so there is nowhere to put the length of
+	a message, and the space at xHead cannot be shared between writers. */
+	configASSERT( ( pxStreamBuffer->ucFlags & ( sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_MULTI_PRODUCER ) ) == ( uint8_t ) 0 );
 
-	if( xReturn > ( size_t ) 0 )
+	/* Any free space means some contiguous space is free at xHead. */
+	( void ) prvWaitForSpace( pxStreamBuffer, ( size_t ) 1, xTicksToWait );
+
+	xReturn = prvContiguousSpaceInBuffer( pxStreamBuffer );
+	*ppvData = ( void * ) &( pxStreamBuffer->pucBuffer[ pxStreamBuffer->xHead ] );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+										void **ppvData )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+size_t xReturn;
+
+	configASSERT( ppvData );
+	configASSERT( pxStreamBuffer );
+	configASSERT( ( pxStreamBuffer->ucFlags & ( sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_MULTI_PRODUCER ) ) == ( uint8_t ) 0 );
+
+	xReturn = prvContiguousSpaceInBuffer( pxStreamBuffer );
+	*ppvData = ( void * ) &( pxStreamBuffer->pucBuffer[ pxStreamBuffer->xHead ] );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+								size_t xBytesWritten )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+size_t xNextHead;
+
+	configASSERT( pxStreamBuffer );
+
+	/* Only the space returned by the reserve call can be committed, and the
+	reader can only have made more space available since then. */
+	configASSERT( xBytesWritten <= prvContiguousSpaceInBuffer( pxStreamBuffer ) );
+
+	if( xBytesWritten > ( size_t ) 0 )
 	{
-		traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
+		xNextHead = pxStreamBuffer->xHead + xBytesWritten;
+
+		if( xNextHead >= pxStreamBuffer->xLength )
+		{
+			xNextHead -= pxStreamBuffer->xLength;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxStreamBuffer->xHead = xNextHead;
+		traceSTREAM_BUFFER_SEND( xStreamBuffer, xBytesWritten );
 
 		/* Was a task waiting for the data? */
 		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
@@ -600,43 +1130,37 @@ TimeOut_t xTimeOut;
 	else
 	{
 		mtCOVERAGE_TEST_MARKER();
-		traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer );
 	}
 
-	return xReturn;
+	return xBytesWritten;
 }
 /*-----------------------------------------------------------*/
 
-size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
-								 const void *pvTxData,
-								 size_t xDataLengthBytes,
-								 BaseType_t * const pxHigherPriorityTaskWoken )
+size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+									   size_t xBytesWritten,
+									   BaseType_t * const pxHigherPriorityTaskWoken )
 {
 StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-size_t xReturn, xSpace;
-size_t xRequiredSpace = xDataLengthBytes;
+size_t xNextHead;
 
-	configASSERT( pvTxData );
 	configASSERT( pxStreamBuffer );
+	configASSERT( xBytesWritten <= prvContiguousSpaceInBuffer( pxStreamBuffer ) );
 
-	/* This send function is used to write to both message buffers and stream
-	buffers.  If this is a message buffer then the space needed must be
-	increased by the amount of bytes needed to store the length of the
-	message. */
-	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
-	{
-		xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
-	}
-	else
+	if( xBytesWritten > ( size_t ) 0 )
 	{
-		mtCOVERAGE_TEST_MARKER();
-	}
+		xNextHead = pxStreamBuffer->xHead + xBytesWritten;
+
+		if( xNextHead >= pxStreamBuffer->xLength )
+		{
+			xNextHead -= pxStreamBuffer->xLength;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-	xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-	xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
+		pxStreamBuffer->xHead = xNextHead;
 
-	if( xReturn > ( size_t ) 0 )
-	{
 		/* Was a task waiting for the data? */
 		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
 		{
@@ -652,20 +1176,21 @@ size_t xRequiredSpace = xDataLengthBytes;
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
+	traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xBytesWritten );
 
-	return xReturn;
+	return xBytesWritten;
 }
 /*-----------------------------------------------------------*/
 
 static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
-									   const void * pvTxData,
+									   const StreamBufferFragment_t *pxFragments,
+									   UBaseType_t uxFragmentCount,
 									   size_t xDataLengthBytes,
 									   size_t xSpace,
 									   size_t xRequiredSpace )
 {
 	BaseType_t xShouldWrite;
-	size_t xReturn;
+	size_t xReturn, xHead;
 
 	if( xSpace == ( size_t ) 0 )
 	{
@@ -685,10 +1210,8 @@ static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
 	{
 		/* This is a message buffer, as opposed to a stream buffer, and there
 		is enough space to write both the message length and the message itself
-		into the buffer.  Start by writing the length of the data, the data
-		itself will be written later in this function. */
+		into the buffer. */
 		xShouldWrite = pdTRUE;
-		( void ) prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xDataLengthBytes ), sbBYTES_TO_STORE_MESSAGE_LENGTH );
 	}
 	else
 	{
@@ -698,11 +1221,25 @@ static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
 
 	if( xShouldWrite != pdFALSE )
 	{
-		/* Writes the data itself. */
-		xReturn = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes ); /*lint !e9079 Storage buffer is implemented as uint8_t for ease of sizing, alighment and access. */
-	}
-	else
-	{
+		xHead = pxStreamBuffer->xHead;
+
+		if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+		{
+			/* Start by writing the length of the data. */
+			xHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xDataLengthBytes ), sbBYTES_TO_STORE_MESSAGE_LENGTH, xHead );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Writes the data itself, then moves xHead so the reader sees the
+		length and the data together. */
+		pxStreamBuffer->xHead = prvWriteFragmentsToBuffer( pxStreamBuffer, pxFragments, uxFragmentCount, xDataLengthBytes, xHead );
+		xReturn = xDataLengthBytes;
+	}
+	else
+	{
 		xReturn = 0;
 	}
 
@@ -735,6 +1272,45 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 		xBytesToStoreMessageLength = 0;
 	}
 
+	xBytesAvailable = prvWaitForData( pxStreamBuffer, xBytesToStoreMessageLength, xTicksToWait );
+
+	/* Whether receiving a discrete message (where xBytesToStoreMessageLength
+	holds the number of bytes used to store the message length) or a stream of
+	bytes (where xBytesToStoreMessageLength is zero), the number of bytes
+	available must be greater than xBytesToStoreMessageLength to be able to
+	read bytes from the buffer. */
+	if( xBytesAvailable > xBytesToStoreMessageLength )
+	{
+		xReceivedLength = prvReadMessageFromBuffer( pxStreamBuffer, pvRxData, xBufferLengthBytes, xBytesAvailable, xBytesToStoreMessageLength );
+
+		/* Was a task waiting for space in the buffer? */
+		if( xReceivedLength != ( size_t ) 0 )
+		{
+			traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength );
+			sbRECEIVE_COMPLETED( pxStreamBuffer );
+			sbUNBLOCK_WAITING_SENDERS( pxStreamBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer );
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReceivedLength;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer,
+							  size_t xBytesToStoreMessageLength,
+							  TickType_t xTicksToWait )
+{
+size_t xBytesAvailable;
+
 	if( xTicksToWait != ( TickType_t ) 0 )
 	{
 		/* Checking if there is data and clearing the notification state must be
@@ -751,7 +1327,7 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 			if( xBytesAvailable <= xBytesToStoreMessageLength )
 			{
 				/* Clear notification state as going to wait for data. */
-				( void ) xTaskNotifyStateClear( NULL );
+				( void ) xTaskNotifyStateClearIndexed( NULL, configKERNEL_NOTIFICATION_INDEX );
 
 				/* Should only be one reader. */
 				configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
@@ -767,8 +1343,8 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 		if( xBytesAvailable <= xBytesToStoreMessageLength )
 		{
 			/* Wait for data to be available. */
-			traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
-			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( pxStreamBuffer );
+			( void ) xTaskNotifyWaitIndexed( configKERNEL_NOTIFICATION_INDEX, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
 			pxStreamBuffer->xTaskWaitingToReceive = NULL;
 
 			/* Recheck the data available after blocking. */
@@ -784,33 +1360,104 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 		xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
 	}
 
-	/* Whether receiving a discrete message (where xBytesToStoreMessageLength
-	holds the number of bytes used to store the message length) or a stream of
-	bytes (where xBytesToStoreMessageLength is zero), the number of bytes
-	available must be greater than xBytesToStoreMessageLength to be able to
-	read bytes from the buffer. */
-	if( xBytesAvailable > xBytesToStoreMessageLength )
+	return xBytesAvailable;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceivePeek( StreamBufferHandle_t xStreamBuffer,
+								 const uint8_t **ppucFirst,
+								 size_t *pxFirstLength,
+								 const uint8_t **ppucSecond,
+								 size_t *pxSecondLength,
+								 TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+size_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	/* The bytes are returned as a stream, so there is nothing to skip the
+	length of a message. */
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	( void ) prvWaitForData( pxStreamBuffer, ( size_t ) 0, xTicksToWait );
+	xReturn = prvGetReadableSpans( pxStreamBuffer, ppucFirst, pxFirstLength, ppucSecond, pxSecondLength );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceivePeekFromISR( StreamBufferHandle_t xStreamBuffer,
+										const uint8_t **ppucFirst,
+										size_t *pxFirstLength,
+										const uint8_t **ppucSecond,
+										size_t *pxSecondLength )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+size_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+	xReturn = prvGetReadableSpans( pxStreamBuffer, ppucFirst, pxFirstLength, ppucSecond, pxSecondLength );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveConsume( StreamBufferHandle_t xStreamBuffer,
+									size_t xBytesConsumed )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	/* The writer can only have added bytes since they were peeked. */
+	configASSERT( xBytesConsumed <= prvBytesInBuffer( pxStreamBuffer ) );
+
+	if( xBytesConsumed > ( size_t ) 0 )
 	{
-		xReceivedLength = prvReadMessageFromBuffer( pxStreamBuffer, pvRxData, xBufferLengthBytes, xBytesAvailable, xBytesToStoreMessageLength );
+		prvAdvanceTail( pxStreamBuffer, xBytesConsumed );
+		traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xBytesConsumed );
 
 		/* Was a task waiting for space in the buffer? */
-		if( xReceivedLength != ( size_t ) 0 )
-		{
-			traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength );
-			sbRECEIVE_COMPLETED( pxStreamBuffer );
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
+		sbRECEIVE_COMPLETED( pxStreamBuffer );
+		sbUNBLOCK_WAITING_SENDERS( pxStreamBuffer );
 	}
 	else
 	{
-		traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer );
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	return xReceivedLength;
+	return xBytesConsumed;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+										   size_t xBytesConsumed,
+										   BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( xBytesConsumed <= prvBytesInBuffer( pxStreamBuffer ) );
+
+	if( xBytesConsumed > ( size_t ) 0 )
+	{
+		prvAdvanceTail( pxStreamBuffer, xBytesConsumed );
+
+		/* Was a task waiting for space in the buffer? */
+		sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+		sbUNBLOCK_WAITING_SENDERS_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xBytesConsumed );
+
+	return xBytesConsumed;
 }
 /*-----------------------------------------------------------*/
 
@@ -898,6 +1545,7 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 		if( xReceivedLength != ( size_t ) 0 )
 		{
 			sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+			sbUNBLOCK_WAITING_SENDERS_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
 		}
 		else
 		{
@@ -1037,10 +1685,11 @@ UBaseType_t uxSavedInterruptStatus;
 	{
 		if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )
 		{
-			( void ) xTaskNotifyFromISR( ( pxStreamBuffer )->xTaskWaitingToReceive,
-										 ( uint32_t ) 0,
-										 eNoAction,
-										 pxHigherPriorityTaskWoken );
+			( void ) xTaskNotifyIndexedFromISR( ( pxStreamBuffer )->xTaskWaitingToReceive,
+												configKERNEL_NOTIFICATION_INDEX,
+												( uint32_t ) 0,
+												eNoAction,
+												pxHigherPriorityTaskWoken );
 			( pxStreamBuffer )->xTaskWaitingToReceive = NULL;
 			xReturn = pdTRUE;
 		}
@@ -1067,10 +1716,11 @@ UBaseType_t uxSavedInterruptStatus;
 	{
 		if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )
 		{
-			( void ) xTaskNotifyFromISR( ( pxStreamBuffer )->xTaskWaitingToSend,
-										 ( uint32_t ) 0,
-										 eNoAction,
-										 pxHigherPriorityTaskWoken );
+			( void ) xTaskNotifyIndexedFromISR( ( pxStreamBuffer )->xTaskWaitingToSend,
+												configKERNEL_NOTIFICATION_INDEX,
+												( uint32_t ) 0,
+												eNoAction,
+												pxHigherPriorityTaskWoken );
 			( pxStreamBuffer )->xTaskWaitingToSend = NULL;
 			xReturn = pdTRUE;
 		}
@@ -1081,17 +1731,30 @@ UBaseType_t uxSavedInterruptStatus;
 	}
 	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
+	#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+	{
+		if( prvUnblockWaitingSendersFromISR( pxStreamBuffer, pxHigherPriorityTaskWoken ) != pdFALSE )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
 	return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount )
+static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount, size_t xHead )
 {
 size_t xNextHead, xFirstLength;
 
 	configASSERT( xCount > ( size_t ) 0 );
 
-	xNextHead = pxStreamBuffer->xHead;
+	xNextHead = xHead;
 
 	/* Calculate the number of bytes that can be added in the first write -
 	which may be less than the total number of bytes that need to be added if
@@ -1125,9 +1788,59 @@ size_t xNextHead, xFirstLength;
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	pxStreamBuffer->xHead = xNextHead;
+	return xNextHead;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteFragmentsToBuffer( StreamBuffer_t * const pxStreamBuffer,
+										 const StreamBufferFragment_t *pxFragments,
+										 UBaseType_t uxFragmentCount,
+										 size_t xCount,
+										 size_t xHead )
+{
+UBaseType_t uxFragment;
+size_t xFragmentLength;
 
-	return xCount;
+	for( uxFragment = 0; ( uxFragment < uxFragmentCount ) && ( xCount > ( size_t ) 0 ); uxFragment++ )
+	{
+		/* A stream buffer may be writing fewer bytes than the fragments
+		hold, in which case the last fragment written is truncated. */
+		xFragmentLength = configMIN( pxFragments[ uxFragment ].xLengthBytes, xCount );
+
+		if( xFragmentLength > ( size_t ) 0 )
+		{
+			xHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pxFragments[ uxFragment ].pvData, xFragmentLength, xHead ); /*lint !e9079 Storage buffer is implemented as uint8_t for ease of sizing, alighment and access. */
+			xCount -= xFragmentLength;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return xHead;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvFragmentsLength( const StreamBufferFragment_t *pxFragments,
+								  UBaseType_t uxFragmentCount )
+{
+UBaseType_t uxFragment;
+size_t xLength = 0;
+
+	configASSERT( pxFragments );
+
+	for( uxFragment = 0; uxFragment < uxFragmentCount; uxFragment++ )
+	{
+		configASSERT( ( pxFragments[ uxFragment ].pvData != NULL ) || ( pxFragments[ uxFragment ].xLengthBytes == ( size_t ) 0 ) );
+
+		xLength += pxFragments[ uxFragment ].xLengthBytes;
+
+		/* Overflow? */
+		configASSERT( xLength >= pxFragments[ uxFragment ].xLengthBytes );
+	}
+
+	return xLength;
 }
 /*-----------------------------------------------------------*/
 
@@ -1168,14 +1881,7 @@ size_t xCount, xFirstLength, xNextTail;
 
 		/* Move the tail pointer to effectively remove the data read from
 		the buffer. */
-		xNextTail += xCount;
-
-		if( xNextTail >= pxStreamBuffer->xLength )
-		{
-			xNextTail -= pxStreamBuffer->xLength;
-		}
-
-		pxStreamBuffer->xTail = xNextTail;
+		prvAdvanceTail( pxStreamBuffer, xCount );
 	}
 	else
 	{
@@ -1206,58 +1912,1360 @@ size_t xCount;
 }
 /*-----------------------------------------------------------*/
 
-static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
-										  uint8_t * const pucBuffer,
-										  size_t xBufferSizeBytes,
-										  size_t xTriggerLevelBytes,
-										  uint8_t ucFlags )
+static void prvAdvanceTail( StreamBuffer_t * const pxStreamBuffer, size_t xCount )
 {
-	/* Assert here is deliberately writing to the entire buffer to ensure it can
-	be written to without generating exceptions, and is setting the buffer to a
-	known value to assist in development/debugging. */
-	#if( configASSERT_DEFINED == 1 )
+size_t xNextTail;
+
+	xNextTail = pxStreamBuffer->xTail + xCount;
+
+	if( xNextTail >= pxStreamBuffer->xLength )
 	{
-		/* The value written just has to be identifiable when looking at the
-		memory.  Don't use 0xA5 as that is the stack fill value and could
-		result in confusion as to what is actually being observed. */
-		const BaseType_t xWriteValue = 0x55;
-		configASSERT( memset( pucBuffer, ( int ) xWriteValue, xBufferSizeBytes ) == pucBuffer );
-	} /*lint !e529 !e438 xWriteValue is only used if configASSERT() is defined. */
-	#endif
+		xNextTail -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
 
-	( void ) memset( ( void * ) pxStreamBuffer, 0x00, sizeof( StreamBuffer_t ) ); /*lint !e9087 memset() requires void *. */
-	pxStreamBuffer->pucBuffer = pucBuffer;
-	pxStreamBuffer->xLength = xBufferSizeBytes;
-	pxStreamBuffer->xTriggerLevelBytes = xTriggerLevelBytes;
-	pxStreamBuffer->ucFlags = ucFlags;
+	pxStreamBuffer->xTail = xNextTail;
 }
+/*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+static size_t prvGetReadableSpans( const StreamBuffer_t * const pxStreamBuffer,
+								   const uint8_t **ppucFirst,
+								   size_t *pxFirstLength,
+								   const uint8_t **ppucSecond,
+								   size_t *pxSecondLength )
+{
+size_t xCount, xTail;
 
-	UBaseType_t uxStreamBufferGetStreamBufferNumber( StreamBufferHandle_t xStreamBuffer )
+	configASSERT( ppucFirst );
+	configASSERT( pxFirstLength );
+	configASSERT( ppucSecond );
+	configASSERT( pxSecondLength );
+
+	xTail = pxStreamBuffer->xTail;
+	xCount = prvBytesInBuffer( pxStreamBuffer );
+
+	*ppucFirst = &( pxStreamBuffer->pucBuffer[ xTail ] );
+	*pxFirstLength = configMIN( pxStreamBuffer->xLength - xTail, xCount );
+
+	if( xCount > *pxFirstLength )
 	{
-		return xStreamBuffer->uxStreamBufferNumber;
+		/* The remaining bytes wrapped around to the start of the buffer. */
+		*ppucSecond = pxStreamBuffer->pucBuffer;
+		*pxSecondLength = xCount - *pxFirstLength;
+	}
+	else
+	{
+		*ppucSecond = NULL;
+		*pxSecondLength = 0;
 	}
 
-#endif /* configUSE_TRACE_FACILITY */
+	return xCount;
+}
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+static size_t prvContiguousSpaceInBuffer( const StreamBuffer_t * const pxStreamBuffer )
+{
+size_t xHead, xTail, xCount;
 
-	void vStreamBufferSetStreamBufferNumber( StreamBufferHandle_t xStreamBuffer, UBaseType_t uxStreamBufferNumber )
+	xHead = pxStreamBuffer->xHead;
+	xTail = pxStreamBuffer->xTail;
+
+	if( xTail > xHead )
 	{
-		xStreamBuffer->uxStreamBufferNumber = uxStreamBufferNumber;
+		/* The free space ends one byte before the tail. */
+		xCount = xTail - xHead - ( size_t ) 1;
 	}
+	else
+	{
+		/* The free space runs to the end of the buffer, less one byte if the
+		tail is at the start of the buffer as the head must not catch up with
+		the tail. */
+		xCount = pxStreamBuffer->xLength - xHead;
 
-#endif /* configUSE_TRACE_FACILITY */
+		if( xTail == ( size_t ) 0 )
+		{
+			xCount -= ( size_t ) 1;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return xCount;
+}
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
 
-	uint8_t ucStreamBufferGetStreamBufferType( StreamBufferHandle_t xStreamBuffer )
+	static size_t prvSendMultiProducer( StreamBuffer_t * const pxStreamBuffer,
+										const StreamBufferFragment_t *pxFragments,
+										UBaseType_t uxFragmentCount,
+										size_t xDataLengthBytes,
+										size_t xRequiredSpace,
+										TickType_t xTicksToWait )
 	{
-		return ( xStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER );
-	}
+	size_t xClaimed, xHead = 0;
+	TimeOut_t xTimeOut;
+	BaseType_t xEntryTimeSet = pdFALSE;
 
-#endif /* configUSE_TRACE_FACILITY */
+		for( ;; )
+		{
+			if( ( pxStreamBuffer->ucFlags & sbFLAGS_WAKE_SENDERS ) != ( uint8_t ) 0 )
+			{
+				/* Space was freed from an interrupt, which only unblocked the
+				highest priority waiting task.  Unblock the others before
+				trying to claim space. */
+				prvUnblockWaitingSenders( pxStreamBuffer );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			taskENTER_CRITICAL();
+			{
+				/* Claim the space if all the data fits, or if the block time
+				has expired, in which case a stream buffer claims as much space
+				as is free. */
+				if( ( xStreamBufferSpacesAvailable( pxStreamBuffer ) >= xRequiredSpace ) || ( xTicksToWait == ( TickType_t ) 0 ) )
+				{
+					xClaimed = prvClaimSpace( pxStreamBuffer, xRequiredSpace, &xHead );
+					taskEXIT_CRITICAL();
+					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskInternalSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Unlike the single writer case any number of tasks can wait
+				for space, so the task is placed in an event list rather than
+				waiting for a notification.  All ports allow a yield from
+				within a critical section. */
+				traceBLOCKING_ON_STREAM_BUFFER_SEND( pxStreamBuffer );
+				vTaskPlaceOnEventList( &( pxStreamBuffer->xTasksWaitingToSend ), xTicksToWait );
+				portYIELD_WITHIN_API();
+			}
+			taskEXIT_CRITICAL();
+
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+			{
+				/* The block time expired or the wait was aborted, so claim
+				whatever space is free on the next pass. */
+				xTicksToWait = ( TickType_t ) 0;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( xClaimed > ( size_t ) 0 )
+		{
+			/* Copy the data with interrupts enabled so other writers can
+			claim and fill space at the same time. */
+			if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+			{
+				xHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xDataLengthBytes ), sbBYTES_TO_STORE_MESSAGE_LENGTH, xHead );
+			}
+			else
+			{
+				xDataLengthBytes = xClaimed;
+			}
+
+			( void ) prvWriteFragmentsToBuffer( pxStreamBuffer, pxFragments, uxFragmentCount, xDataLengthBytes, xHead );
+
+			taskENTER_CRITICAL();
+			{
+				prvPublishClaimedSpace( pxStreamBuffer );
+			}
+			taskEXIT_CRITICAL();
+		}
+		else
+		{
+			xDataLengthBytes = 0;
+		}
+
+		return xDataLengthBytes;
+	}
+
+#endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+
+	static size_t prvSendMultiProducerFromISR( StreamBuffer_t * const pxStreamBuffer,
+											   const StreamBufferFragment_t *pxFragments,
+											   UBaseType_t uxFragmentCount,
+											   size_t xDataLengthBytes,
+											   size_t xRequiredSpace )
+	{
+	size_t xClaimed, xHead = 0;
+	UBaseType_t uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			xClaimed = prvClaimSpace( pxStreamBuffer, xRequiredSpace, &xHead );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		if( xClaimed > ( size_t ) 0 )
+		{
+			if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+			{
+				xHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xDataLengthBytes ), sbBYTES_TO_STORE_MESSAGE_LENGTH, xHead );
+			}
+			else
+			{
+				xDataLengthBytes = xClaimed;
+			}
+
+			( void ) prvWriteFragmentsToBuffer( pxStreamBuffer, pxFragments, uxFragmentCount, xDataLengthBytes, xHead );
+
+			uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+			{
+				prvPublishClaimedSpace( pxStreamBuffer );
+			}
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		else
+		{
+			xDataLengthBytes = 0;
+		}
+
+		return xDataLengthBytes;
+	}
+
+#endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+
+	static size_t prvClaimSpace( StreamBuffer_t * const pxStreamBuffer,
+								 size_t xRequiredSpace,
+								 size_t * const pxHead )
+	{
+	size_t xSpace, xNextHead;
+
+		xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+
+		if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 )
+		{
+			/* A stream buffer takes as many bytes as possible. */
+			xSpace = configMIN( xSpace, xRequiredSpace );
+		}
+		else if( xSpace >= xRequiredSpace )
+		{
+			/* A message buffer needs space for both the length and the
+			message. */
+			xSpace = xRequiredSpace;
+		}
+		else
+		{
+			xSpace = 0;
+		}
+
+		if( xSpace > ( size_t ) 0 )
+		{
+			*pxHead = pxStreamBuffer->xReserveHead;
+
+			xNextHead = *pxHead + xSpace;
+
+			if( xNextHead >= pxStreamBuffer->xLength )
+			{
+				xNextHead -= pxStreamBuffer->xLength;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxStreamBuffer->xReserveHead = xNextHead;
+			( pxStreamBuffer->uxWritesInProgress )++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xSpace;
+	}
+
+#endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+
+	static void prvPublishClaimedSpace( StreamBuffer_t * const pxStreamBuffer )
+	{
+		configASSERT( pxStreamBuffer->uxWritesInProgress > ( UBaseType_t ) 0 );
+
+		( pxStreamBuffer->uxWritesInProgress )--;
+
+		/* Space can only be claimed in order, so when no writes are in
+		progress every byte up to xReserveHead has been written. */
+		if( pxStreamBuffer->uxWritesInProgress == ( UBaseType_t ) 0 )
+		{
+			pxStreamBuffer->xHead = pxStreamBuffer->xReserveHead;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+
+	static void prvUnblockWaitingSenders( StreamBuffer_t * const pxStreamBuffer )
+	{
+	BaseType_t xYieldRequired = pdFALSE;
+	UBaseType_t uxSendersToWake;
+
+		/* Single producer buffers use xTaskWaitingToSend instead. */
+		if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 )
+		{
+			/* Only the tasks that are waiting now are unblocked, so a task
+			that blocks again while this loop runs is not unblocked twice. */
+			taskENTER_CRITICAL();
+			{
+				pxStreamBuffer->ucFlags &= ( uint8_t ) ~sbFLAGS_WAKE_SENDERS;
+				uxSendersToWake = listCURRENT_LIST_LENGTH( &( pxStreamBuffer->xTasksWaitingToSend ) );
+			}
+			taskEXIT_CRITICAL();
+
+			while( uxSendersToWake > ( UBaseType_t ) 0U )
+			{
+				uxSendersToWake--;
+
+				/* Interrupts are only masked for the time taken to unblock one
+				task. */
+				taskENTER_CRITICAL();
+				{
+					if( ( listLIST_IS_EMPTY( &( pxStreamBuffer->xTasksWaitingToSend ) ) == pdFALSE ) && ( xStreamBufferSpacesAvailable( pxStreamBuffer ) > ( size_t ) 0 ) )
+					{
+						if( xTaskRemoveFromEventList( &( pxStreamBuffer->xTasksWaitingToSend ) ) != pdFALSE )
+						{
+							xYieldRequired = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						/* Either no tasks are left or writers have filled the
+						buffer again, in which case the remaining tasks are
+						unblocked when space is next freed. */
+						uxSendersToWake = ( UBaseType_t ) 0U;
+					}
+				}
+				taskEXIT_CRITICAL();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		#if( configUSE_PREEMPTION == 1 )
+		{
+			if( xYieldRequired != pdFALSE )
+			{
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#else
+		{
+			( void ) xYieldRequired;
+		}
+		#endif
+	}
+
+#endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+
+	static BaseType_t prvUnblockWaitingSendersFromISR( StreamBuffer_t * const pxStreamBuffer,
+														BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	BaseType_t xReturn = pdFALSE;
+	UBaseType_t uxSavedInterruptStatus;
+
+		if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 )
+		{
+			uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+			{
+				if( listLIST_IS_EMPTY( &( pxStreamBuffer->xTasksWaitingToSend ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxStreamBuffer->xTasksWaitingToSend ) ) != pdFALSE )
+					{
+						if( pxHigherPriorityTaskWoken != NULL )
+						{
+							*pxHigherPriorityTaskWoken = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* The task just unblocked unblocks any others. */
+					if( listLIST_IS_EMPTY( &( pxStreamBuffer->xTasksWaitingToSend ) ) == pdFALSE )
+					{
+						pxStreamBuffer->ucFlags |= sbFLAGS_WAKE_SENDERS;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
+										  uint8_t * const pucBuffer,
+										  size_t xBufferSizeBytes,
+										  size_t xTriggerLevelBytes,
+										  uint8_t ucFlags )
+{
+	/* Assert here is deliberately writing to the entire buffer to ensure it can
+	be written to without generating exceptions, and is setting the buffer to a
+	known value to assist in development/debugging. */
+	#if( configASSERT_DEFINED == 1 )
+	{
+		/* The value written just has to be identifiable when looking at the
+		memory.  Don't use 0xA5 as that is the stack fill value and could
+		result in confusion as to what is actually being observed. */
+		const BaseType_t xWriteValue = 0x55;
+		configASSERT( memset( pucBuffer, ( int ) xWriteValue, xBufferSizeBytes ) == pucBuffer );
+	} /*lint !e529 !e438 xWriteValue is only used if configASSERT() is defined. */
+	#endif
+
+	( void ) memset( ( void * ) pxStreamBuffer, 0x00, sizeof( StreamBuffer_t ) ); /*lint !e9087 memset() requires void *. */
+	pxStreamBuffer->pucBuffer = pucBuffer;
+	pxStreamBuffer->xLength = xBufferSizeBytes;
+	pxStreamBuffer->xTriggerLevelBytes = xTriggerLevelBytes;
+	pxStreamBuffer->ucFlags = ucFlags;
+
+	#if( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+	{
+		vListInitialise( &( pxStreamBuffer->xTasksWaitingToSend ) );
+	}
+	#endif
+}
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	UBaseType_t uxStreamBufferGetStreamBufferNumber( StreamBufferHandle_t xStreamBuffer )
+	{
+		return xStreamBuffer->uxStreamBufferNumber;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	void vStreamBufferSetStreamBufferNumber( StreamBufferHandle_t xStreamBuffer, UBaseType_t uxStreamBufferNumber )
+	{
+		xStreamBuffer->uxStreamBufferNumber = uxStreamBufferNumber;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	uint8_t ucStreamBufferGetStreamBufferType( StreamBufferHandle_t xStreamBuffer )
+	{
+		return ( xStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER );
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	StreamBufferMuxHandle_t xStreamBufferMuxCreate( UBaseType_t uxChannels,
+													UBaseType_t uxBlockCount,
+													size_t xBlockSizeBytes )
+	{
+	StreamBufferMux_t *pxMux;
+	uint8_t *pucAllocatedMemory;
+	size_t xChannelsSize, xLinksSize, xPoolSize;
+	UBaseType_t ux;
+
+		configASSERT( uxChannels > ( UBaseType_t ) 0 );
+		configASSERT( ( uxBlockCount > ( UBaseType_t ) 0 ) && ( uxBlockCount != sbMUX_NO_BLOCK ) );
+		configASSERT( xBlockSizeBytes > ( size_t ) 0 );
+
+		xChannelsSize = ( size_t ) uxChannels * sizeof( StreamBufferMuxChannel_t );
+		xLinksSize = ( size_t ) uxBlockCount * sizeof( UBaseType_t );
+		xPoolSize = ( size_t ) uxBlockCount * xBlockSizeBytes;
+
+		/* Overflow? */
+		configASSERT( ( xPoolSize / xBlockSizeBytes ) == ( size_t ) uxBlockCount );
+
+		/* The StreamBufferMux_t structure, the channel structures, the block
+		links and the pool are all allocated in a single call to
+		pvPortMalloc(), in that order.  The structure and the channel structures
+		contain UBaseType_t members, so the links that follow them remain
+		aligned.  The pool is a uint8_t array so has no alignment
+		requirement. */
+		pucAllocatedMemory = ( uint8_t * ) pvPortMalloc( sizeof( StreamBufferMux_t ) + xChannelsSize + xLinksSize + xPoolSize ); /*lint !e9079 malloc() only returns void*. */
+
+		if( pucAllocatedMemory != NULL )
+		{
+			pxMux = ( StreamBufferMux_t * ) pucAllocatedMemory; /*lint !e9087 !e826 Safe cast as allocated memory is aligned. */
+			pxMux->pxChannels = ( StreamBufferMuxChannel_t * ) ( pucAllocatedMemory + sizeof( StreamBufferMux_t ) ); /*lint !e9087 !e826 Safe cast as allocated memory is aligned. */
+			pxMux->puxNextBlock = ( UBaseType_t * ) ( pucAllocatedMemory + sizeof( StreamBufferMux_t ) + xChannelsSize ); /*lint !e9087 !e826 Safe cast as allocated memory is aligned. */
+			pxMux->pucPool = pucAllocatedMemory + sizeof( StreamBufferMux_t ) + xChannelsSize + xLinksSize;
+			pxMux->uxChannels = uxChannels;
+			pxMux->uxBlockCount = uxBlockCount;
+			pxMux->xBlockSizeBytes = xBlockSizeBytes;
+
+			for( ux = ( UBaseType_t ) 0; ux < uxChannels; ux++ )
+			{
+				( void ) memset( ( void * ) &( pxMux->pxChannels[ ux ] ), 0x00, sizeof( StreamBufferMuxChannel_t ) ); /*lint !e9087 memset() requires void *. */
+				pxMux->pxChannels[ ux ].uxHeadBlock = sbMUX_NO_BLOCK;
+				pxMux->pxChannels[ ux ].uxTailBlock = sbMUX_NO_BLOCK;
+				pxMux->pxChannels[ ux ].xTriggerLevelBytes = ( size_t ) 1;
+			}
+
+			/* Every block starts in the list of free blocks. */
+			for( ux = ( UBaseType_t ) 0; ux < uxBlockCount; ux++ )
+			{
+				pxMux->puxNextBlock[ ux ] = ux + ( UBaseType_t ) 1;
+			}
+
+			pxMux->puxNextBlock[ uxBlockCount - ( UBaseType_t ) 1 ] = sbMUX_NO_BLOCK;
+			pxMux->uxFreeBlock = ( UBaseType_t ) 0;
+			pxMux->uxFreeBlocks = uxBlockCount;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( StreamBufferMuxHandle_t ) pucAllocatedMemory; /*lint !e9087 !e826 Safe cast as allocated memory is aligned. */
+	}
+
+#endif /* ( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	void vStreamBufferMuxDelete( StreamBufferMuxHandle_t xStreamBufferMux )
+	{
+		configASSERT( xStreamBufferMux );
+
+		/* The structures, links and pool were allocated using a single call to
+		pvPortMalloc(), hence only one call to vPortFree() is required. */
+		vPortFree( ( void * ) xStreamBufferMux ); /*lint !e9087 Standard free() semantics require void *. */
+	}
+
+#endif /* ( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	size_t xStreamBufferMuxSend( StreamBufferMuxHandle_t xStreamBufferMux,
+								 UBaseType_t uxChannel,
+								 const void *pvTxData,
+								 size_t xDataLengthBytes,
+								 TickType_t xTicksToWait )
+	{
+	StreamBufferMux_t * const pxMux = xStreamBufferMux;
+	StreamBufferMuxChannel_t *pxChannel;
+	UBaseType_t uxBlock = sbMUX_NO_BLOCK;
+	size_t xReturn, xOffset = 0;
+
+		configASSERT( pxMux );
+		configASSERT( uxChannel < pxMux->uxChannels );
+		configASSERT( pvTxData );
+
+		pxChannel = &( pxMux->pxChannels[ uxChannel ] );
+
+		xReturn = prvMuxWaitAndClaim( pxMux, pxChannel, xDataLengthBytes, &uxBlock, &xOffset, xTicksToWait );
+
+		if( xReturn > ( size_t ) 0 )
+		{
+			/* The claimed blocks belong to this channel, and the reader cannot
+			see them until xBytesAvailable is updated, so the copy is made with
+			interrupts enabled. */
+			prvMuxCopyIn( pxMux, uxBlock, xOffset, ( const uint8_t * ) pvTxData, xReturn ); /*lint !e9079 Storage buffer is implemented as uint8_t for ease of sizing, alighment and access. */
+
+			taskENTER_CRITICAL();
+			{
+				pxChannel->xBytesAvailable += xReturn;
+				pxChannel->xBytesInFlight = ( size_t ) 0;
+			}
+			taskEXIT_CRITICAL();
+
+			/* Was a task waiting for the data? */
+			if( pxChannel->xBytesAvailable >= pxChannel->xTriggerLevelBytes )
+			{
+				prvMuxUnblockReceiver( pxChannel );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	size_t xStreamBufferMuxSendFromISR( StreamBufferMuxHandle_t xStreamBufferMux,
+										UBaseType_t uxChannel,
+										const void *pvTxData,
+										size_t xDataLengthBytes,
+										BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	StreamBufferMux_t * const pxMux = xStreamBufferMux;
+	StreamBufferMuxChannel_t *pxChannel;
+	UBaseType_t uxBlock = sbMUX_NO_BLOCK, uxSavedInterruptStatus;
+	size_t xReturn, xOffset = 0;
+
+		configASSERT( pxMux );
+		configASSERT( uxChannel < pxMux->uxChannels );
+		configASSERT( pvTxData );
+
+		pxChannel = &( pxMux->pxChannels[ uxChannel ] );
+
+		uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			xReturn = prvMuxClaim( pxMux, pxChannel, xDataLengthBytes, &uxBlock, &xOffset );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		if( xReturn > ( size_t ) 0 )
+		{
+			prvMuxCopyIn( pxMux, uxBlock, xOffset, ( const uint8_t * ) pvTxData, xReturn ); /*lint !e9079 Storage buffer is implemented as uint8_t for ease of sizing, alighment and access. */
+
+			uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+			{
+				pxChannel->xBytesAvailable += xReturn;
+				pxChannel->xBytesInFlight = ( size_t ) 0;
+			}
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+			if( pxChannel->xBytesAvailable >= pxChannel->xTriggerLevelBytes )
+			{
+				prvMuxUnblockReceiverFromISR( pxChannel, pxHigherPriorityTaskWoken );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	size_t xStreamBufferMuxReceive( StreamBufferMuxHandle_t xStreamBufferMux,
+									UBaseType_t uxChannel,
+									void *pvRxData,
+									size_t xBufferLengthBytes,
+									TickType_t xTicksToWait )
+	{
+	StreamBufferMux_t * const pxMux = xStreamBufferMux;
+	StreamBufferMuxChannel_t *pxChannel;
+	UBaseType_t uxBlocksFreed;
+	size_t xReceivedLength;
+
+		configASSERT( pxMux );
+		configASSERT( uxChannel < pxMux->uxChannels );
+		configASSERT( pvRxData );
+
+		pxChannel = &( pxMux->pxChannels[ uxChannel ] );
+
+		xReceivedLength = configMIN( prvMuxWaitForData( pxChannel, xTicksToWait ), xBufferLengthBytes );
+
+		if( xReceivedLength > ( size_t ) 0 )
+		{
+			/* Only the reader moves the tail, and the writer only adds blocks
+			after the ones being read, so the copy is made with interrupts
+			enabled. */
+			prvMuxCopyOut( pxMux, pxChannel->uxTailBlock, pxChannel->xTailOffset, ( uint8_t * ) pvRxData, xReceivedLength ); /*lint !e9079 Data storage area is implemented as uint8_t array for ease of sizing, indexing and alignment. */
+
+			taskENTER_CRITICAL();
+			{
+				uxBlocksFreed = prvMuxConsume( pxMux, pxChannel, xReceivedLength );
+			}
+			taskEXIT_CRITICAL();
+
+			/* Were any tasks waiting for space in the pool? */
+			if( uxBlocksFreed > ( UBaseType_t ) 0 )
+			{
+				prvMuxUnblockSenders( pxMux );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReceivedLength;
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	size_t xStreamBufferMuxReceiveFromISR( StreamBufferMuxHandle_t xStreamBufferMux,
+										   UBaseType_t uxChannel,
+										   void *pvRxData,
+										   size_t xBufferLengthBytes,
+										   BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	StreamBufferMux_t * const pxMux = xStreamBufferMux;
+	StreamBufferMuxChannel_t *pxChannel;
+	UBaseType_t uxBlocksFreed, uxSavedInterruptStatus;
+	size_t xReceivedLength;
+
+		configASSERT( pxMux );
+		configASSERT( uxChannel < pxMux->uxChannels );
+		configASSERT( pvRxData );
+
+		pxChannel = &( pxMux->pxChannels[ uxChannel ] );
+
+		xReceivedLength = configMIN( pxChannel->xBytesAvailable, xBufferLengthBytes );
+
+		if( xReceivedLength > ( size_t ) 0 )
+		{
+			prvMuxCopyOut( pxMux, pxChannel->uxTailBlock, pxChannel->xTailOffset, ( uint8_t * ) pvRxData, xReceivedLength ); /*lint !e9079 Data storage area is implemented as uint8_t array for ease of sizing, indexing and alignment. */
+
+			uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+			{
+				uxBlocksFreed = prvMuxConsume( pxMux, pxChannel, xReceivedLength );
+			}
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+			if( uxBlocksFreed > ( UBaseType_t ) 0 )
+			{
+				prvMuxUnblockSendersFromISR( pxMux, pxHigherPriorityTaskWoken );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReceivedLength;
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	size_t xStreamBufferMuxBytesAvailable( StreamBufferMuxHandle_t xStreamBufferMux,
+										   UBaseType_t uxChannel )
+	{
+	const StreamBufferMux_t * const pxMux = xStreamBufferMux;
+
+		configASSERT( pxMux );
+		configASSERT( uxChannel < pxMux->uxChannels );
+
+		return pxMux->pxChannels[ uxChannel ].xBytesAvailable;
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	size_t xStreamBufferMuxSpacesAvailable( StreamBufferMuxHandle_t xStreamBufferMux,
+											UBaseType_t uxChannel )
+	{
+	const StreamBufferMux_t * const pxMux = xStreamBufferMux;
+	size_t xSpace;
+
+		configASSERT( pxMux );
+		configASSERT( uxChannel < pxMux->uxChannels );
+
+		taskENTER_CRITICAL();
+		{
+			xSpace = prvMuxSpaceForChannel( pxMux, &( pxMux->pxChannels[ uxChannel ] ) );
+		}
+		taskEXIT_CRITICAL();
+
+		return xSpace;
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	BaseType_t xStreamBufferMuxSetTriggerLevel( StreamBufferMuxHandle_t xStreamBufferMux,
+												UBaseType_t uxChannel,
+												size_t xTriggerLevel )
+	{
+	StreamBufferMux_t * const pxMux = xStreamBufferMux;
+	BaseType_t xReturn;
+
+		configASSERT( pxMux );
+		configASSERT( uxChannel < pxMux->uxChannels );
+
+		/* It is not valid for the trigger level to be 0. */
+		if( xTriggerLevel == ( size_t ) 0 )
+		{
+			xTriggerLevel = ( size_t ) 1;
+		}
+
+		/* A channel can never hold more than the whole pool. */
+		if( xTriggerLevel <= ( ( size_t ) pxMux->uxBlockCount * pxMux->xBlockSizeBytes ) )
+		{
+			pxMux->pxChannels[ uxChannel ].xTriggerLevelBytes = xTriggerLevel;
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	static size_t prvMuxSpaceForChannel( const StreamBufferMux_t * const pxMux,
+										 const StreamBufferMuxChannel_t * const pxChannel )
+	{
+	size_t xSpace;
+
+		xSpace = ( size_t ) pxMux->uxFreeBlocks * pxMux->xBlockSizeBytes;
+
+		if( pxChannel->uxHeadBlock != sbMUX_NO_BLOCK )
+		{
+			/* The rest of the block being written is also free. */
+			xSpace += pxMux->xBlockSizeBytes - pxChannel->xHeadOffset;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xSpace;
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	static size_t prvMuxClaim( StreamBufferMux_t * const pxMux,
+							   StreamBufferMuxChannel_t * const pxChannel,
+							   size_t xCount,
+							   UBaseType_t * const puxBlock,
+							   size_t * const pxOffset )
+	{
+	UBaseType_t uxBlock;
+	size_t xRemaining, xChunk;
+
+		/* Should only be one writer per channel. */
+		configASSERT( pxChannel->xBytesInFlight == ( size_t ) 0 );
+
+		xCount = configMIN( xCount, prvMuxSpaceForChannel( pxMux, pxChannel ) );
+
+		*puxBlock = pxChannel->uxHeadBlock;
+		*pxOffset = pxChannel->xHeadOffset;
+		xRemaining = xCount;
+
+		while( xRemaining > ( size_t ) 0 )
+		{
+			if( ( pxChannel->uxHeadBlock == sbMUX_NO_BLOCK ) || ( pxChannel->xHeadOffset == pxMux->xBlockSizeBytes ) )
+			{
+				/* Take a block from the pool and add it to the end of the
+				channel's chain.  The free space was checked above, so there
+				must be a free block. */
+				uxBlock = pxMux->uxFreeBlock;
+				configASSERT( uxBlock != sbMUX_NO_BLOCK );
+				pxMux->uxFreeBlock = pxMux->puxNextBlock[ uxBlock ];
+				( pxMux->uxFreeBlocks )--;
+				pxMux->puxNextBlock[ uxBlock ] = sbMUX_NO_BLOCK;
+
+				if( pxChannel->uxHeadBlock == sbMUX_NO_BLOCK )
+				{
+					/* The channel held no blocks, so the next read starts at
+					the beginning of this one. */
+					pxChannel->uxTailBlock = uxBlock;
+					pxChannel->xTailOffset = ( size_t ) 0;
+				}
+				else
+				{
+					pxMux->puxNextBlock[ pxChannel->uxHeadBlock ] = uxBlock;
+				}
+
+				if( xRemaining == xCount )
+				{
+					/* The write starts in this block rather than at the end of
+					the previous head block, which the reader is free to
+					return to the pool once it has been read. */
+					*puxBlock = uxBlock;
+					*pxOffset = ( size_t ) 0;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxChannel->uxHeadBlock = uxBlock;
+				pxChannel->xHeadOffset = ( size_t ) 0;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			xChunk = configMIN( pxMux->xBlockSizeBytes - pxChannel->xHeadOffset, xRemaining );
+			pxChannel->xHeadOffset += xChunk;
+			xRemaining -= xChunk;
+		}
+
+		pxChannel->xBytesInFlight = xCount;
+
+		return xCount;
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	static UBaseType_t prvMuxConsume( StreamBufferMux_t * const pxMux,
+									  StreamBufferMuxChannel_t * const pxChannel,
+									  size_t xCount )
+	{
+	UBaseType_t uxBlock, uxBlocksFreed = 0;
+	size_t xChunk;
+
+		configASSERT( xCount <= pxChannel->xBytesAvailable );
+
+		pxChannel->xBytesAvailable -= xCount;
+
+		do
+		{
+			xChunk = configMIN( pxMux->xBlockSizeBytes - pxChannel->xTailOffset, xCount );
+			pxChannel->xTailOffset += xChunk;
+			xCount -= xChunk;
+
+			/* The block being written stays in the chain even once it has
+			been read to the end, as the writer links the next block to it. */
+			if( ( pxChannel->xTailOffset == pxMux->xBlockSizeBytes ) && ( pxChannel->uxTailBlock != pxChannel->uxHeadBlock ) )
+			{
+				uxBlock = pxChannel->uxTailBlock;
+				pxChannel->uxTailBlock = pxMux->puxNextBlock[ uxBlock ];
+				pxChannel->xTailOffset = ( size_t ) 0;
+
+				pxMux->puxNextBlock[ uxBlock ] = pxMux->uxFreeBlock;
+				pxMux->uxFreeBlock = uxBlock;
+				( pxMux->uxFreeBlocks )++;
+				uxBlocksFreed++;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		} while( xCount > ( size_t ) 0 );
+
+		if( ( pxChannel->xBytesAvailable == ( size_t ) 0 ) && ( pxChannel->xBytesInFlight == ( size_t ) 0 ) )
+		{
+			/* The channel is empty, so its last block is returned to the pool
+			too rather than being held by an idle channel. */
+			configASSERT( pxChannel->uxTailBlock == pxChannel->uxHeadBlock );
+
+			uxBlock = pxChannel->uxHeadBlock;
+			pxMux->puxNextBlock[ uxBlock ] = pxMux->uxFreeBlock;
+			pxMux->uxFreeBlock = uxBlock;
+			( pxMux->uxFreeBlocks )++;
+			uxBlocksFreed++;
+
+			pxChannel->uxHeadBlock = sbMUX_NO_BLOCK;
+			pxChannel->uxTailBlock = sbMUX_NO_BLOCK;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return uxBlocksFreed;
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	static void prvMuxCopyIn( const StreamBufferMux_t * const pxMux,
+							  UBaseType_t uxBlock,
+							  size_t xOffset,
+							  const uint8_t *pucData,
+							  size_t xCount )
+	{
+	size_t xChunk;
+
+		while( xCount > ( size_t ) 0 )
+		{
+			if( xOffset == pxMux->xBlockSizeBytes )
+			{
+				/* Continue at the start of the next block in the chain. */
+				uxBlock = pxMux->puxNextBlock[ uxBlock ];
+				xOffset = ( size_t ) 0;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			configASSERT( uxBlock < pxMux->uxBlockCount );
+			xChunk = configMIN( pxMux->xBlockSizeBytes - xOffset, xCount );
+			( void ) memcpy( ( void * ) &( pxMux->pucPool[ ( ( size_t ) uxBlock * pxMux->xBlockSizeBytes ) + xOffset ] ), ( const void * ) pucData, xChunk ); /*lint !e9087 memcpy() requires void *. */
+
+			pucData += xChunk;
+			xOffset += xChunk;
+			xCount -= xChunk;
+		}
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	static void prvMuxCopyOut( const StreamBufferMux_t * const pxMux,
+							   UBaseType_t uxBlock,
+							   size_t xOffset,
+							   uint8_t *pucData,
+							   size_t xCount )
+	{
+	size_t xChunk;
+
+		while( xCount > ( size_t ) 0 )
+		{
+			if( xOffset == pxMux->xBlockSizeBytes )
+			{
+				uxBlock = pxMux->puxNextBlock[ uxBlock ];
+				xOffset = ( size_t ) 0;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			configASSERT( uxBlock < pxMux->uxBlockCount );
+			xChunk = configMIN( pxMux->xBlockSizeBytes - xOffset, xCount );
+			( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxMux->pucPool[ ( ( size_t ) uxBlock * pxMux->xBlockSizeBytes ) + xOffset ] ), xChunk ); /*lint !e9087 memcpy() requires void *. */
+
+			pucData += xChunk;
+			xOffset += xChunk;
+			xCount -= xChunk;
+		}
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	static size_t prvMuxWaitAndClaim( StreamBufferMux_t * const pxMux,
+									  StreamBufferMuxChannel_t * const pxChannel,
+									  size_t xCount,
+									  UBaseType_t * const puxBlock,
+									  size_t * const pxOffset,
+									  TickType_t xTicksToWait )
+	{
+	size_t xClaimed;
+	TimeOut_t xTimeOut;
+
+		vTaskSetTimeOutState( &xTimeOut );
+
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				if( ( prvMuxSpaceForChannel( pxMux, pxChannel ) >= xCount ) || ( xTicksToWait == ( TickType_t ) 0 ) )
+				{
+					xClaimed = prvMuxClaim( pxMux, pxChannel, xCount, puxBlock, pxOffset );
+					taskEXIT_CRITICAL();
+					break;
+				}
+				else
+				{
+					/* Clear notification state as going to wait for space. */
+					( void ) xTaskNotifyStateClearIndexed( NULL, configKERNEL_NOTIFICATION_INDEX );
+
+					/* Should only be one writer per channel. */
+					configASSERT( pxChannel->xTaskWaitingToSend == NULL );
+					pxChannel->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			( void ) xTaskNotifyWaitIndexed( configKERNEL_NOTIFICATION_INDEX, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			pxChannel->xTaskWaitingToSend = NULL;
+
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+			{
+				/* Claim whatever space is free on the next pass. */
+				xTicksToWait = ( TickType_t ) 0;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return xClaimed;
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	static size_t prvMuxWaitForData( StreamBufferMuxChannel_t * const pxChannel,
+									 TickType_t xTicksToWait )
+	{
+	size_t xBytesAvailable;
+
+		if( xTicksToWait != ( TickType_t ) 0 )
+		{
+			/* Checking if there is data and clearing the notification state
+			must be performed atomically. */
+			taskENTER_CRITICAL();
+			{
+				xBytesAvailable = pxChannel->xBytesAvailable;
+
+				if( xBytesAvailable == ( size_t ) 0 )
+				{
+					/* Clear notification state as going to wait for data. */
+					( void ) xTaskNotifyStateClearIndexed( NULL, configKERNEL_NOTIFICATION_INDEX );
+
+					/* Should only be one reader per channel. */
+					configASSERT( pxChannel->xTaskWaitingToReceive == NULL );
+					pxChannel->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			if( xBytesAvailable == ( size_t ) 0 )
+			{
+				/* Wait for data to be available. */
+				( void ) xTaskNotifyWaitIndexed( configKERNEL_NOTIFICATION_INDEX, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+				pxChannel->xTaskWaitingToReceive = NULL;
+
+				/* Recheck the data available after blocking. */
+				xBytesAvailable = pxChannel->xBytesAvailable;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			xBytesAvailable = pxChannel->xBytesAvailable;
+		}
+
+		return xBytesAvailable;
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	static void prvMuxUnblockReceiver( StreamBufferMuxChannel_t * const pxChannel )
+	{
+		vTaskSuspendAll();
+		{
+			if( pxChannel->xTaskWaitingToReceive != NULL )
+			{
+				( void ) xTaskNotifyIndexed( pxChannel->xTaskWaitingToReceive,
+											 configKERNEL_NOTIFICATION_INDEX,
+											 ( uint32_t ) 0,
+											 eNoAction );
+				pxChannel->xTaskWaitingToReceive = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		( void ) xTaskResumeAll();
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	static void prvMuxUnblockReceiverFromISR( StreamBufferMuxChannel_t * const pxChannel,
+											  BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( pxChannel->xTaskWaitingToReceive != NULL )
+			{
+				( void ) xTaskNotifyIndexedFromISR( pxChannel->xTaskWaitingToReceive,
+													configKERNEL_NOTIFICATION_INDEX,
+													( uint32_t ) 0,
+													eNoAction,
+													pxHigherPriorityTaskWoken );
+				pxChannel->xTaskWaitingToReceive = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	static void prvMuxUnblockSenders( StreamBufferMux_t * const pxMux )
+	{
+	UBaseType_t ux;
+
+		vTaskSuspendAll();
+		{
+			for( ux = ( UBaseType_t ) 0; ux < pxMux->uxChannels; ux++ )
+			{
+				if( pxMux->pxChannels[ ux ].xTaskWaitingToSend != NULL )
+				{
+					( void ) xTaskNotifyIndexed( pxMux->pxChannels[ ux ].xTaskWaitingToSend,
+												 configKERNEL_NOTIFICATION_INDEX,
+												 ( uint32_t ) 0,
+												 eNoAction );
+					pxMux->pxChannels[ ux ].xTaskWaitingToSend = NULL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		( void ) xTaskResumeAll();
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_MULTIPLEXED_STREAM_BUFFERS == 1 )
+
+	static void prvMuxUnblockSendersFromISR( StreamBufferMux_t * const pxMux,
+											 BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	UBaseType_t ux, uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			for( ux = ( UBaseType_t ) 0; ux < pxMux->uxChannels; ux++ )
+			{
+				if( pxMux->pxChannels[ ux ].xTaskWaitingToSend != NULL )
+				{
+					( void ) xTaskNotifyIndexedFromISR( pxMux->pxChannels[ ux ].xTaskWaitingToSend,
+														configKERNEL_NOTIFICATION_INDEX,
+														( uint32_t ) 0,
+														eNoAction,
+														pxHigherPriorityTaskWoken );
+					pxMux->pxChannels[ ux ].xTaskWaitingToSend = NULL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+#endif /* configUSE_MULTIPLEXED_STREAM_BUFFERS */
 /*-----------------------------------------------------------*/
@@ -64,10 +64,26 @@ functions but without including stdio.h here. */
 	#define taskYIELD_IF_USING_PREEMPTION() portYIELD_WITHIN_API()
 #endif
 
-/* Values that can be assigned to the ucNotifyState member of the TCB. */
+/* Values that can be assigned to the entries of the ucNotifyState member of the
+TCB. */
 #define taskNOT_WAITING_NOTIFICATION	( ( uint8_t ) 0 )
 #define taskWAITING_NOTIFICATION		( ( uint8_t ) 1 )
 #define taskNOTIFICATION_RECEIVED		( ( uint8_t ) 2 )
+#define taskWAITING_ANY_NOTIFICATION_BITS	( ( uint8_t ) 3 )
+#define taskWAITING_ALL_NOTIFICATION_BITS	( ( uint8_t ) 4 )
+
+/* Evaluates to pdTRUE if the notify state ucState indicates the task is blocked
+waiting for a notification, either any notification or specific bits. */
+#define taskIS_WAITING_NOTIFICATION( ucState ) ( ( ( ucState ) == taskWAITING_NOTIFICATION ) || ( ( ucState ) >= taskWAITING_ANY_NOTIFICATION_BITS ) )
+
+/* Evaluates to pdTRUE if a task in notify state ucState should stop waiting
+given the notification value ulValue.  A task waiting for any notification
+always stops waiting, a task waiting in xTaskGenericNotifyWaitBits() only
+stops waiting once ulValue satisfies its bit mask ulBits. */
+#define taskNOTIFY_WAIT_CONDITION_MET( ucState, ulValue, ulBits )										\
+	( ( ( ucState ) == taskWAITING_NOTIFICATION ) ||													\
+	  ( ( ( ucState ) == taskWAITING_ANY_NOTIFICATION_BITS ) && ( ( ( ulValue ) & ( ulBits ) ) != 0UL ) ) ||	\
+	  ( ( ( ucState ) == taskWAITING_ALL_NOTIFICATION_BITS ) && ( ( ( ulValue ) & ( ulBits ) ) == ( ulBits ) ) ) )
 
 /*
  * The value used to fill the stack of a task when the task is created.  This
@@ -142,8 +158,9 @@ configIDLE_TASK_NAME in FreeRTOSConfig.h. */
 		}																								\
 																										\
 		/* listGET_OWNER_OF_NEXT_ENTRY indexes through the list, so the tasks of						\
-		the	same priority get an equal share of the processor time. */									\
-		listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );			\
+		the	same priority get an equal share of the processor time (other than						\
+		in the EDF ready list, see taskSELECT_TASK_FROM_READY_LIST()). */								\
+		taskSELECT_TASK_FROM_READY_LIST( uxTopPriority );												\
 		uxTopReadyPriority = uxTopPriority;																\
 	} /* taskSELECT_HIGHEST_PRIORITY_TASK */
 
@@ -155,6 +172,77 @@ configIDLE_TASK_NAME in FreeRTOSConfig.h. */
 	#define taskRESET_READY_PRIORITY( uxPriority )
 	#define portRESET_READY_PRIORITY( uxPriority, uxTopReadyPriority )
 
+#elif ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 2 )
+
+	/* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 2 then task selection uses
+	a two level bit map, allowing the highest priority ready task to be found
+	in constant time when configMAX_PRIORITIES is greater than 32.  Each word
+	of ulReadyPriorities holds a bit for each of 32 priorities, and bit n of
+	ulReadyPriorityGroups is set when word n of ulReadyPriorities is non-zero.
+	The port can provide portCOUNT_LEADING_ZEROS() to use a count leading zeros
+	instruction, otherwise a generic C implementation is used. */
+
+	#if( configMAX_PRIORITIES > 256 )
+		#error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 2 when configMAX_PRIORITIES is less than or equal to 256.
+	#endif
+
+	#define taskREADY_PRIORITY_WORDS				( ( ( UBaseType_t ) configMAX_PRIORITIES + ( UBaseType_t ) 31 ) >> 5 )
+	#define taskREADY_PRIORITY_WORD( uxPriority )	( ( UBaseType_t ) ( uxPriority ) >> 5 )
+	#define taskREADY_PRIORITY_BIT( uxPriority )	( ( uint32_t ) 1 << ( ( UBaseType_t ) ( uxPriority ) & ( UBaseType_t ) 0x1f ) )
+
+	#ifdef portCOUNT_LEADING_ZEROS
+		#define taskGET_HIGHEST_SET_BIT( ulBitmap ) ( ( UBaseType_t ) 31 - ( UBaseType_t ) portCOUNT_LEADING_ZEROS( ( ulBitmap ) ) )
+	#else
+		#define taskGET_HIGHEST_SET_BIT( ulBitmap ) prvGetHighestSetBit( ( ulBitmap ) )
+	#endif
+
+	#define taskRECORD_READY_PRIORITY( uxPriority )															\
+	{																										\
+		ulReadyPriorities[ taskREADY_PRIORITY_WORD( uxPriority ) ] |= taskREADY_PRIORITY_BIT( uxPriority );	\
+		ulReadyPriorityGroups |= taskREADY_PRIORITY_BIT( taskREADY_PRIORITY_WORD( uxPriority ) );			\
+	} /* taskRECORD_READY_PRIORITY */
+
+	/*-----------------------------------------------------------*/
+
+	#define taskSELECT_HIGHEST_PRIORITY_TASK()																\
+	{																										\
+	UBaseType_t uxTopWord, uxTopPriority;																	\
+																											\
+		/* Find the highest priority list that contains ready tasks.  The idle							\
+		task is always ready so neither bit map can be zero here. */										\
+		configASSERT( ulReadyPriorityGroups != 0UL );														\
+		uxTopWord = taskGET_HIGHEST_SET_BIT( ulReadyPriorityGroups );										\
+		uxTopPriority = ( uxTopWord << 5 ) + taskGET_HIGHEST_SET_BIT( ulReadyPriorities[ uxTopWord ] );		\
+		configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 );				\
+		taskSELECT_TASK_FROM_READY_LIST( uxTopPriority );													\
+																											\
+		/* Not used for selection, but kept up to date for kernel aware									\
+		debuggers. */																						\
+		uxTopReadyPriority = uxTopPriority;																	\
+	} /* taskSELECT_HIGHEST_PRIORITY_TASK */
+
+	/*-----------------------------------------------------------*/
+
+	/* Clear the bit for uxPriority, and its group bit too if no other priority
+	in the same group has a ready task.  Defined here rather than by the port
+	as the bit maps are private to this file. */
+	#define portRESET_READY_PRIORITY( uxPriority, uxTopReadyPriority )										\
+	{																										\
+		ulReadyPriorities[ taskREADY_PRIORITY_WORD( uxPriority ) ] &= ~taskREADY_PRIORITY_BIT( uxPriority );	\
+		if( ulReadyPriorities[ taskREADY_PRIORITY_WORD( uxPriority ) ] == 0UL )								\
+		{																									\
+			ulReadyPriorityGroups &= ~taskREADY_PRIORITY_BIT( taskREADY_PRIORITY_WORD( uxPriority ) );		\
+		}																									\
+	}
+
+	#define taskRESET_READY_PRIORITY( uxPriority )															\
+	{																										\
+		if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ ( uxPriority ) ] ) ) == ( UBaseType_t ) 0 )		\
+		{																									\
+			portRESET_READY_PRIORITY( ( uxPriority ), ( uxTopReadyPriority ) );								\
+		}																									\
+	}
+
 #else /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
 
 	/* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 1 then task selection is
@@ -173,7 +261,7 @@ configIDLE_TASK_NAME in FreeRTOSConfig.h. */
 		/* Find the highest priority list that contains ready tasks. */								\
 		portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );								\
 		configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 );		\
-		listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );		\
+		taskSELECT_TASK_FROM_READY_LIST( uxTopPriority );											\
 	} /* taskSELECT_HIGHEST_PRIORITY_TASK() */
 
 	/*-----------------------------------------------------------*/
@@ -193,32 +281,186 @@ configIDLE_TASK_NAME in FreeRTOSConfig.h. */
 
 /*-----------------------------------------------------------*/
 
-/* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
-count overflows. */
-#define taskSWITCH_DELAYED_LISTS()																	\
-{																									\
-	List_t *pxTemp;																					\
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	/* Each level of the delayed task wheel has 32 slots, so the slots in use
+	within a level can be recorded in a 32-bit bit map. */
+	#define taskWHEEL_SLOT_BITS		( 5U )
+	#define taskWHEEL_SLOTS			( ( UBaseType_t ) 1U << taskWHEEL_SLOT_BITS )
+	#define taskWHEEL_SLOT_MASK		( taskWHEEL_SLOTS - ( UBaseType_t ) 1U )
+	#define taskWHEEL_LISTS			( ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS * taskWHEEL_SLOTS )
+
+	/* Tasks that wake taskWHEEL_RANGE or more ticks in the future are held in
+	the top level as if they woke taskWHEEL_RANGE - 1 ticks in the future, and
+	are placed again when that slot is moved down the wheel. */
+	#define taskWHEEL_RANGE			( ( TickType_t ) 1 << ( taskWHEEL_SLOT_BITS * ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS ) )
+
+	#if( configUSE_16_BIT_TICKS == 1 )
+		#if( ( configDELAYED_TASK_WHEEL_LEVELS < 1 ) || ( configDELAYED_TASK_WHEEL_LEVELS > 3 ) )
+			#error configDELAYED_TASK_WHEEL_LEVELS must be between 1 and 3 when configUSE_16_BIT_TICKS is set to 1.
+		#endif
+	#else
+		#if( ( configDELAYED_TASK_WHEEL_LEVELS < 1 ) || ( configDELAYED_TASK_WHEEL_LEVELS > 6 ) )
+			#error configDELAYED_TASK_WHEEL_LEVELS must be between 1 and 6.
+		#endif
+	#endif
+
+	/* The number of wheel events prvProcessDelayedTaskWheel() handles in one
+	call.  Only the slots that contain the wheel time at each level, plus the
+	event that made the call, can be due, so the limit is never reached unless
+	processing has fallen behind - in which case the remaining events are
+	handled on the following ticks rather than with interrupts masked for an
+	unbounded time. */
+	#define taskWHEEL_MAX_EVENTS_PER_TICK	( ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS + ( UBaseType_t ) 1U )
+
+	/* Evaluates to pdTRUE if pxList is one of the slots of either delayed task
+	wheel. */
+	#define taskLIST_IS_IN_WHEEL( pxList, xWheel ) ( ( ( pxList ) >= &( ( xWheel ).xSlots[ 0 ] ) ) && ( ( pxList ) < &( ( xWheel ).xSlots[ taskWHEEL_LISTS ] ) ) ) /*lint !e946 The comparison only identifies whether pxList is within the array. */
+	#define taskLIST_IS_IN_DELAYED_TASK_WHEEL( pxList ) ( ( taskLIST_IS_IN_WHEEL( ( pxList ), xDelayedTaskWheel1 ) || taskLIST_IS_IN_WHEEL( ( pxList ), xDelayedTaskWheel2 ) ) ? pdTRUE : pdFALSE )
+
+	/* pxDelayedTaskWheel and pxOverflowDelayedTaskWheel are switched when the
+	tick count overflows.  Every task in the current wheel has woken by then,
+	so any bits still set in its bit maps are for slots that have already been
+	emptied.  The tasks in the overflow wheel were placed relative to the last
+	tick before the overflow, which becomes the wheel time. */
+	#define taskSWITCH_DELAYED_LISTS()																\
+	{																								\
+		DelayedTaskWheel_t *pxTemp;																	\
+																									\
+		pxTemp = pxDelayedTaskWheel;																\
+		pxDelayedTaskWheel = pxOverflowDelayedTaskWheel;											\
+		pxOverflowDelayedTaskWheel = pxTemp;														\
+		( void ) memset( ( void * ) pxTemp->ulSlotsInUse, 0x00, sizeof( pxTemp->ulSlotsInUse ) );	\
+		xDelayedTaskWheelTime = portMAX_DELAY;														\
+		xNumOfOverflows++;																			\
+		prvResetNextTaskUnblockTime();																\
+	}
+
+#else /* configUSE_DELAYED_TASK_WHEEL */
+
+	/* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
+	count overflows. */
+	#define taskSWITCH_DELAYED_LISTS()																\
+	{																								\
+		List_t *pxTemp;																				\
 																									\
-	/* The delayed tasks list should be empty when the lists are switched. */						\
-	configASSERT( ( listLIST_IS_EMPTY( pxDelayedTaskList ) ) );										\
+		/* The delayed tasks list should be empty when the lists are switched. */					\
+		configASSERT( ( listLIST_IS_EMPTY( pxDelayedTaskList ) ) );									\
 																									\
-	pxTemp = pxDelayedTaskList;																		\
-	pxDelayedTaskList = pxOverflowDelayedTaskList;													\
-	pxOverflowDelayedTaskList = pxTemp;																\
-	xNumOfOverflows++;																				\
-	prvResetNextTaskUnblockTime();																	\
-}
+		pxTemp = pxDelayedTaskList;																	\
+		pxDelayedTaskList = pxOverflowDelayedTaskList;												\
+		pxOverflowDelayedTaskList = pxTemp;															\
+		xNumOfOverflows++;																			\
+		prvResetNextTaskUnblockTime();																\
+	}
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
+/*-----------------------------------------------------------*/
+
+#if( configUSE_PREEMPTION_THRESHOLD == 1 )
+
+	/* Once a task is running, only tasks with a priority above its preemption
+	threshold can preempt it.  The threshold is never taken to be below the
+	priority of the task, so it is raised by priority inheritance as normal. */
+	#define taskPREEMPTION_THRESHOLD( pxTCB ) ( ( ( pxTCB )->uxPreemptionThreshold > ( pxTCB )->uxPriority ) ? ( pxTCB )->uxPreemptionThreshold : ( pxTCB )->uxPriority )
+
+	/* Tasks of equal priority to the running task only cause a reschedule if
+	the running task has not raised its preemption threshold. */
+	#define taskRESCHEDULE_REQUIRED_FOR( pxTCB )																\
+		( ( taskPREEMPTION_THRESHOLD( pxCurrentTCB ) > pxCurrentTCB->uxPriority ) ?							\
+		  ( ( pxTCB )->uxPriority > taskPREEMPTION_THRESHOLD( pxCurrentTCB ) ) :							\
+		  ( ( pxTCB )->uxPriority >= pxCurrentTCB->uxPriority ) )
+
+#else
+
+	#define taskPREEMPTION_THRESHOLD( pxTCB ) ( ( pxTCB )->uxPriority )
+	#define taskRESCHEDULE_REQUIRED_FOR( pxTCB ) ( ( pxTCB )->uxPriority >= pxCurrentTCB->uxPriority )
+
+#endif /* configUSE_PREEMPTION_THRESHOLD */
+
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EDF_SCHEDULING == 1 )
+
+	#if( ( configEDF_TASK_PRIORITY < 1 ) || ( configEDF_TASK_PRIORITY >= configMAX_PRIORITIES ) )
+		#error configEDF_TASK_PRIORITY must be greater than 0 and less than configMAX_PRIORITIES.
+	#endif
+
+	/* Tasks that are scheduled by deadline all run at configEDF_TASK_PRIORITY.
+	The ready list for that priority is kept in order of absolute deadline, so
+	tasks of a higher priority still preempt them, tasks of a lower priority
+	only run when none of them are ready, and between themselves the task with
+	the earliest deadline runs.  Other tasks created at configEDF_TASK_PRIORITY
+	have no deadline of their own, so are ordered as if their deadline was the
+	time at which they became ready. */
+	#define taskIS_EDF_PRIORITY( uxPriority ) ( ( uxPriority ) == ( UBaseType_t ) configEDF_TASK_PRIORITY )
+
+	/* The deadline used to order the task within the EDF ready list. */
+	#define taskEDF_DEADLINE( pxTCB ) ( ( ( pxTCB )->xRelativeDeadline != ( TickType_t ) 0 ) ? ( pxTCB )->xAbsoluteDeadline : xTickCount )
+
+	/* Deadlines are compared in a way that remains valid when the tick count
+	overflows, provided the deadlines being compared are less than half the
+	range of TickType_t apart. */
+	#define taskDEADLINE_IS_BEFORE( xDeadline, xOtherDeadline ) ( ( TickType_t ) ( ( xDeadline ) - ( xOtherDeadline ) ) > ( portMAX_DELAY >> 1 ) )
+
+	#define taskINSERT_INTO_READY_LIST( pxTCB )																\
+	{																										\
+		if( taskIS_EDF_PRIORITY( ( pxTCB )->uxPriority ) )													\
+		{																									\
+			listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), taskEDF_DEADLINE( pxTCB ) );			\
+			vListInsertWrapped( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+		}																									\
+		else																								\
+		{																									\
+			vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) );	\
+		}																									\
+	}
+
+	/* The EDF ready list is not indexed through, its head is always the task
+	with the earliest deadline. */
+	#define taskSELECT_TASK_FROM_READY_LIST( uxPriority )														\
+	{																										\
+		if( taskIS_EDF_PRIORITY( uxPriority ) )																\
+		{																									\
+			pxCurrentTCB = listGET_OWNER_OF_HEAD_ENTRY( &( pxReadyTasksLists[ ( uxPriority ) ] ) );		\
+		}																									\
+		else																								\
+		{																									\
+			listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ ( uxPriority ) ] ) );			\
+		}																									\
+	}
+
+	/* A task that becomes ready preempts the running task if its priority is
+	above the preemption threshold of the running task, or if both are
+	scheduled by deadline and its deadline is earlier. */
+	#define taskPREEMPTS_CURRENT_TASK( pxTCB )																	\
+		( ( ( pxTCB )->uxPriority > taskPREEMPTION_THRESHOLD( pxCurrentTCB ) ) ||							\
+		  ( ( taskIS_EDF_PRIORITY( ( pxTCB )->uxPriority ) ) &&												\
+			( ( pxTCB )->uxPriority == taskPREEMPTION_THRESHOLD( pxCurrentTCB ) ) &&						\
+			( ( pxTCB )->uxPriority == pxCurrentTCB->uxPriority ) &&										\
+			( taskDEADLINE_IS_BEFORE( taskEDF_DEADLINE( pxTCB ), taskEDF_DEADLINE( pxCurrentTCB ) ) ) ) )
+
+#else
+
+	#define taskIS_EDF_PRIORITY( uxPriority ) pdFALSE
+	#define taskINSERT_INTO_READY_LIST( pxTCB ) vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) )
+	#define taskSELECT_TASK_FROM_READY_LIST( uxPriority ) listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ ( uxPriority ) ] ) )
+	#define taskPREEMPTS_CURRENT_TASK( pxTCB ) ( ( pxTCB )->uxPriority > taskPREEMPTION_THRESHOLD( pxCurrentTCB ) )
+
+#endif /* configUSE_EDF_SCHEDULING */
 
 /*-----------------------------------------------------------*/
 
 /*
  * Place the task represented by pxTCB into the appropriate ready list for
- * the task.  It is inserted at the end of the list.
+ * the task.  It is inserted at the end of the list, or in deadline order if
+ * the list is the EDF ready list.
  */
 #define prvAddTaskToReadyList( pxTCB )																\
 	traceMOVED_TASK_TO_READY_STATE( pxTCB );														\
 	taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );												\
-	vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+	taskINSERT_INTO_READY_LIST( pxTCB );															\
 	tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
 /*-----------------------------------------------------------*/
 
@@ -281,6 +523,20 @@ typedef struct tskTaskControlBlock 			/* The old naming convention is used to pr
 		UBaseType_t		uxMutexesHeld;
 	#endif
 
+	#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+		List_t			xMutexesHeldList;	/*< The list items of the mutexes held by the task, each valued with the priority of the highest priority task waiting for that mutex. */
+		ListItem_t		*pxBlockedOnMutex;	/*< The list item of the mutex the task is blocked on, if any.  Only valid while xEventListItem is in that mutex's event list. */
+	#endif
+
+	#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+		UBaseType_t		uxPreemptionThreshold;	/*< Only tasks with a priority above this value can preempt the task.  Has no effect if it is not above uxPriority. */
+	#endif
+
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+		TickType_t		xRelativeDeadline;	/*< The deadline of each job of the task relative to its release time.  Zero if the task is not scheduled by deadline. */
+		TickType_t		xAbsoluteDeadline;	/*< The tick count by which the current job of the task should complete. */
+	#endif
+
 	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
 		TaskHookFunction_t pxTaskTag;
 	#endif
@@ -308,8 +564,9 @@ typedef struct tskTaskControlBlock 			/* The old naming convention is used to pr
 	#endif
 
 	#if( configUSE_TASK_NOTIFICATIONS == 1 )
-		volatile uint32_t ulNotifiedValue;
-		volatile uint8_t ucNotifyState;
+		volatile uint32_t ulNotifiedValue[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+		volatile uint8_t ucNotifyState[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+		uint32_t ulNotifyBitsToWaitFor;	/*< The bits the task is waiting for when blocked in xTaskGenericNotifyWaitBits(). */
 	#endif
 
 	/* See the comments in FreeRTOS.h with the definition of
@@ -341,10 +598,43 @@ xDelayedTaskList1 and xDelayedTaskList2 could be move to function scople but
 doing so breaks some kernel aware debuggers and debuggers that rely on removing
 the static qualifier. */
 PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ];/*< Prioritised ready tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
-PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
-PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	/* A hierarchical timing wheel in which delayed tasks are stored.  Level n
+	slot s (xSlots[ ( n * 32 ) + s ]) holds the tasks that wake between 32^n and
+	32^(n+1) ticks after the wheel time and whose wake time has s in bits
+	( 5 * n ) to ( ( 5 * n ) + 4 ).  When the wheel time reaches the start of
+	the period covered by a slot in level n > 0 the tasks in that slot are moved
+	down the wheel, so only the tasks in the level 0 slot for the current time
+	are due to wake.  Tasks are not sorted within a slot, so blocking with a
+	timeout does not depend on the number of delayed tasks.  Bit s of
+	ulSlotsInUse[ n ] is set if level n slot s might not be empty - tasks that
+	leave the Blocked state early are removed from their slot without clearing
+	the bit, so the bit is only cleared when the slot is next processed. */
+	typedef struct DelayedTaskWheel
+	{
+		List_t xSlots[ taskWHEEL_LISTS ];
+		uint32_t ulSlotsInUse[ configDELAYED_TASK_WHEEL_LEVELS ];
+	} DelayedTaskWheel_t;
+
+	PRIVILEGED_DATA static DelayedTaskWheel_t xDelayedTaskWheel1;					/*< Delayed tasks. */
+	PRIVILEGED_DATA static DelayedTaskWheel_t xDelayedTaskWheel2;					/*< Delayed tasks (two wheels are used - one for delays that have overflowed the current tick count. */
+	PRIVILEGED_DATA static DelayedTaskWheel_t * volatile pxDelayedTaskWheel;		/*< Points to the delayed task wheel currently being used. */
+	PRIVILEGED_DATA static DelayedTaskWheel_t * volatile pxOverflowDelayedTaskWheel;	/*< Points to the delayed task wheel currently being used to hold tasks that have overflowed the current tick count. */
+
+	/* The time up to which pxDelayedTaskWheel has been processed.  Tasks in
+	pxOverflowDelayedTaskWheel are placed relative to portMAX_DELAY, the wheel
+	time once the wheels are switched. */
+	PRIVILEGED_DATA static TickType_t xDelayedTaskWheelTime = ( TickType_t ) configINITIAL_TICK_COUNT;
+
+#else /* configUSE_DELAYED_TASK_WHEEL */
+
+	PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
+	PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+	PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
+	PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
 PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
 #if( INCLUDE_vTaskDelete == 1 )
@@ -360,6 +650,17 @@ PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been r
 
 #endif
 
+#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+
+	/* Ready tasks that were preempted while they had raised their preemption
+	threshold, referenced by their event list items, which are not otherwise
+	used while a task is ready.  A task can only preempt such a task if its
+	priority is above the preempted task's threshold, so the most recently
+	preempted task, at the end of the list, always has the highest priority. */
+	PRIVILEGED_DATA static List_t xPreemptedTaskList;
+
+#endif
+
 /* Global POSIX errno. Its value is changed upon context switching to match
 the errno of the currently running task. */
 #if ( configUSE_POSIX_ERRNO == 1 )
@@ -370,6 +671,11 @@ the errno of the currently running task. */
 PRIVILEGED_DATA static volatile UBaseType_t uxCurrentNumberOfTasks 	= ( UBaseType_t ) 0U;
 PRIVILEGED_DATA static volatile TickType_t xTickCount 				= ( TickType_t ) configINITIAL_TICK_COUNT;
 PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority 		= tskIDLE_PRIORITY;
+
+#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 2 )
+	PRIVILEGED_DATA static volatile uint32_t ulReadyPriorityGroups = 0UL;						/*< Bit n is set if word n of ulReadyPriorities is not zero. */
+	PRIVILEGED_DATA static volatile uint32_t ulReadyPriorities[ taskREADY_PRIORITY_WORDS ];	/*< One bit per priority, set if the priority has a task in the Ready state. */
+#endif
 PRIVILEGED_DATA static volatile BaseType_t xSchedulerRunning 		= pdFALSE;
 PRIVILEGED_DATA static volatile TickType_t xPendedTicks 			= ( TickType_t ) 0U;
 PRIVILEGED_DATA static volatile BaseType_t xYieldPending 			= pdFALSE;
@@ -534,6 +840,58 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
  */
 static void prvResetNextTaskUnblockTime( void );
 
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	/*
+	 * Place the task in the slot of pxWheel for xTimeToWake, where xWheelTime
+	 * is the time from which pxWheel is measured.
+	 */
+	static void prvInsertTaskInDelayedWheel( DelayedTaskWheel_t * const pxWheel, TCB_t * const pxTCB, const TickType_t xTimeToWake, const TickType_t xWheelTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Add the task to the current or the overflow delayed task wheel, in the
+	 * same way as prvAddCurrentTaskToDelayedList() uses the delayed task lists
+	 * when the wheel is not used.
+	 */
+	static void prvAddTaskToDelayedWheel( TCB_t * const pxTCB, const TickType_t xTimeToWake, const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called from the tick interrupt once xNextTaskUnblockTime has been
+	 * reached.  Steps the wheel time through the events up to xTimeNow, at most
+	 * taskWHEEL_MAX_EVENTS_PER_TICK of them, moving slots down the wheel and
+	 * unblocking the tasks that are due to wake, then sets
+	 * xNextTaskUnblockTime again.  Returns pdTRUE if a task was
+	 * unblocked that requires a context switch.
+	 */
+	static BaseType_t prvProcessDelayedTaskWheel( const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the number of ticks from xDelayedTaskWheelTime until the current
+	 * wheel next needs processing - either because a task wakes or because a slot
+	 * must be moved down the wheel.  *pxWheelIsEmpty is set to pdTRUE if there
+	 * are no delayed tasks.
+	 */
+	static TickType_t prvGetTicksToNextWheelEvent( BaseType_t * const pxWheelIsEmpty ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the index of the least significant set bit in ulBitmap, which
+	 * must not be zero.
+	 */
+	static UBaseType_t prvGetLowestSetBit( uint32_t ulBitmap ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
+#if ( ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 2 ) && !defined( portCOUNT_LEADING_ZEROS ) )
+
+	/*
+	 * Returns the index of the most significant set bit in ulBitmap, which
+	 * must not be zero.  Used to search the ready priority bit maps when the
+	 * port does not provide portCOUNT_LEADING_ZEROS().
+	 */
+	static UBaseType_t prvGetHighestSetBit( uint32_t ulBitmap ) PRIVILEGED_FUNCTION;
+
+#endif
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
 	/*
@@ -563,6 +921,47 @@ static void prvInitialiseNewTask( 	TaskFunction_t pxTaskCode,
  */
 static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	/*
+	 * Set the absolute deadline of the task referenced by pxTCB, moving the
+	 * task to its new position if it is in the EDF ready list.
+	 */
+	static void prvSetTaskDeadline( TCB_t * const pxTCB, const TickType_t xAbsoluteDeadline ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called by xTaskCreateEDF() and xTaskCreateEDFStatic(), with the scheduler
+	 * suspended, to make a newly created task schedulable by deadline.
+	 */
+	static void prvInitialiseTaskDeadline( TCB_t * const pxTCB, const TickType_t xRelativeDeadline ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+
+	/*
+	 * Returns the priority the task referenced by pxTCB should run at - the
+	 * greater of its base priority and the priority of the highest priority
+	 * task waiting for any of the mutexes it holds.
+	 */
+	static UBaseType_t prvGetInheritedPriority( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Changes the priority of the task referenced by pxTCB to uxNewPriority,
+	 * moving the task within whichever ready or event list it is in.
+	 */
+	static void prvSetInheritedPriority( TCB_t * const pxTCB, UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Re-evaluates the priority of the holder of the mutex that owns
+	 * pxMutexItem, then follows the chain of mutex holders for as long as the
+	 * priority of each holder changes and that holder is itself blocked on a
+	 * mutex.
+	 */
+	static void prvUpdateMutexHolderPriority( ListItem_t *pxMutexItem ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * freertos_tasks_c_additions_init() should only be called if the user definable
  * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
@@ -938,6 +1337,29 @@ UBaseType_t x;
 	}
 	#endif /* configUSE_MUTEXES */
 
+	#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+	{
+		vListInitialise( &( pxNewTCB->xMutexesHeldList ) );
+		pxNewTCB->pxBlockedOnMutex = NULL;
+	}
+	#endif /* configUSE_PRECISE_PRIORITY_INHERITANCE */
+
+	#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+	{
+		/* The task can be preempted by any task of higher priority until its
+		threshold is raised by vTaskPreemptionThresholdSet(). */
+		pxNewTCB->uxPreemptionThreshold = tskIDLE_PRIORITY;
+	}
+	#endif /* configUSE_PREEMPTION_THRESHOLD */
+
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+	{
+		/* Set by xTaskCreateEDF() if the task is scheduled by deadline. */
+		pxNewTCB->xRelativeDeadline = ( TickType_t ) 0;
+		pxNewTCB->xAbsoluteDeadline = ( TickType_t ) 0;
+	}
+	#endif /* configUSE_EDF_SCHEDULING */
+
 	vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
 	vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
 
@@ -989,8 +1411,13 @@ UBaseType_t x;
 
 	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
 	{
-		pxNewTCB->ulNotifiedValue = 0;
-		pxNewTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+		for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
+		{
+			pxNewTCB->ulNotifiedValue[ x ] = 0;
+			pxNewTCB->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
+		}
+
+		pxNewTCB->ulNotifyBitsToWaitFor = 0UL;
 	}
 	#endif
 
@@ -1141,7 +1568,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 	{
 		/* If the created task is of a higher priority than the current task
 		then it should run now. */
-		if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
+		if( taskPREEMPTS_CURRENT_TASK( pxNewTCB ) != pdFALSE )
 		{
 			taskYIELD_IF_USING_PREEMPTION();
 		}
@@ -1157,6 +1584,167 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	static void prvSetTaskDeadline( TCB_t * const pxTCB, const TickType_t xAbsoluteDeadline )
+	{
+		taskENTER_CRITICAL();
+		{
+			pxTCB->xAbsoluteDeadline = xAbsoluteDeadline;
+
+			/* If the task is ready then its position in the EDF ready list
+			depends on its deadline, so move it.  The task is not removed from
+			the ready list for its priority so the ready priority does not need
+			to be reset. */
+			if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+			{
+				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+				taskINSERT_INTO_READY_LIST( pxTCB );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvInitialiseTaskDeadline( TCB_t * const pxTCB, const TickType_t xRelativeDeadline )
+	{
+		configASSERT( uxSchedulerSuspended != 0 );
+
+		/* The first job of the task is released now. */
+		pxTCB->xRelativeDeadline = xRelativeDeadline;
+		prvSetTaskDeadline( pxTCB, xTickCount + xRelativeDeadline );
+
+		/* prvAddNewTaskToReadyList() only compared priorities, so check again
+		now the task has a deadline.  The yield is performed when the scheduler
+		is resumed. */
+		if( xSchedulerRunning != pdFALSE )
+		{
+			if( taskPREEMPTS_CURRENT_TASK( pxTCB ) != pdFALSE )
+			{
+				xYieldPending = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else if( pxCurrentTCB->uxPriority == pxTCB->uxPriority )
+		{
+			/* The scheduler will start the task with the earliest deadline,
+			rather than the task created last. */
+			pxCurrentTCB = listGET_OWNER_OF_HEAD_ENTRY( &( pxReadyTasksLists[ pxTCB->uxPriority ] ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+		BaseType_t xTaskCreateEDF(	TaskFunction_t pxTaskCode,
+									const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+									const configSTACK_DEPTH_TYPE usStackDepth,
+									void * const pvParameters,
+									const TickType_t xRelativeDeadline,
+									TaskHandle_t * const pxCreatedTask )
+		{
+		TaskHandle_t xCreatedTask = NULL;
+		BaseType_t xReturn;
+
+			configASSERT( xRelativeDeadline > ( TickType_t ) 0 );
+
+			/* The scheduler is suspended so the task cannot run before its
+			deadline has been set. */
+			vTaskSuspendAll();
+			{
+				xReturn = xTaskCreate( pxTaskCode, pcName, usStackDepth, pvParameters, ( UBaseType_t ) configEDF_TASK_PRIORITY, &xCreatedTask );
+
+				if( xReturn == pdPASS )
+				{
+					prvInitialiseTaskDeadline( xCreatedTask, xRelativeDeadline );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			( void ) xTaskResumeAll();
+
+			if( pxCreatedTask != NULL )
+			{
+				*pxCreatedTask = xCreatedTask;
+			}
+
+			return xReturn;
+		}
+
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+	/*-----------------------------------------------------------*/
+
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+		TaskHandle_t xTaskCreateEDFStatic(	TaskFunction_t pxTaskCode,
+											const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+											const uint32_t ulStackDepth,
+											void * const pvParameters,
+											const TickType_t xRelativeDeadline,
+											StackType_t * const puxStackBuffer,
+											StaticTask_t * const pxTaskBuffer )
+		{
+		TaskHandle_t xReturn;
+
+			configASSERT( xRelativeDeadline > ( TickType_t ) 0 );
+
+			/* The scheduler is suspended so the task cannot run before its
+			deadline has been set. */
+			vTaskSuspendAll();
+			{
+				xReturn = xTaskCreateStatic( pxTaskCode, pcName, ulStackDepth, pvParameters, ( UBaseType_t ) configEDF_TASK_PRIORITY, puxStackBuffer, pxTaskBuffer );
+
+				if( xReturn != NULL )
+				{
+					prvInitialiseTaskDeadline( xReturn, xRelativeDeadline );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			( void ) xTaskResumeAll();
+
+			return xReturn;
+		}
+
+	#endif /* configSUPPORT_STATIC_ALLOCATION */
+	/*-----------------------------------------------------------*/
+
+	#if ( INCLUDE_vTaskDelayUntil == 1 )
+
+		void vTaskWaitForNextPeriod( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement )
+		{
+			configASSERT( pxPreviousWakeTime );
+			configASSERT( pxCurrentTCB->xRelativeDeadline > ( TickType_t ) 0 );
+
+			/* The next job is released at the next wake time, and must complete
+			within the relative deadline of that time.  The deadline is set
+			first so the task is ordered correctly if it has overrun and
+			vTaskDelayUntil() does not block. */
+			prvSetTaskDeadline( pxCurrentTCB, *pxPreviousWakeTime + xTimeIncrement + pxCurrentTCB->xRelativeDeadline );
+
+			vTaskDelayUntil( pxPreviousWakeTime, xTimeIncrement );
+		}
+
+	#endif /* INCLUDE_vTaskDelayUntil */
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
 #if ( INCLUDE_vTaskDelete == 1 )
 
 	void vTaskDelete( TaskHandle_t xTaskToDelete )
@@ -1386,7 +1974,8 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 	eTaskState eTaskGetState( TaskHandle_t xTask )
 	{
 	eTaskState eReturn;
-	List_t const * pxStateList, *pxDelayedList, *pxOverflowedDelayedList;
+	List_t const * pxStateList;
+	BaseType_t xIsDelayed;
 	const TCB_t * const pxTCB = xTask;
 
 		configASSERT( pxTCB );
@@ -1401,12 +1990,20 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			taskENTER_CRITICAL();
 			{
 				pxStateList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
-				pxDelayedList = pxDelayedTaskList;
-				pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+
+				#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+				{
+					xIsDelayed = taskLIST_IS_IN_DELAYED_TASK_WHEEL( pxStateList );
+				}
+				#else
+				{
+					xIsDelayed = ( ( pxStateList == pxDelayedTaskList ) || ( pxStateList == pxOverflowDelayedTaskList ) ) ? pdTRUE : pdFALSE;
+				}
+				#endif
 			}
 			taskEXIT_CRITICAL();
 
-			if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+			if( xIsDelayed != pdFALSE )
 			{
 				/* The task being queried is referenced from one of the Blocked
 				lists. */
@@ -1423,17 +2020,21 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 					{
 						#if( configUSE_TASK_NOTIFICATIONS == 1 )
 						{
+						UBaseType_t x;
+
 							/* The task does not appear on the event list item of
 							and of the RTOS objects, but could still be in the
-							blocked state if it is waiting on its notification
-							rather than waiting on an object. */
-							if( pxTCB->ucNotifyState == taskWAITING_NOTIFICATION )
-							{
-								eReturn = eBlocked;
-							}
-							else
+							blocked state if it is waiting on one of its
+							notifications rather than waiting on an object. */
+							eReturn = eSuspended;
+
+							for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
 							{
-								eReturn = eSuspended;
+								if( taskIS_WAITING_NOTIFICATION( pxTCB->ucNotifyState[ x ] ) )
+								{
+									eReturn = eBlocked;
+									break;
+								}
 							}
 						}
 						#else
@@ -1619,7 +2220,15 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				taskRESET_READY_PRIORITY() macro can function correctly. */
 				uxPriorityUsedOnEntry = pxTCB->uxPriority;
 
-				#if ( configUSE_MUTEXES == 1 )
+				#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+				{
+					/* The priority being used is the greater of the new base
+					priority and any priority inherited through the mutexes
+					the task holds. */
+					pxTCB->uxBasePriority = uxNewPriority;
+					pxTCB->uxPriority = prvGetInheritedPriority( pxTCB );
+				}
+				#elif ( configUSE_MUTEXES == 1 )
 				{
 					/* Only change the priority being used if the task is not
 					currently using an inherited priority. */
@@ -1699,19 +2308,95 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 #endif /* INCLUDE_vTaskPrioritySet */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskSuspend == 1 )
+#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
 
-	void vTaskSuspend( TaskHandle_t xTaskToSuspend )
+	void vTaskPreemptionThresholdSet( TaskHandle_t xTask, UBaseType_t uxNewThreshold )
 	{
 	TCB_t *pxTCB;
+	BaseType_t xYieldRequired = pdFALSE;
 
-		taskENTER_CRITICAL();
+		configASSERT( ( uxNewThreshold < configMAX_PRIORITIES ) );
+
+		/* Ensure the new threshold is valid. */
+		if( uxNewThreshold >= ( UBaseType_t ) configMAX_PRIORITIES )
 		{
-			/* If null is passed in here then it is the running task that is
-			being suspended. */
-			pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
+			uxNewThreshold = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-			traceTASK_SUSPEND( pxTCB );
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the threshold of the
+			calling task that is being changed. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+			/* Lowering the threshold of the running task may allow a task
+			that it was holding off to preempt it.  Changing the threshold of
+			any other task has no effect until that task runs. */
+			if( ( pxTCB == pxCurrentTCB ) && ( uxNewThreshold < taskPREEMPTION_THRESHOLD( pxTCB ) ) )
+			{
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxTCB->uxPreemptionThreshold = uxNewThreshold;
+
+			if( xYieldRequired != pdFALSE )
+			{
+				taskYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_PREEMPTION_THRESHOLD */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+
+	UBaseType_t uxTaskPreemptionThresholdGet( const TaskHandle_t xTask )
+	{
+	TCB_t const *pxTCB;
+	UBaseType_t uxReturn;
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the threshold of the
+			calling task that is being queried. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			uxReturn = taskPREEMPTION_THRESHOLD( pxTCB );
+		}
+		taskEXIT_CRITICAL();
+
+		return uxReturn;
+	}
+
+#endif /* configUSE_PREEMPTION_THRESHOLD */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskSuspend == 1 )
+
+	void vTaskSuspend( TaskHandle_t xTaskToSuspend )
+	{
+	TCB_t *pxTCB;
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the running task that is
+			being suspended. */
+			pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
+
+			traceTASK_SUSPEND( pxTCB );
 
 			/* Remove task from the ready/delayed list and place in the
 			suspended list. */
@@ -1738,11 +2423,16 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 
 			#if( configUSE_TASK_NOTIFICATIONS == 1 )
 			{
-				if( pxTCB->ucNotifyState == taskWAITING_NOTIFICATION )
+			UBaseType_t x;
+
+				for( x = ( UBaseType_t ) 0; x < ( UBaseType_t ) configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
 				{
-					/* The task was blocked to wait for a notification, but is
-					now suspended, so no notification was received. */
-					pxTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+					if( taskIS_WAITING_NOTIFICATION( pxTCB->ucNotifyState[ x ] ) )
+					{
+						/* The task was blocked to wait for a notification, but
+						is now suspended, so no notification was received. */
+						pxTCB->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
+					}
 				}
 			}
 			#endif
@@ -1871,7 +2561,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 					prvAddTaskToReadyList( pxTCB );
 
 					/* A higher priority task may have just been resumed. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( taskRESCHEDULE_REQUIRED_FOR( pxTCB ) != pdFALSE )
 					{
 						/* This yield may not cause the task just resumed to run,
 						but will leave the lists in the correct state for the
@@ -1939,7 +2629,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				{
 					/* Ready lists can be accessed so move the task from the
 					suspended list to the ready list directly. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( taskRESCHEDULE_REQUIRED_FOR( pxTCB ) != pdFALSE )
 					{
 						xYieldRequired = pdTRUE;
 					}
@@ -2146,6 +2836,18 @@ void vTaskSuspendAll( void )
 				uxHigherPriorityReadyTasks = pdTRUE;
 			}
 		}
+		#elif( configUSE_PORT_OPTIMISED_TASK_SELECTION == 2 )
+		{
+			const uint32_t ulLeastSignificantBit = ( uint32_t ) 0x01;
+
+			/* The idle priority is the least significant bit of the first
+			word, so any other bit being set in either bit map means a task with
+			a priority above the idle priority is in the Ready state. */
+			if( ( ulReadyPriorityGroups > ulLeastSignificantBit ) || ( ulReadyPriorities[ 0 ] > ulLeastSignificantBit ) )
+			{
+				uxHigherPriorityReadyTasks = pdTRUE;
+			}
+		}
 		#else
 		{
 			const UBaseType_t uxLeastSignificantBit = ( UBaseType_t ) 0x01;
@@ -2183,6 +2885,26 @@ void vTaskSuspendAll( void )
 		else
 		{
 			xReturn = xNextTaskUnblockTime - xTickCount;
+
+			#if ( configUSE_HARD_TIMERS == 1 )
+			{
+			TickType_t xTicksToNextHardTimer;
+
+				/* Hard timers are processed from the tick interrupt, so the
+				tick interrupt must not be suppressed beyond the time at which
+				the next hard timer expires. */
+				xTicksToNextHardTimer = xTimerGetTicksToNextHardTimer( xTickCount );
+
+				if( xTicksToNextHardTimer < xReturn )
+				{
+					xReturn = xTicksToNextHardTimer;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_HARD_TIMERS */
 		}
 
 		return xReturn;
@@ -2224,7 +2946,7 @@ BaseType_t xAlreadyYielded = pdFALSE;
 
 					/* If the moved task has a priority higher than the current
 					task then a yield must be performed. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( taskRESCHEDULE_REQUIRED_FOR( pxTCB ) != pdFALSE )
 					{
 						xYieldPending = pdTRUE;
 					}
@@ -2439,7 +3161,7 @@ TCB_t *pxTCB;
 
 	TaskHandle_t xTaskGetHandle( const char *pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 	{
-	UBaseType_t uxQueue = configMAX_PRIORITIES;
+	UBaseType_t uxQueue = configMAX_PRIORITIES, uxList;
 	TCB_t* pxTCB;
 
 		/* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
@@ -2462,15 +3184,34 @@ TCB_t *pxTCB;
 			} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
 			/* Search the delayed lists. */
-			if( pxTCB == NULL )
+			#if( configUSE_DELAYED_TASK_WHEEL == 1 )
 			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
-			}
+				for( uxList = ( UBaseType_t ) 0U; ( uxList < taskWHEEL_LISTS ) && ( pxTCB == NULL ); uxList++ )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( &( pxDelayedTaskWheel->xSlots[ uxList ] ), pcNameToQuery );
+				}
 
-			if( pxTCB == NULL )
+				for( uxList = ( UBaseType_t ) 0U; ( uxList < taskWHEEL_LISTS ) && ( pxTCB == NULL ); uxList++ )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( &( pxOverflowDelayedTaskWheel->xSlots[ uxList ] ), pcNameToQuery );
+				}
+			}
+			#else
 			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+				if( pxTCB == NULL )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+				}
+
+				if( pxTCB == NULL )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+				}
+
+				/* Avoid compiler warning when the wheel is not used. */
+				( void ) uxList;
 			}
+			#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 			#if ( INCLUDE_vTaskSuspend == 1 )
 			{
@@ -2504,7 +3245,7 @@ TCB_t *pxTCB;
 
 	UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime )
 	{
-	UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+	UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES, uxList;
 
 		vTaskSuspendAll();
 		{
@@ -2522,8 +3263,27 @@ TCB_t *pxTCB;
 
 				/* Fill in an TaskStatus_t structure with information on each
 				task in the Blocked state. */
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+				{
+					for( uxList = ( UBaseType_t ) 0U; uxList < taskWHEEL_LISTS; uxList++ )
+					{
+						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxDelayedTaskWheel->xSlots[ uxList ] ), eBlocked );
+					}
+
+					for( uxList = ( UBaseType_t ) 0U; uxList < taskWHEEL_LISTS; uxList++ )
+					{
+						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxOverflowDelayedTaskWheel->xSlots[ uxList ] ), eBlocked );
+					}
+				}
+				#else
+				{
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+
+					/* Avoid compiler warning when the wheel is not used. */
+					( void ) uxList;
+				}
+				#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 				#if( INCLUDE_vTaskDelete == 1 )
 				{
@@ -2678,7 +3438,7 @@ BaseType_t xYieldRequired = pdFALSE;
 					/* Preemption is on, but a context switch should only be
 					performed if the unblocked task has a priority that is
 					equal to or higher than the currently executing task. */
-					if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+					if( taskPREEMPTS_CURRENT_TASK( pxTCB ) != pdFALSE )
 					{
 						/* Pend the yield to be performed when the scheduler
 						is unsuspended. */
@@ -2733,94 +3493,139 @@ BaseType_t xSwitchRequired = pdFALSE;
 			mtCOVERAGE_TEST_MARKER();
 		}
 
-		/* See if this tick has made a timeout expire.  Tasks are stored in
-		the	queue in the order of their wake time - meaning once one task
-		has been found whose block time has not expired there is no need to
-		look any further down the list. */
-		if( xConstTickCount >= xNextTaskUnblockTime )
+		#if( configUSE_DELAYED_TASK_WHEEL == 1 )
 		{
-			for( ;; )
+			/* xNextTaskUnblockTime is the time of the next wheel event - either
+			the wake time of a task in level 0 or the time at which a slot must
+			be moved down the wheel. */
+			if( xConstTickCount >= xNextTaskUnblockTime )
 			{
-				if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+				if( prvProcessDelayedTaskWheel( xConstTickCount ) != pdFALSE )
 				{
-					/* The delayed list is empty.  Set xNextTaskUnblockTime
-					to the maximum possible value so it is extremely
-					unlikely that the
-					if( xTickCount >= xNextTaskUnblockTime ) test will pass
-					next time through. */
-					xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-					break;
+					xSwitchRequired = pdTRUE;
 				}
 				else
 				{
-					/* The delayed list is not empty, get the value of the
-					item at the head of the delayed list.  This is the time
-					at which the task at the head of the delayed list must
-					be removed from the Blocked state. */
-					pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-					xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
-
-					if( xConstTickCount < xItemValue )
-					{
-						/* It is not time to unblock this item yet, but the
-						item value is the time at which the task at the head
-						of the blocked list must be removed from the Blocked
-						state -	so record the item value in
-						xNextTaskUnblockTime. */
-						xNextTaskUnblockTime = xItemValue;
-						break; /*lint !e9011 Code structure here is deedmed easier to understand with multiple breaks. */
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-
-					/* It is time to remove the item from the Blocked state. */
-					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-					/* Is the task waiting on an event also?  If so remove
-					it from the event list. */
-					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+			/* Avoid compiler warnings as these are only used when the wheel is
+			not. */
+			( void ) pxTCB;
+			( void ) xItemValue;
+		}
+		#else /* configUSE_DELAYED_TASK_WHEEL */
+		{
+			/* See if this tick has made a timeout expire.  Tasks are stored in
+			the	queue in the order of their wake time - meaning once one task
+			has been found whose block time has not expired there is no need to
+			look any further down the list. */
+			if( xConstTickCount >= xNextTaskUnblockTime )
+			{
+				for( ;; )
+				{
+					if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
 					{
-						( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+						/* The delayed list is empty.  Set xNextTaskUnblockTime
+						to the maximum possible value so it is extremely
+						unlikely that the
+						if( xTickCount >= xNextTaskUnblockTime ) test will pass
+						next time through. */
+						xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+						break;
 					}
 					else
 					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+						/* The delayed list is not empty, get the value of the
+						item at the head of the delayed list.  This is the time
+						at which the task at the head of the delayed list must
+						be removed from the Blocked state. */
+						pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+						xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+
+						if( xConstTickCount < xItemValue )
+						{
+							/* It is not time to unblock this item yet, but the
+							item value is the time at which the task at the head
+							of the blocked list must be removed from the Blocked
+							state -	so record the item value in
+							xNextTaskUnblockTime. */
+							xNextTaskUnblockTime = xItemValue;
+							break; /*lint !e9011 Code structure here is deedmed easier to understand with multiple breaks. */
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
 
-					/* Place the unblocked task into the appropriate ready
-					list. */
-					prvAddTaskToReadyList( pxTCB );
+						/* It is time to remove the item from the Blocked state. */
+						( void ) uxListRemove( &( pxTCB->xStateListItem ) );
 
-					/* A task being unblocked cannot cause an immediate
-					context switch if preemption is turned off. */
-					#if (  configUSE_PREEMPTION == 1 )
-					{
-						/* Preemption is on, but a context switch should
-						only be performed if the unblocked task has a
-						priority that is equal to or higher than the
-						currently executing task. */
-						if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+						/* Is the task waiting on an event also?  If so remove
+						it from the event list. */
+						if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
 						{
-							xSwitchRequired = pdTRUE;
+							( void ) uxListRemove( &( pxTCB->xEventListItem ) );
 						}
 						else
 						{
 							mtCOVERAGE_TEST_MARKER();
 						}
+
+						/* Place the unblocked task into the appropriate ready
+						list. */
+						prvAddTaskToReadyList( pxTCB );
+
+						/* A task being unblocked cannot cause an immediate
+						context switch if preemption is turned off. */
+						#if (  configUSE_PREEMPTION == 1 )
+						{
+							/* Preemption is on, but a context switch should
+							only be performed if the unblocked task has a
+							priority that is equal to or higher than the
+							currently executing task. */
+							if( taskRESCHEDULE_REQUIRED_FOR( pxTCB ) != pdFALSE )
+							{
+								xSwitchRequired = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						#endif /* configUSE_PREEMPTION */
 					}
-					#endif /* configUSE_PREEMPTION */
 				}
 			}
 		}
+		#endif /* configUSE_DELAYED_TASK_WHEEL */
+
+		/* Hard timers are processed here, rather than by the timer service
+		task.  Their callbacks can only use interrupt safe API functions, which
+		set xYieldPending if they unblock a task that has a priority above the
+		priority of the running task. */
+		#if ( configUSE_HARD_TIMERS == 1 )
+		{
+			vTimerProcessHardTimers( xConstTickCount );
+		}
+		#endif /* configUSE_HARD_TIMERS */
 
 		/* Tasks of equal priority to the currently running task will share
 		processing time (time slice) if preemption is on, and the application
-		writer has not explicitly turned time slicing off. */
+		writer has not explicitly turned time slicing off.  Tasks in the EDF
+		ready list run in deadline order, and tasks that have raised their
+		preemption threshold cannot be preempted by tasks of equal priority,
+		so neither are time sliced. */
 		#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
 		{
-			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+			if( ( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 ) &&
+				( taskIS_EDF_PRIORITY( pxCurrentTCB->uxPriority ) == pdFALSE ) &&
+				( taskPREEMPTION_THRESHOLD( pxCurrentTCB ) == pxCurrentTCB->uxPriority ) )
 			{
 				xSwitchRequired = pdTRUE;
 			}
@@ -3038,7 +3843,65 @@ void vTaskSwitchContext( void )
 
 		/* Select a new task to run using either the generic C or port
 		optimised asm code. */
-		taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+		#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+		{
+		TCB_t *pxPreemptedTCB;
+
+			/* If the task being switched out is still ready, and has raised
+			its preemption threshold, then it continues to hold off tasks up to
+			that threshold until it runs again.  Tasks that are suspended or
+			deleted are removed from xPreemptedTaskList as their event list
+			items are removed from any list. */
+			if( ( taskPREEMPTION_THRESHOLD( pxCurrentTCB ) > pxCurrentTCB->uxPriority ) &&
+				( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ), &( pxCurrentTCB->xStateListItem ) ) != pdFALSE ) )
+			{
+				vListInsertEnd( &xPreemptedTaskList, &( pxCurrentTCB->xEventListItem ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+			/* The most recently preempted task runs in place of the selected
+			task unless the selected task has a priority above its threshold. */
+			if( listLIST_IS_EMPTY( &xPreemptedTaskList ) == pdFALSE )
+			{
+				/* The tail of the list is reached through the end marker's
+				pxPrevious member directly, as casting the end marker to a
+				ListItem_t breaks strict aliasing. */
+				pxPreemptedTCB = xPreemptedTaskList.xListEnd.pxPrevious->pvOwner; /*lint !e9079 void * is used as the list item owner is generic.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+				if( pxCurrentTCB->uxPriority <= taskPREEMPTION_THRESHOLD( pxPreemptedTCB ) )
+				{
+					pxCurrentTCB = pxPreemptedTCB;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The running task's event list item must be free for it to block. */
+			if( listIS_CONTAINED_WITHIN( &xPreemptedTaskList, &( pxCurrentTCB->xEventListItem ) ) != pdFALSE )
+			{
+				( void ) uxListRemove( &( pxCurrentTCB->xEventListItem ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#else
+		{
+			taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+		}
+		#endif /* configUSE_PREEMPTION_THRESHOLD */
 		traceTASK_SWITCHED_IN();
 
 		/* After the new task is switched in, update the global errno. */
@@ -3102,6 +3965,28 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xIte
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_QUEUE_WAIT_POLICY == 1 )
+
+	void vTaskPlaceOnFIFOEventList( List_t * const pxEventList, const TickType_t xTicksToWait )
+	{
+		configASSERT( pxEventList );
+
+		/* THIS FUNCTION MUST BE CALLED WITH EITHER INTERRUPTS DISABLED OR THE
+		SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
+
+		/* Place the event list item of the TCB at the end of the event list,
+		so tasks are woken in the order in which they blocked whatever their
+		priority.  The index of an event list is never moved, so the end of the
+		list is its tail.  The item value is left as set for vTaskPlaceOnEventList()
+		as the queue implementation still reads it. */
+		vListInsertEnd( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+		prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+	}
+
+#endif /* configUSE_QUEUE_WAIT_POLICY */
+/*-----------------------------------------------------------*/
+
 #if( configUSE_TIMERS == 1 )
 
 	void vTaskPlaceOnEventListRestricted( List_t * const pxEventList, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely )
@@ -3183,7 +4068,7 @@ BaseType_t xReturn;
 		vListInsertEnd( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
 	}
 
-	if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+	if( taskPREEMPTS_CURRENT_TASK( pxUnblockedTCB ) != pdFALSE )
 	{
 		/* Return true if the task removed from the event list has a higher
 		priority than the calling task.  This allows the calling task to know if
@@ -3240,7 +4125,7 @@ TCB_t *pxUnblockedTCB;
 	( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
 	prvAddTaskToReadyList( pxUnblockedTCB );
 
-	if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+	if( taskPREEMPTS_CURRENT_TASK( pxUnblockedTCB ) != pdFALSE )
 	{
 		/* The unblocked task has a priority above that of the calling task, so
 		a context switch is required.  This function is called with the
@@ -3606,15 +4491,36 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 
 static void prvInitialiseTaskLists( void )
 {
-UBaseType_t uxPriority;
+UBaseType_t uxPriority, uxList;
 
 	for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
 	{
 		vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
 	}
 
-	vListInitialise( &xDelayedTaskList1 );
-	vListInitialise( &xDelayedTaskList2 );
+	#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+	{
+		for( uxList = ( UBaseType_t ) 0U; uxList < taskWHEEL_LISTS; uxList++ )
+		{
+			vListInitialise( &( xDelayedTaskWheel1.xSlots[ uxList ] ) );
+			vListInitialise( &( xDelayedTaskWheel2.xSlots[ uxList ] ) );
+		}
+
+		/* Start with pxDelayedTaskWheel using wheel1 and the
+		pxOverflowDelayedTaskWheel using wheel2. */
+		pxDelayedTaskWheel = &xDelayedTaskWheel1;
+		pxOverflowDelayedTaskWheel = &xDelayedTaskWheel2;
+	}
+	#else
+	{
+		vListInitialise( &xDelayedTaskList1 );
+		vListInitialise( &xDelayedTaskList2 );
+
+		/* Avoid compiler warning when the wheel is not used. */
+		( void ) uxList;
+	}
+	#endif /* configUSE_DELAYED_TASK_WHEEL */
+
 	vListInitialise( &xPendingReadyList );
 
 	#if ( INCLUDE_vTaskDelete == 1 )
@@ -3629,10 +4535,20 @@ UBaseType_t uxPriority;
 	}
 	#endif /* INCLUDE_vTaskSuspend */
 
-	/* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
-	using list2. */
-	pxDelayedTaskList = &xDelayedTaskList1;
-	pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+	{
+		vListInitialise( &xPreemptedTaskList );
+	}
+	#endif /* configUSE_PREEMPTION_THRESHOLD */
+
+	#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+	{
+		/* Start with pxDelayedTaskList using list1 and the
+		pxOverflowDelayedTaskList using list2. */
+		pxDelayedTaskList = &xDelayedTaskList1;
+		pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	}
+	#endif /* configUSE_DELAYED_TASK_WHEEL */
 }
 /*-----------------------------------------------------------*/
 
@@ -3940,75 +4856,411 @@ static void prvCheckTasksWaitingTermination( void )
 #endif /* INCLUDE_vTaskDelete */
 /*-----------------------------------------------------------*/
 
-static void prvResetNextTaskUnblockTime( void )
-{
-TCB_t *pxTCB;
-
-	if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
-	{
-		/* The new current delayed list is empty.  Set xNextTaskUnblockTime to
-		the maximum possible value so it is	extremely unlikely that the
-		if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-		there is an item in the delayed list. */
-		xNextTaskUnblockTime = portMAX_DELAY;
-	}
-	else
-	{
-		/* The new current delayed list is not empty, get the value of
-		the item at the head of the delayed list.  This is the time at
-		which the task at the head of the delayed list should be removed
-		from the Blocked state. */
-		( pxTCB ) = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-		xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) );
-	}
-}
-/*-----------------------------------------------------------*/
-
-#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
 
-	TaskHandle_t xTaskGetCurrentTaskHandle( void )
+	static void prvResetNextTaskUnblockTime( void )
 	{
-	TaskHandle_t xReturn;
-
-		/* A critical section is not required as this is not called from
-		an interrupt and the current TCB will always be the same for any
-		individual execution thread. */
-		xReturn = pxCurrentTCB;
-
-		return xReturn;
-	}
-
-#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
-/*-----------------------------------------------------------*/
+	TickType_t xTicksToEvent, xTicksSinceWheelTime;
+	BaseType_t xWheelIsEmpty;
 
-#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		xTicksToEvent = prvGetTicksToNextWheelEvent( &xWheelIsEmpty );
 
-	BaseType_t xTaskGetSchedulerState( void )
-	{
-	BaseType_t xReturn;
+		/* The wheel time is only moved forward when the wheel is processed
+		or a task is added to it, so it can be behind the tick count. */
+		xTicksSinceWheelTime = ( TickType_t ) ( xTickCount - xDelayedTaskWheelTime );
 
-		if( xSchedulerRunning == pdFALSE )
+		if( xWheelIsEmpty != pdFALSE )
 		{
-			xReturn = taskSCHEDULER_NOT_STARTED;
+			/* No tasks are delayed.  Set xNextTaskUnblockTime to the maximum
+			possible value so it is extremely unlikely that the
+			if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+			there is a task in the wheel. */
+			xNextTaskUnblockTime = portMAX_DELAY;
+		}
+		else if( xTicksToEvent <= xTicksSinceWheelTime )
+		{
+			/* The event is already due, so process it on the next tick. */
+			xNextTaskUnblockTime = xTickCount;
 		}
 		else
 		{
-			if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+			xNextTaskUnblockTime = xTickCount + ( xTicksToEvent - xTicksSinceWheelTime );
+
+			if( xNextTaskUnblockTime < xTickCount )
 			{
-				xReturn = taskSCHEDULER_RUNNING;
+				/* The event is after the tick count overflows.
+				xNextTaskUnblockTime is set again when the overflow occurs. */
+				xNextTaskUnblockTime = portMAX_DELAY;
 			}
 			else
 			{
-				xReturn = taskSCHEDULER_SUSPENDED;
+				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-
-		return xReturn;
 	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvProcessDelayedTaskWheel( const TickType_t xTimeNow )
+	{
+	TCB_t *pxTCB;
+	TickType_t xTicksToEvent, xItemValue;
+	BaseType_t xWheelIsEmpty, xSwitchRequired = pdFALSE;
+	UBaseType_t uxLevel, uxShift, uxSlot, uxEvent;
+	List_t *pxSlot;
+
+		for( uxEvent = ( UBaseType_t ) 0U; uxEvent < taskWHEEL_MAX_EVENTS_PER_TICK; uxEvent++ )
+		{
+			xTicksToEvent = prvGetTicksToNextWheelEvent( &xWheelIsEmpty );
+
+			if( ( xWheelIsEmpty != pdFALSE ) || ( xTicksToEvent > ( TickType_t ) ( xTimeNow - xDelayedTaskWheelTime ) ) )
+			{
+				/* There are no more events before xTimeNow.  Moving the wheel
+				time over empty slots does not change when the occupied slots
+				are processed. */
+				xDelayedTaskWheelTime = xTimeNow;
+				break;
+			}
+			else
+			{
+				xDelayedTaskWheelTime += xTicksToEvent;
+			}
+
+			/* Move the tasks held in any slot whose period starts now down the
+			wheel.  Level n is only at the start of a slot's period when levels
+			0 to n - 1 have wrapped back to slot 0. */
+			for( uxLevel = ( UBaseType_t ) 1U; uxLevel < ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS; uxLevel++ )
+			{
+				uxShift = taskWHEEL_SLOT_BITS * uxLevel;
+
+				if( ( xDelayedTaskWheelTime & ( TickType_t ) ( ( ( TickType_t ) 1 << uxShift ) - ( TickType_t ) 1 ) ) != ( TickType_t ) 0 )
+				{
+					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				uxSlot = ( UBaseType_t ) ( xDelayedTaskWheelTime >> uxShift ) & taskWHEEL_SLOT_MASK;
+				pxSlot = &( pxDelayedTaskWheel->xSlots[ ( uxLevel << taskWHEEL_SLOT_BITS ) + uxSlot ] );
+				pxDelayedTaskWheel->ulSlotsInUse[ uxLevel ] &= ~( ( uint32_t ) 1 << uxSlot );
+
+				while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+				{
+					pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxSlot ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+					prvInsertTaskInDelayedWheel( pxDelayedTaskWheel, pxTCB, listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) ), xDelayedTaskWheelTime );
+				}
+			}
+
+			/* Every task in the level 0 slot for the current time is due to
+			wake. */
+			uxSlot = ( UBaseType_t ) xDelayedTaskWheelTime & taskWHEEL_SLOT_MASK;
+			pxSlot = &( pxDelayedTaskWheel->xSlots[ uxSlot ] );
+			pxDelayedTaskWheel->ulSlotsInUse[ 0 ] &= ~( ( uint32_t ) 1 << uxSlot );
+
+			while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+			{
+				pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxSlot ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+				if( xItemValue == xDelayedTaskWheelTime )
+				{
+					/* Is the task waiting on an event also?  If so remove it
+					from the event list. */
+					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+					{
+						( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* Place the unblocked task into the appropriate ready
+					list. */
+					prvAddTaskToReadyList( pxTCB );
+
+					/* A task being unblocked cannot cause an immediate context
+					switch if preemption is turned off. */
+					#if (  configUSE_PREEMPTION == 1 )
+					{
+						if( taskRESCHEDULE_REQUIRED_FOR( pxTCB ) != pdFALSE )
+						{
+							xSwitchRequired = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#endif /* configUSE_PREEMPTION */
+				}
+				else
+				{
+					/* Only possible if configDELAYED_TASK_WHEEL_LEVELS is 1, in
+					which case level 0 also holds the tasks that are out of
+					range. */
+					prvInsertTaskInDelayedWheel( pxDelayedTaskWheel, pxTCB, xItemValue, xDelayedTaskWheelTime );
+				}
+			}
+		}
+
+		prvResetNextTaskUnblockTime();
+
+		return xSwitchRequired;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvAddTaskToDelayedWheel( TCB_t * const pxTCB, const TickType_t xTimeToWake, const TickType_t xConstTickCount )
+	{
+		if( xTimeToWake < xConstTickCount )
+		{
+			/* Wake time has overflowed.  Place the task in the overflow
+			wheel. */
+			prvInsertTaskInDelayedWheel( pxOverflowDelayedTaskWheel, pxTCB, xTimeToWake, portMAX_DELAY );
+		}
+		else
+		{
+			if( xConstTickCount < xNextTaskUnblockTime )
+			{
+				/* No wheel event is due, so the wheel time can be brought up
+				to the tick count without skipping one.  This keeps the tick
+				interrupt from having to catch up with the tick count. */
+				xDelayedTaskWheelTime = xConstTickCount;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The wake time has not overflowed, so the current wheel is used.
+			The task may be placed in a slot that needs processing before
+			xNextTaskUnblockTime, so xNextTaskUnblockTime is calculated
+			again. */
+			prvInsertTaskInDelayedWheel( pxDelayedTaskWheel, pxTCB, xTimeToWake, xDelayedTaskWheelTime );
+			prvResetNextTaskUnblockTime();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvInsertTaskInDelayedWheel( DelayedTaskWheel_t * const pxWheel, TCB_t * const pxTCB, const TickType_t xTimeToWake, const TickType_t xWheelTime )
+	{
+	TickType_t xTicksToWake, xSlotTime;
+	UBaseType_t uxLevel = ( UBaseType_t ) 0U, uxSlot;
+
+		listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), xTimeToWake );
+
+		xTicksToWake = ( TickType_t ) ( xTimeToWake - xWheelTime );
+		xSlotTime = xTimeToWake;
+
+		if( xTicksToWake >= taskWHEEL_RANGE )
+		{
+			/* Beyond the range of the wheel.  The task will be placed again
+			when the slot is moved down the wheel. */
+			xTicksToWake = taskWHEEL_RANGE - ( TickType_t ) 1;
+			xSlotTime = xWheelTime + xTicksToWake;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Level n holds the tasks that wake less than 32^(n+1) ticks from the
+		wheel time. */
+		while( ( xTicksToWake >> ( taskWHEEL_SLOT_BITS * ( uxLevel + ( UBaseType_t ) 1U ) ) ) != ( TickType_t ) 0 )
+		{
+			uxLevel++;
+		}
+
+		uxSlot = ( UBaseType_t ) ( xSlotTime >> ( taskWHEEL_SLOT_BITS * uxLevel ) ) & taskWHEEL_SLOT_MASK;
+		vListInsertEnd( &( pxWheel->xSlots[ ( uxLevel << taskWHEEL_SLOT_BITS ) + uxSlot ] ), &( pxTCB->xStateListItem ) );
+		pxWheel->ulSlotsInUse[ uxLevel ] |= ( uint32_t ) 1 << uxSlot;
+	}
+	/*-----------------------------------------------------------*/
+
+	static TickType_t prvGetTicksToNextWheelEvent( BaseType_t * const pxWheelIsEmpty )
+	{
+	TickType_t xTicksToEvent = portMAX_DELAY, xTicks, xLevelTime;
+	UBaseType_t uxLevel, uxShift, uxRotate;
+	uint32_t ulSlotsInUse;
+
+		*pxWheelIsEmpty = pdTRUE;
+
+		for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS; uxLevel++ )
+		{
+			ulSlotsInUse = pxDelayedTaskWheel->ulSlotsInUse[ uxLevel ];
+
+			if( ulSlotsInUse != 0UL )
+			{
+				*pxWheelIsEmpty = pdFALSE;
+				uxShift = taskWHEEL_SLOT_BITS * uxLevel;
+				xLevelTime = xDelayedTaskWheelTime >> uxShift;
+
+				/* Rotate the bit map so bit 0 represents the slot after the
+				current slot.  The tasks in the current slot for this period
+				have already been moved down the wheel, so anything left in the
+				current slot is for the same slot one revolution later. */
+				uxRotate = ( ( UBaseType_t ) xLevelTime + ( UBaseType_t ) 1U ) & taskWHEEL_SLOT_MASK;
+
+				if( uxRotate != ( UBaseType_t ) 0U )
+				{
+					ulSlotsInUse = ( ulSlotsInUse >> uxRotate ) | ( ulSlotsInUse << ( ( UBaseType_t ) 32U - uxRotate ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* The first occupied slot needs processing at the start of its
+				period. */
+				xTicks = ( TickType_t ) ( ( TickType_t ) ( ( xLevelTime + ( TickType_t ) prvGetLowestSetBit( ulSlotsInUse ) + ( TickType_t ) 1 ) << uxShift ) - xDelayedTaskWheelTime );
+
+				if( xTicks < xTicksToEvent )
+				{
+					xTicksToEvent = xTicks;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return xTicksToEvent;
+	}
+	/*-----------------------------------------------------------*/
+
+	static UBaseType_t prvGetLowestSetBit( uint32_t ulBitmap )
+	{
+	static const uint8_t ucBitPosition[ 32 ] = { 0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8, 31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9 };
+
+		/* Isolate the least significant set bit, then use a de Bruijn sequence
+		to map it to its index without a loop. */
+		return ( UBaseType_t ) ucBitPosition[ ( uint32_t ) ( ( ulBitmap & ( ( uint32_t ) 0 - ulBitmap ) ) * ( uint32_t ) 0x077CB531UL ) >> 27 ];
+	}
+
+#else /* configUSE_DELAYED_TASK_WHEEL */
+
+	static void prvResetNextTaskUnblockTime( void )
+	{
+	TCB_t *pxTCB;
+
+		if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+		{
+			/* The new current delayed list is empty.  Set xNextTaskUnblockTime to
+			the maximum possible value so it is	extremely unlikely that the
+			if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+			there is an item in the delayed list. */
+			xNextTaskUnblockTime = portMAX_DELAY;
+		}
+		else
+		{
+			/* The new current delayed list is not empty, get the value of
+			the item at the head of the delayed list.  This is the time at
+			which the task at the head of the delayed list should be removed
+			from the Blocked state. */
+			( pxTCB ) = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) );
+		}
+	}
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 2 ) && !defined( portCOUNT_LEADING_ZEROS ) )
+
+	static UBaseType_t prvGetHighestSetBit( uint32_t ulBitmap )
+	{
+	UBaseType_t uxBit = 0;
+
+		/* Binary search for the most significant set bit, so the number of
+		steps taken does not depend on which bit is set. */
+		if( ( ulBitmap & 0xffff0000UL ) != 0UL )
+		{
+			ulBitmap >>= 16;
+			uxBit += ( UBaseType_t ) 16;
+		}
+
+		if( ( ulBitmap & 0x0000ff00UL ) != 0UL )
+		{
+			ulBitmap >>= 8;
+			uxBit += ( UBaseType_t ) 8;
+		}
+
+		if( ( ulBitmap & 0x000000f0UL ) != 0UL )
+		{
+			ulBitmap >>= 4;
+			uxBit += ( UBaseType_t ) 4;
+		}
+
+		if( ( ulBitmap & 0x0000000cUL ) != 0UL )
+		{
+			ulBitmap >>= 2;
+			uxBit += ( UBaseType_t ) 2;
+		}
+
+		if( ( ulBitmap & 0x00000002UL ) != 0UL )
+		{
+			uxBit++;
+		}
+
+		return uxBit;
+	}
+
+#endif /* ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 2 ) && !portCOUNT_LEADING_ZEROS */
+/*-----------------------------------------------------------*/
+
+#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
+
+	TaskHandle_t xTaskGetCurrentTaskHandle( void )
+	{
+	TaskHandle_t xReturn;
+
+		/* A critical section is not required as this is not called from
+		an interrupt and the current TCB will always be the same for any
+		individual execution thread. */
+		xReturn = pxCurrentTCB;
+
+		return xReturn;
+	}
+
+#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+
+	BaseType_t xTaskGetSchedulerState( void )
+	{
+	BaseType_t xReturn;
+
+		if( xSchedulerRunning == pdFALSE )
+		{
+			xReturn = taskSCHEDULER_NOT_STARTED;
+		}
+		else
+		{
+			if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+			{
+				xReturn = taskSCHEDULER_RUNNING;
+			}
+			else
+			{
+				xReturn = taskSCHEDULER_SUSPENDED;
+			}
+		}
+
+		return xReturn;
+	}
+
+#endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) ) */
+/*-----------------------------------------------------------*/
 
-#endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) ) */
-/*-----------------------------------------------------------*/
-
 #if ( configUSE_MUTEXES == 1 )
 
 	BaseType_t xTaskPriorityInherit( TaskHandle_t const pxMutexHolder )
@@ -4613,41 +5865,408 @@ TickType_t uxReturn;
 }
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
 
-	TaskHandle_t pvTaskIncrementMutexHeldCount( void )
+	void vTaskPriorityMutexTaken( TaskHandle_t const pxMutexHolder, ListItem_t * const pxMutexItem, UBaseType_t uxHighestPriorityWaitingTask )
 	{
-		/* If xSemaphoreCreateMutex() is called before any tasks have been created
-		then pxCurrentTCB will be NULL. */
-		if( pxCurrentTCB != NULL )
+	TCB_t * const pxTCB = pxMutexHolder;
+
+		/* If the mutex is taken before any tasks have been created then there
+		is no holder to track. */
+		if( pxTCB != NULL )
 		{
-			( pxCurrentTCB->uxMutexesHeld )++;
-		}
+			/* A task that has just obtained a mutex is not blocked on one. */
+			if( pxTCB == pxCurrentTCB )
+			{
+				pxTCB->pxBlockedOnMutex = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-		return pxCurrentTCB;
+			listSET_LIST_ITEM_OWNER( pxMutexItem, pxTCB );
+			listSET_LIST_ITEM_VALUE( pxMutexItem, ( TickType_t ) uxHighestPriorityWaitingTask );
+			vListInsertEnd( &( pxTCB->xMutexesHeldList ), pxMutexItem );
+
+			/* Tasks that were already waiting for the mutex now wait on the new
+			holder, which inherits their priority straight away. */
+			prvUpdateMutexHolderPriority( pxMutexItem );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 	}
 
-#endif /* configUSE_MUTEXES */
+#endif /* configUSE_PRECISE_PRIORITY_INHERITANCE */
 /*-----------------------------------------------------------*/
 
-#if( configUSE_TASK_NOTIFICATIONS == 1 )
+#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
 
-	uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait )
+	BaseType_t xTaskPriorityInheritFromMutex( ListItem_t * const pxMutexItem )
 	{
-	uint32_t ulReturn;
+	TCB_t *pxMutexHolderTCB;
+	BaseType_t xReturn = pdFALSE;
 
-		taskENTER_CRITICAL();
+		/* Remember the mutex so a later change to the priority of this task
+		can be passed on to the mutex holder. */
+		pxCurrentTCB->pxBlockedOnMutex = pxMutexItem;
+
+		/* The mutex item is only in a list while the mutex is held. */
+		if( listLIST_ITEM_CONTAINER( pxMutexItem ) != NULL )
 		{
-			/* Only block if the notification count is not already non-zero. */
-			if( pxCurrentTCB->ulNotifiedValue == 0UL )
-			{
-				/* Mark this task as waiting for a notification. */
-				pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
+			pxMutexHolderTCB = listGET_LIST_ITEM_OWNER( pxMutexItem );
 
-				if( xTicksToWait > ( TickType_t ) 0 )
-				{
-					prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-					traceTASK_NOTIFY_TAKE_BLOCK();
+			if( listGET_LIST_ITEM_VALUE( pxMutexItem ) < ( TickType_t ) pxCurrentTCB->uxPriority )
+			{
+				listSET_LIST_ITEM_VALUE( pxMutexItem, ( TickType_t ) pxCurrentTCB->uxPriority );
+				prvUpdateMutexHolderPriority( pxMutexItem );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( pxMutexHolderTCB->uxBasePriority < pxCurrentTCB->uxPriority )
+			{
+				/* The mutex holder is running at an inherited priority. */
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_PRECISE_PRIORITY_INHERITANCE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+
+	BaseType_t xTaskPriorityDisinheritFromMutex( ListItem_t * const pxMutexItem )
+	{
+	UBaseType_t uxPriorityToUse;
+	BaseType_t xReturn = pdFALSE;
+
+		if( listLIST_ITEM_CONTAINER( pxMutexItem ) != NULL )
+		{
+			/* A mutex held by a task cannot be given from an interrupt, and if
+			a mutex is given by the holding task then it must be the running
+			state task. */
+			configASSERT( listGET_LIST_ITEM_OWNER( pxMutexItem ) == pxCurrentTCB );
+			configASSERT( pxCurrentTCB->uxMutexesHeld );
+			( pxCurrentTCB->uxMutexesHeld )--;
+			( void ) uxListRemove( pxMutexItem );
+
+			/* Drop whatever priority was inherited through this mutex alone,
+			keeping any priority inherited through the mutexes still held. */
+			uxPriorityToUse = prvGetInheritedPriority( pxCurrentTCB );
+
+			if( uxPriorityToUse != pxCurrentTCB->uxPriority )
+			{
+				prvSetInheritedPriority( pxCurrentTCB, uxPriorityToUse );
+
+				/* A task of higher priority than the new priority may now be
+				able to run. */
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_PRECISE_PRIORITY_INHERITANCE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+
+	void vTaskPriorityMutexWaitEnded( ListItem_t * const pxMutexItem, UBaseType_t uxHighestPriorityWaitingTask )
+	{
+		pxCurrentTCB->pxBlockedOnMutex = NULL;
+
+		if( listLIST_ITEM_CONTAINER( pxMutexItem ) != NULL )
+		{
+			/* The holder need only run as high as the tasks still waiting. */
+			listSET_LIST_ITEM_VALUE( pxMutexItem, ( TickType_t ) uxHighestPriorityWaitingTask );
+			prvUpdateMutexHolderPriority( pxMutexItem );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_PRECISE_PRIORITY_INHERITANCE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+
+	static UBaseType_t prvGetInheritedPriority( const TCB_t * const pxTCB )
+	{
+	UBaseType_t uxPriority = pxTCB->uxBasePriority;
+	const ListItem_t *pxIterator;
+	const ListItem_t * const pxEndMarker = listGET_END_MARKER( &( pxTCB->xMutexesHeldList ) );
+
+		for( pxIterator = listGET_HEAD_ENTRY( &( pxTCB->xMutexesHeldList ) ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+		{
+			if( listGET_LIST_ITEM_VALUE( pxIterator ) > ( TickType_t ) uxPriority )
+			{
+				uxPriority = ( UBaseType_t ) listGET_LIST_ITEM_VALUE( pxIterator );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return uxPriority;
+	}
+
+#endif /* configUSE_PRECISE_PRIORITY_INHERITANCE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+
+	static void prvSetInheritedPriority( TCB_t * const pxTCB, UBaseType_t uxNewPriority )
+	{
+	const UBaseType_t uxPriorityUsedOnEntry = pxTCB->uxPriority;
+	List_t *pxEventList;
+
+		if( uxNewPriority > uxPriorityUsedOnEntry )
+		{
+			traceTASK_PRIORITY_INHERIT( pxTCB, uxNewPriority );
+		}
+		else
+		{
+			traceTASK_PRIORITY_DISINHERIT( pxTCB, uxNewPriority );
+		}
+
+		pxTCB->uxPriority = uxNewPriority;
+
+		/* Only reset the event list item value if the value is not being used
+		for anything else.  If the task is blocked on a mutex the item is also
+		moved to keep the event list in priority order, so the head of the list
+		remains the highest priority waiting task. */
+		if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+		{
+			listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+			pxEventList = listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) );
+
+			if( ( pxTCB->pxBlockedOnMutex != NULL ) && ( pxEventList != NULL ) && ( pxEventList != &xPendingReadyList ) )
+			{
+				( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				vListInsert( pxEventList, &( pxTCB->xEventListItem ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* If the task is in the Ready state it needs to be moved into the ready
+		list for its new priority. */
+		if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+		{
+			if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+			{
+				/* It is known that the task is in its ready list so there is
+				no need to check again and the port level reset macro can be
+				called directly. */
+				portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			prvAddTaskToReadyList( pxTCB );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_PRECISE_PRIORITY_INHERITANCE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_PRECISE_PRIORITY_INHERITANCE == 1 )
+
+	static void prvUpdateMutexHolderPriority( ListItem_t *pxMutexItem )
+	{
+	TCB_t *pxMutexHolderTCB;
+	List_t *pxEventList;
+	UBaseType_t uxPriorityToUse;
+
+		/* Called from within a critical section.  The walk ends at the first
+		holder whose priority does not change, so a chain that loops back on
+		itself (a deadlock) still terminates once every task in the loop has
+		reached the same priority. */
+		while( pxMutexItem != NULL )
+		{
+			pxMutexHolderTCB = listGET_LIST_ITEM_OWNER( pxMutexItem );
+			uxPriorityToUse = prvGetInheritedPriority( pxMutexHolderTCB );
+			pxMutexItem = NULL;
+
+			if( uxPriorityToUse != pxMutexHolderTCB->uxPriority )
+			{
+				prvSetInheritedPriority( pxMutexHolderTCB, uxPriorityToUse );
+
+				/* If the holder is itself blocked on a held mutex then the
+				holder of that mutex has to be re-evaluated too.  The event
+				list is in priority order, so its head is the highest priority
+				task waiting for that mutex. */
+				pxEventList = listLIST_ITEM_CONTAINER( &( pxMutexHolderTCB->xEventListItem ) );
+
+				if( ( pxMutexHolderTCB->pxBlockedOnMutex != NULL ) &&
+					( listLIST_ITEM_CONTAINER( pxMutexHolderTCB->pxBlockedOnMutex ) != NULL ) &&
+					( pxEventList != NULL ) &&
+					( pxEventList != &xPendingReadyList ) )
+				{
+					pxMutexItem = pxMutexHolderTCB->pxBlockedOnMutex;
+					listSET_LIST_ITEM_VALUE( pxMutexItem, ( TickType_t ) ( ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxEventList ) )->uxPriority ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+
+#endif /* configUSE_PRECISE_PRIORITY_INHERITANCE */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_CEILING_MUTEXES == 1 ) && ( configUSE_PRECISE_PRIORITY_INHERITANCE == 0 ) )
+
+	void vTaskPriorityRaiseToCeiling( UBaseType_t uxCeilingPriority )
+	{
+		/* The priority ceiling of a mutex must be at least the priority of
+		every task that uses it. */
+		configASSERT( pxCurrentTCB->uxBasePriority <= uxCeilingPriority );
+
+		if( pxCurrentTCB->uxPriority < uxCeilingPriority )
+		{
+			/* Only reset the event list item value if the value is not being
+			used for anything else. */
+			if( ( listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+			{
+				listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxCeilingPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The running task is in the ready list for its priority. */
+			if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ), &( pxCurrentTCB->xStateListItem ) ) != pdFALSE )
+			{
+				if( uxListRemove( &( pxCurrentTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+				{
+					portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				traceTASK_PRIORITY_INHERIT( pxCurrentTCB, uxCeilingPriority );
+				pxCurrentTCB->uxPriority = uxCeilingPriority;
+				prvAddTaskToReadyList( pxCurrentTCB );
+			}
+			else
+			{
+				traceTASK_PRIORITY_INHERIT( pxCurrentTCB, uxCeilingPriority );
+				pxCurrentTCB->uxPriority = uxCeilingPriority;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	TaskHandle_t pvTaskIncrementMutexHeldCount( void )
+	{
+		/* If xSemaphoreCreateMutex() is called before any tasks have been created
+		then pxCurrentTCB will be NULL. */
+		if( pxCurrentTCB != NULL )
+		{
+			( pxCurrentTCB->uxMutexesHeld )++;
+		}
+
+		return pxCurrentTCB;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	void vTaskIncrementMutexHeldCount( TaskHandle_t xMutexHolder )
+	{
+	TCB_t * const pxTCB = xMutexHolder;
+
+		/* Called from within a critical section when a mutex that is already
+		held by xMutexHolder is handed over to the kernel's mutex
+		implementation, so xMutexHolder is not necessarily the running task. */
+		configASSERT( pxTCB );
+		( pxTCB->uxMutexesHeld )++;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWait, BaseType_t xClearCountOnExit, TickType_t xTicksToWait )
+	{
+	uint32_t ulReturn;
+
+		configASSERT( uxIndexToWait < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+		taskENTER_CRITICAL();
+		{
+			/* Only block if the notification count is not already non-zero. */
+			if( pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] == 0UL )
+			{
+				/* Mark this task as waiting for a notification. */
+				pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskWAITING_NOTIFICATION;
+
+				if( xTicksToWait > ( TickType_t ) 0 )
+				{
+					prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+					traceTASK_NOTIFY_TAKE_BLOCK();
 
 					/* All ports are written to allow a yield in a critical
 					section (some will yield immediately, others wait until the
@@ -4670,17 +6289,17 @@ TickType_t uxReturn;
 		taskENTER_CRITICAL();
 		{
 			traceTASK_NOTIFY_TAKE();
-			ulReturn = pxCurrentTCB->ulNotifiedValue;
+			ulReturn = pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ];
 
 			if( ulReturn != 0UL )
 			{
 				if( xClearCountOnExit != pdFALSE )
 				{
-					pxCurrentTCB->ulNotifiedValue = 0UL;
+					pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] = 0UL;
 				}
 				else
 				{
-					pxCurrentTCB->ulNotifiedValue = ulReturn - ( uint32_t ) 1;
+					pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] = ulReturn - ( uint32_t ) 1;
 				}
 			}
 			else
@@ -4688,7 +6307,7 @@ TickType_t uxReturn;
 				mtCOVERAGE_TEST_MARKER();
 			}
 
-			pxCurrentTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+			pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskNOT_WAITING_NOTIFICATION;
 		}
 		taskEXIT_CRITICAL();
 
@@ -4700,22 +6319,24 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait )
+	BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWait, uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait )
 	{
 	BaseType_t xReturn;
 
+		configASSERT( uxIndexToWait < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
 		taskENTER_CRITICAL();
 		{
 			/* Only block if a notification is not already pending. */
-			if( pxCurrentTCB->ucNotifyState != taskNOTIFICATION_RECEIVED )
+			if( pxCurrentTCB->ucNotifyState[ uxIndexToWait ] != taskNOTIFICATION_RECEIVED )
 			{
 				/* Clear bits in the task's notification value as bits may get
 				set	by the notifying task or interrupt.  This can be used to
 				clear the value to zero. */
-				pxCurrentTCB->ulNotifiedValue &= ~ulBitsToClearOnEntry;
+				pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] &= ~ulBitsToClearOnEntry;
 
 				/* Mark this task as waiting for a notification. */
-				pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
+				pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskWAITING_NOTIFICATION;
 
 				if( xTicksToWait > ( TickType_t ) 0 )
 				{
@@ -4748,14 +6369,14 @@ TickType_t uxReturn;
 			{
 				/* Output the current notification value, which may or may not
 				have changed. */
-				*pulNotificationValue = pxCurrentTCB->ulNotifiedValue;
+				*pulNotificationValue = pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ];
 			}
 
 			/* If ucNotifyValue is set then either the task never entered the
 			blocked state (because a notification was already pending) or the
 			task unblocked because of a notification.  Otherwise the task
 			unblocked because of a timeout. */
-			if( pxCurrentTCB->ucNotifyState != taskNOTIFICATION_RECEIVED )
+			if( pxCurrentTCB->ucNotifyState[ uxIndexToWait ] != taskNOTIFICATION_RECEIVED )
 			{
 				/* A notification was not received. */
 				xReturn = pdFALSE;
@@ -4764,11 +6385,11 @@ TickType_t uxReturn;
 			{
 				/* A notification was already pending or a notification was
 				received while the task was waiting. */
-				pxCurrentTCB->ulNotifiedValue &= ~ulBitsToClearOnExit;
+				pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] &= ~ulBitsToClearOnExit;
 				xReturn = pdTRUE;
 			}
 
-			pxCurrentTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+			pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskNOT_WAITING_NOTIFICATION;
 		}
 		taskEXIT_CRITICAL();
 
@@ -4780,44 +6401,145 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue )
+	BaseType_t xTaskGenericNotifyWaitBits( UBaseType_t uxIndexToWait, uint32_t ulBitsToWaitFor, BaseType_t xClearOnExit, BaseType_t xWaitForAllBits, uint32_t *pulNotificationValue, TickType_t xTicksToWait )
+	{
+	BaseType_t xReturn;
+	uint8_t ucWaitState;
+	uint32_t ulValue;
+
+		configASSERT( uxIndexToWait < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+		configASSERT( ulBitsToWaitFor != 0UL );
+
+		if( xWaitForAllBits != pdFALSE )
+		{
+			ucWaitState = taskWAITING_ALL_NOTIFICATION_BITS;
+		}
+		else
+		{
+			ucWaitState = taskWAITING_ANY_NOTIFICATION_BITS;
+		}
+
+		taskENTER_CRITICAL();
+		{
+			/* Only block if the bits are not already set.  The notifying task
+			or interrupt evaluates the condition each time it updates the
+			notification value, so the task is only unblocked once the wait
+			condition is met or the block time expires. */
+			if( taskNOTIFY_WAIT_CONDITION_MET( ucWaitState, pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ], ulBitsToWaitFor ) == pdFALSE )
+			{
+				pxCurrentTCB->ulNotifyBitsToWaitFor = ulBitsToWaitFor;
+				pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = ucWaitState;
+
+				if( xTicksToWait > ( TickType_t ) 0 )
+				{
+					prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+					traceTASK_NOTIFY_WAIT_BLOCK();
+
+					/* All ports are written to allow a yield in a critical
+					section (some will yield immediately, others wait until the
+					critical section exits) - but it is not something that
+					application code should ever do. */
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		taskENTER_CRITICAL();
+		{
+			traceTASK_NOTIFY_WAIT();
+
+			ulValue = pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ];
+
+			if( pulNotificationValue != NULL )
+			{
+				/* Output the notification value before any bits are cleared,
+				as xEventGroupWaitBits() does. */
+				*pulNotificationValue = ulValue;
+			}
+
+			/* Re-evaluate rather than rely on the notify state, as the task
+			may have been unblocked by a timeout in the same tick the bits
+			were set. */
+			if( taskNOTIFY_WAIT_CONDITION_MET( ucWaitState, ulValue, ulBitsToWaitFor ) != pdFALSE )
+			{
+				if( xClearOnExit != pdFALSE )
+				{
+					pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] = ulValue & ~ulBitsToWaitFor;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				/* The block time expired before the bits were set. */
+				xReturn = pdFALSE;
+			}
+
+			pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskNOT_WAITING_NOTIFICATION;
+			pxCurrentTCB->ulNotifyBitsToWaitFor = 0UL;
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue )
 	{
 	TCB_t * pxTCB;
 	BaseType_t xReturn = pdPASS;
 	uint8_t ucOriginalNotifyState;
 
 		configASSERT( xTaskToNotify );
+		configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 		pxTCB = xTaskToNotify;
 
 		taskENTER_CRITICAL();
 		{
 			if( pulPreviousNotificationValue != NULL )
 			{
-				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue;
+				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
 			}
 
-			ucOriginalNotifyState = pxTCB->ucNotifyState;
+			ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
 
-			pxTCB->ucNotifyState = taskNOTIFICATION_RECEIVED;
+			pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
 			switch( eAction )
 			{
 				case eSetBits	:
-					pxTCB->ulNotifiedValue |= ulValue;
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
 					break;
 
 				case eIncrement	:
-					( pxTCB->ulNotifiedValue )++;
+					( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
 					break;
 
 				case eSetValueWithOverwrite	:
-					pxTCB->ulNotifiedValue = ulValue;
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
 					break;
 
 				case eSetValueWithoutOverwrite :
 					if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
 					{
-						pxTCB->ulNotifiedValue = ulValue;
+						pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
 					}
 					else
 					{
@@ -4835,7 +6557,7 @@ TickType_t uxReturn;
 					/* Should not get here if all enums are handled.
 					Artificially force an assert by testing a value the
 					compiler can't assume is const. */
-					configASSERT( pxTCB->ulNotifiedValue == ~0UL );
+					configASSERT( pxTCB->ulNotifiedValue[ uxIndexToNotify ] == ~0UL );
 
 					break;
 			}
@@ -4843,8 +6565,9 @@ TickType_t uxReturn;
 			traceTASK_NOTIFY();
 
 			/* If the task is in the blocked state specifically to wait for a
-			notification then unblock it now. */
-			if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+			notification, and the notification satisfies any bit mask it is
+			waiting for, then unblock it now. */
+			if( taskNOTIFY_WAIT_CONDITION_MET( ucOriginalNotifyState, pxTCB->ulNotifiedValue[ uxIndexToNotify ], pxTCB->ulNotifyBitsToWaitFor ) )
 			{
 				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
 				prvAddTaskToReadyList( pxTCB );
@@ -4868,7 +6591,7 @@ TickType_t uxReturn;
 				}
 				#endif
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				if( taskPREEMPTS_CURRENT_TASK( pxTCB ) != pdFALSE )
 				{
 					/* The notified task has a priority above the currently
 					executing task so a yield is required. */
@@ -4879,6 +6602,12 @@ TickType_t uxReturn;
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
+			else if( taskIS_WAITING_NOTIFICATION( ucOriginalNotifyState ) )
+			{
+				/* The task is waiting for bits that are not all set yet, so
+				leave it blocked. */
+				pxTCB->ucNotifyState[ uxIndexToNotify ] = ucOriginalNotifyState;
+			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
@@ -4894,7 +6623,7 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken )
+	BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken )
 	{
 	TCB_t * pxTCB;
 	uint8_t ucOriginalNotifyState;
@@ -4902,6 +6631,7 @@ TickType_t uxReturn;
 	UBaseType_t uxSavedInterruptStatus;
 
 		configASSERT( xTaskToNotify );
+		configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 
 		/* RTOS ports that support interrupt nesting have the concept of a
 		maximum	system call (or maximum API call) interrupt priority.
@@ -4927,30 +6657,30 @@ TickType_t uxReturn;
 		{
 			if( pulPreviousNotificationValue != NULL )
 			{
-				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue;
+				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
 			}
 
-			ucOriginalNotifyState = pxTCB->ucNotifyState;
-			pxTCB->ucNotifyState = taskNOTIFICATION_RECEIVED;
+			ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+			pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
 			switch( eAction )
 			{
 				case eSetBits	:
-					pxTCB->ulNotifiedValue |= ulValue;
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
 					break;
 
 				case eIncrement	:
-					( pxTCB->ulNotifiedValue )++;
+					( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
 					break;
 
 				case eSetValueWithOverwrite	:
-					pxTCB->ulNotifiedValue = ulValue;
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
 					break;
 
 				case eSetValueWithoutOverwrite :
 					if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
 					{
-						pxTCB->ulNotifiedValue = ulValue;
+						pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
 					}
 					else
 					{
@@ -4968,15 +6698,16 @@ TickType_t uxReturn;
 					/* Should not get here if all enums are handled.
 					Artificially force an assert by testing a value the
 					compiler can't assume is const. */
-					configASSERT( pxTCB->ulNotifiedValue == ~0UL );
+					configASSERT( pxTCB->ulNotifiedValue[ uxIndexToNotify ] == ~0UL );
 					break;
 			}
 
 			traceTASK_NOTIFY_FROM_ISR();
 
 			/* If the task is in the blocked state specifically to wait for a
-			notification then unblock it now. */
-			if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+			notification, and the notification satisfies any bit mask it is
+			waiting for, then unblock it now. */
+			if( taskNOTIFY_WAIT_CONDITION_MET( ucOriginalNotifyState, pxTCB->ulNotifiedValue[ uxIndexToNotify ], pxTCB->ulNotifyBitsToWaitFor ) )
 			{
 				/* The task should not have been on an event list. */
 				configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
@@ -4993,7 +6724,7 @@ TickType_t uxReturn;
 					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
 				}
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				if( taskPREEMPTS_CURRENT_TASK( pxTCB ) != pdFALSE )
 				{
 					/* The notified task has a priority above the currently
 					executing task so a yield is required. */
@@ -5012,6 +6743,16 @@ TickType_t uxReturn;
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
+			else if( taskIS_WAITING_NOTIFICATION( ucOriginalNotifyState ) )
+			{
+				/* The task is waiting for bits that are not all set yet, so
+				leave it blocked. */
+				pxTCB->ucNotifyState[ uxIndexToNotify ] = ucOriginalNotifyState;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
 		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
@@ -5023,13 +6764,14 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken )
+	void vTaskGenericNotifyGiveFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, BaseType_t *pxHigherPriorityTaskWoken )
 	{
 	TCB_t * pxTCB;
 	uint8_t ucOriginalNotifyState;
 	UBaseType_t uxSavedInterruptStatus;
 
 		configASSERT( xTaskToNotify );
+		configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 
 		/* RTOS ports that support interrupt nesting have the concept of a
 		maximum	system call (or maximum API call) interrupt priority.
@@ -5053,18 +6795,19 @@ TickType_t uxReturn;
 
 		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 		{
-			ucOriginalNotifyState = pxTCB->ucNotifyState;
-			pxTCB->ucNotifyState = taskNOTIFICATION_RECEIVED;
+			ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+			pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
 			/* 'Giving' is equivalent to incrementing a count in a counting
 			semaphore. */
-			( pxTCB->ulNotifiedValue )++;
+			( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
 
 			traceTASK_NOTIFY_GIVE_FROM_ISR();
 
 			/* If the task is in the blocked state specifically to wait for a
-			notification then unblock it now. */
-			if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+			notification, and the notification satisfies any bit mask it is
+			waiting for, then unblock it now. */
+			if( taskNOTIFY_WAIT_CONDITION_MET( ucOriginalNotifyState, pxTCB->ulNotifiedValue[ uxIndexToNotify ], pxTCB->ulNotifyBitsToWaitFor ) )
 			{
 				/* The task should not have been on an event list. */
 				configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
@@ -5081,7 +6824,7 @@ TickType_t uxReturn;
 					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
 				}
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				if( taskPREEMPTS_CURRENT_TASK( pxTCB ) != pdFALSE )
 				{
 					/* The notified task has a priority above the currently
 					executing task so a yield is required. */
@@ -5100,6 +6843,16 @@ TickType_t uxReturn;
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
+			else if( taskIS_WAITING_NOTIFICATION( ucOriginalNotifyState ) )
+			{
+				/* The task is waiting for bits that are not all set yet, so
+				leave it blocked. */
+				pxTCB->ucNotifyState[ uxIndexToNotify ] = ucOriginalNotifyState;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
 		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 	}
@@ -5109,20 +6862,22 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask )
+	BaseType_t xTaskGenericNotifyStateClear( TaskHandle_t xTask, UBaseType_t uxIndexToClear )
 	{
 	TCB_t *pxTCB;
 	BaseType_t xReturn;
 
+		configASSERT( uxIndexToClear < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
 		/* If null is passed in here then it is the calling task that is having
 		its notification state cleared. */
 		pxTCB = prvGetTCBFromHandle( xTask );
 
 		taskENTER_CRITICAL();
 		{
-			if( pxTCB->ucNotifyState == taskNOTIFICATION_RECEIVED )
+			if( pxTCB->ucNotifyState[ uxIndexToClear ] == taskNOTIFICATION_RECEIVED )
 			{
-				pxTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+				pxTCB->ucNotifyState[ uxIndexToClear ] = taskNOT_WAITING_NOTIFICATION;
 				xReturn = pdPASS;
 			}
 			else
@@ -5140,11 +6895,13 @@ TickType_t uxReturn;
 
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	uint32_t ulTaskNotifyValueClear( TaskHandle_t xTask, uint32_t ulBitsToClear )
+	uint32_t ulTaskGenericNotifyValueClear( TaskHandle_t xTask, UBaseType_t uxIndexToClear, uint32_t ulBitsToClear )
 	{
 	TCB_t *pxTCB;
 	uint32_t ulReturn;
 
+		configASSERT( uxIndexToClear < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
 		/* If null is passed in here then it is the calling task that is having
 		its notification state cleared. */
 		pxTCB = prvGetTCBFromHandle( xTask );
@@ -5153,8 +6910,8 @@ TickType_t uxReturn;
 		{
 			/* Return the notification as it was before the bits were cleared,
 			then clear the bit mask. */
-			ulReturn = pxCurrentTCB->ulNotifiedValue;
-			pxTCB->ulNotifiedValue &= ~ulBitsToClear;
+			ulReturn = pxTCB->ulNotifiedValue[ uxIndexToClear ];
+			pxTCB->ulNotifiedValue[ uxIndexToClear ] &= ~ulBitsToClear;
 		}
 		taskEXIT_CRITICAL();
 
@@ -5217,33 +6974,41 @@ const TickType_t xConstTickCount = xTickCount;
 			kernel will manage it correctly. */
 			xTimeToWake = xConstTickCount + xTicksToWait;
 
-			/* The list item will be inserted in wake time order. */
-			listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
-
-			if( xTimeToWake < xConstTickCount )
+			#if( configUSE_DELAYED_TASK_WHEEL == 1 )
 			{
-				/* Wake time has overflowed.  Place this item in the overflow
-				list. */
-				vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+				prvAddTaskToDelayedWheel( pxCurrentTCB, xTimeToWake, xConstTickCount );
 			}
-			else
+			#else
 			{
-				/* The wake time has not overflowed, so the current block list
-				is used. */
-				vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+				/* The list item will be inserted in wake time order. */
+				listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
-				/* If the task entering the blocked state was placed at the
-				head of the list of blocked tasks then xNextTaskUnblockTime
-				needs to be updated too. */
-				if( xTimeToWake < xNextTaskUnblockTime )
+				if( xTimeToWake < xConstTickCount )
 				{
-					xNextTaskUnblockTime = xTimeToWake;
+					/* Wake time has overflowed.  Place this item in the
+					overflow list. */
+					vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					/* The wake time has not overflowed, so the current block
+					list is used. */
+					vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+
+					/* If the task entering the blocked state was placed at the
+					head of the list of blocked tasks then xNextTaskUnblockTime
+					needs to be updated too. */
+					if( xTimeToWake < xNextTaskUnblockTime )
+					{
+						xNextTaskUnblockTime = xTimeToWake;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
 			}
+			#endif /* configUSE_DELAYED_TASK_WHEEL */
 		}
 	}
 	#else /* INCLUDE_vTaskSuspend */
@@ -5253,31 +7018,39 @@ const TickType_t xConstTickCount = xTickCount;
 		will manage it correctly. */
 		xTimeToWake = xConstTickCount + xTicksToWait;
 
-		/* The list item will be inserted in wake time order. */
-		listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
-
-		if( xTimeToWake < xConstTickCount )
+		#if( configUSE_DELAYED_TASK_WHEEL == 1 )
 		{
-			/* Wake time has overflowed.  Place this item in the overflow list. */
-			vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+			prvAddTaskToDelayedWheel( pxCurrentTCB, xTimeToWake, xConstTickCount );
 		}
-		else
+		#else
 		{
-			/* The wake time has not overflowed, so the current block list is used. */
-			vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+			/* The list item will be inserted in wake time order. */
+			listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
-			/* If the task entering the blocked state was placed at the head of the
-			list of blocked tasks then xNextTaskUnblockTime needs to be updated
-			too. */
-			if( xTimeToWake < xNextTaskUnblockTime )
+			if( xTimeToWake < xConstTickCount )
 			{
-				xNextTaskUnblockTime = xTimeToWake;
+				/* Wake time has overflowed.  Place this item in the overflow list. */
+				vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				/* The wake time has not overflowed, so the current block list is used. */
+				vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+
+				/* If the task entering the blocked state was placed at the head of the
+				list of blocked tasks then xNextTaskUnblockTime needs to be updated
+				too. */
+				if( xTimeToWake < xNextTaskUnblockTime )
+				{
+					xNextTaskUnblockTime = xTimeToWake;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 		}
+		#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 		/* Avoid compiler warning when INCLUDE_vTaskSuspend is not 1. */
 		( void ) xCanBlockIndefinitely;
@@ -42,6 +42,10 @@ task.h is included from an application file. */
 	#error configUSE_TIMERS must be set to 1 to make the xTimerPendFunctionCall() function available.
 #endif
 
+#if ( configUSE_HARD_TIMERS == 1 ) && ( configUSE_TIMERS == 0 )
+	#error configUSE_TIMERS must be set to 1 to make the hard timer functionality available.
+#endif
+
 /* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
 because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
 for the header files above, but not in this file, in order to generate the
@@ -68,6 +72,32 @@ defining trmTIMER_SERVICE_TASK_NAME in FreeRTOSConfig.h. */
 #define tmrSTATUS_IS_ACTIVE					( ( uint8_t ) 0x01 )
 #define tmrSTATUS_IS_STATICALLY_ALLOCATED	( ( uint8_t ) 0x02 )
 #define tmrSTATUS_IS_AUTORELOAD				( ( uint8_t ) 0x04 )
+#define tmrSTATUS_IS_HARD					( ( uint8_t ) 0x08 )
+
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	/* Each level of the timer wheel has 32 slots, so the slots in use within a
+	level can be recorded in a 32-bit bit map. */
+	#define tmrWHEEL_SLOT_BITS		( 5U )
+	#define tmrWHEEL_SLOTS			( ( UBaseType_t ) 1U << tmrWHEEL_SLOT_BITS )
+	#define tmrWHEEL_SLOT_MASK		( tmrWHEEL_SLOTS - ( UBaseType_t ) 1U )
+
+	/* Timers that expire tmrWHEEL_RANGE or more ticks in the future are held in
+	the top level as if they expired tmrWHEEL_RANGE - 1 ticks in the future, and
+	are placed again when that slot is moved down the wheel. */
+	#define tmrWHEEL_RANGE			( ( TickType_t ) 1 << ( tmrWHEEL_SLOT_BITS * ( UBaseType_t ) configTIMER_WHEEL_LEVELS ) )
+
+	#if( configUSE_16_BIT_TICKS == 1 )
+		#if( ( configTIMER_WHEEL_LEVELS < 1 ) || ( configTIMER_WHEEL_LEVELS > 3 ) )
+			#error configTIMER_WHEEL_LEVELS must be between 1 and 3 when configUSE_16_BIT_TICKS is set to 1.
+		#endif
+	#else
+		#if( ( configTIMER_WHEEL_LEVELS < 1 ) || ( configTIMER_WHEEL_LEVELS > 6 ) )
+			#error configTIMER_WHEEL_LEVELS must be between 1 and 6.
+		#endif
+	#endif
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /* The definition of the timers themselves. */
 typedef struct tmrTimerControl /* The old naming convention is used to prevent breaking kernel aware debuggers. */
@@ -126,21 +156,95 @@ typedef struct tmrTimerQueueMessage
 /*lint -save -e956 A manual analysis and inspection has been used to determine
 which static variables must be declared volatile. */
 
-/* The list in which active timers are stored.  Timers are referenced in expire
-time order, with the nearest expiry time at the front of the list.  Only the
-timer service task is allowed to access these lists.
-xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
-breaks some kernel aware debuggers, and debuggers that reply on removing the
-static qualifier. */
-PRIVILEGED_DATA static List_t xActiveTimerList1;
-PRIVILEGED_DATA static List_t xActiveTimerList2;
-PRIVILEGED_DATA static List_t *pxCurrentTimerList;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	/* A hierarchical timer wheel.  Level n slot s (xSlots[ ( n * 32 ) + s ])
+	holds the timers that expire between 32^n and 32^(n+1) ticks after
+	xWheelTime and whose expiry time has s in bits ( 5 * n ) to ( ( 5 * n ) + 4 ).
+	When the wheel time reaches the start of the period covered by a slot in
+	level n > 0 the timers in that slot are moved down the wheel, so only the
+	timers in the level 0 slot for the current time have expired.  Timers are
+	not sorted within a slot, so starting, stopping and resetting a timer does
+	not depend on the number of active timers.  Bit s of ulSlotsInUse[ n ] is
+	set if level n slot s is not empty. */
+	typedef struct tmrTimerWheel
+	{
+		List_t xSlots[ ( UBaseType_t ) configTIMER_WHEEL_LEVELS * tmrWHEEL_SLOTS ];
+		uint32_t ulSlotsInUse[ configTIMER_WHEEL_LEVELS ];
+		TickType_t xWheelTime;
+	} TimerWheel_t;
+
+	/* The wheel in which active timers are stored.  Only the timer service
+	task is allowed to access the wheel. */
+	PRIVILEGED_DATA static TimerWheel_t xTimerWheel;
+
+#else /* configUSE_TIMER_WHEEL */
+
+	/* The list in which active timers are stored.  Timers are referenced in expire
+	time order, with the nearest expiry time at the front of the list.  Only the
+	timer service task is allowed to access these lists.
+	xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
+	breaks some kernel aware debuggers, and debuggers that reply on removing the
+	static qualifier. */
+	PRIVILEGED_DATA static List_t xActiveTimerList1;
+	PRIVILEGED_DATA static List_t xActiveTimerList2;
+	PRIVILEGED_DATA static List_t *pxCurrentTimerList;
+	PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+
+	/* The tick count when prvSampleTimeNow() was last called.  The timer lists
+	are switched when the tick count is found to be below this value. */
+	PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U;
+
+#endif /* configUSE_TIMER_WHEEL */
+
+#if ( configUSE_HARD_TIMERS == 1 )
+
+	#if ( configUSE_TIMER_WHEEL == 1 )
+
+		/* Hard timers are not processed by the timer service task.  They are
+		held in their own timer wheel, which is processed directly from the tick
+		interrupt, so starting a hard timer or reloading one from the tick
+		interrupt does not depend on the number of active hard timers.  The
+		wheel must only be accessed from within a critical section or from the
+		tick interrupt. */
+		PRIVILEGED_DATA static TimerWheel_t xHardTimerWheel;
+
+	#else /* configUSE_TIMER_WHEEL */
+
+		/* Hard timers are not processed by the timer service task.  They are
+		held in their own lists, in expire time order, and are processed
+		directly from the tick interrupt.  The lists are switched when the tick
+		count overflows, in the same way as the delayed task lists.  The lists
+		must only be accessed from within a critical section or from the tick
+		interrupt. */
+		PRIVILEGED_DATA static List_t xHardTimerList1;
+		PRIVILEGED_DATA static List_t xHardTimerList2;
+		PRIVILEGED_DATA static List_t * volatile pxCurrentHardTimerList;
+		PRIVILEGED_DATA static List_t * volatile pxOverflowHardTimerList;
+
+	#endif /* configUSE_TIMER_WHEEL */
+
+#endif /* configUSE_HARD_TIMERS */
 
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
 PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
 
+#if ( configUSE_DIRECT_TIMER_COMMANDS == 1 )
+
+	/* xTimerTaskIsWaiting is set while the timer service task is blocked
+	waiting for a command or for the time xTimerTaskWakeTime.  At that point the
+	timer service task is not part way through updating the active timers, and
+	will re-read them before processing any timer, so commands sent from tasks
+	can update the active timers directly instead of going through xTimerQueue
+	- provided the timer service task does not need to wake any earlier.  It is
+	not set if the timer service task blocks indefinitely because there are no
+	active timers, as a timer started directly would then never be processed. */
+	PRIVILEGED_DATA static volatile BaseType_t xTimerTaskIsWaiting = pdFALSE;
+	PRIVILEGED_DATA static TickType_t xTimerTaskWakeTime = ( TickType_t ) 0U;
+
+#endif /* configUSE_DIRECT_TIMER_COMMANDS */
+
 /*lint -restore */
 
 /*-----------------------------------------------------------*/
@@ -176,21 +280,68 @@ static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
 
 /*
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
- * depending on if the expire time causes a timer counter overflow.
+ * depending on if the expire time causes a timer counter overflow, or into the
+ * timer wheel if configUSE_TIMER_WHEEL is 1.
  */
 static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
 
 /*
  * An active timer has reached its expire time.  Reload the timer if it is an
- * auto-reload timer, then call its callback.
+ * auto-reload timer, then call its callback.  When the timer wheel is used all
+ * the timers that expire up to xTimeNow are processed in one call.
  */
 static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
 
-/*
- * The tick count has overflowed.  Switch the timer lists after ensuring the
- * current timer list does not still reference some timers.
- */
-static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	/*
+	 * Place the timer in the slot of pxWheel for xExpiryTime, relative to the
+	 * wheel time.
+	 */
+	static void prvInsertTimerInWheel( TimerWheel_t * const pxWheel, Timer_t * const pxTimer, const TickType_t xExpiryTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Remove the timer from the slot of pxWheel that holds it, clearing the
+	 * slot's bit in ulSlotsInUse if the slot becomes empty.
+	 */
+	static void prvRemoveTimerFromWheel( TimerWheel_t * const pxWheel, Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+	/* Active software timers are held in xTimerWheel. */
+	#define prvRemoveTimerFromActiveList( pxTimer ) prvRemoveTimerFromWheel( &xTimerWheel, ( pxTimer ) )
+
+	/*
+	 * The wheel time of pxWheel has just been moved forward to an event.  Move
+	 * the timers held in any slot whose period starts at the new wheel time
+	 * down the wheel.
+	 */
+	static void prvMoveSlotsDownWheel( TimerWheel_t * const pxWheel ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the number of ticks from the wheel time of pxWheel until the wheel
+	 * next needs processing - either because a timer expires or because a slot
+	 * must be moved down the wheel.  *pxWheelIsEmpty is set to pdTRUE if there
+	 * are no timers in the wheel.
+	 */
+	static TickType_t prvGetTicksToNextWheelEvent( const TimerWheel_t * const pxWheel, BaseType_t * const pxWheelIsEmpty ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the index of the least significant set bit in ulBitmap, which
+	 * must not be zero.
+	 */
+	static UBaseType_t prvGetLowestSetBit( uint32_t ulBitmap ) PRIVILEGED_FUNCTION;
+
+#else /* configUSE_TIMER_WHEEL */
+
+	/*
+	 * The tick count has overflowed.  Switch the timer lists after ensuring the
+	 * current timer list does not still reference some timers.
+	 */
+	static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+
+	/* Timers are removed from the active lists directly. */
+	#define prvRemoveTimerFromActiveList( pxTimer ) ( void ) uxListRemove( &( ( pxTimer )->xTimerListItem ) )
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
@@ -206,6 +357,37 @@ static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched
  */
 static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_DIRECT_TIMER_COMMANDS == 1 )
+
+	/*
+	 * Apply a start, reset, stop, change period or delete command sent from a
+	 * task directly to the active timers, without sending it to the timer
+	 * service task.  Returns pdFAIL, without changing anything, if the command
+	 * must instead be sent to the timer service task.
+	 */
+	static BaseType_t prvDirectTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_DIRECT_TIMER_COMMANDS */
+
+#if ( configUSE_HARD_TIMERS == 1 )
+
+	/*
+	 * Perform a start, reset, stop, change period or delete command on a hard
+	 * timer directly, rather than sending the command to the timer service
+	 * task.
+	 */
+	static BaseType_t prvHardTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Insert a hard timer into the hard timer wheel or lists so it expires
+	 * xTicksToExpiry ticks after xTimeNow.  xTicksToExpiry must be greater
+	 * than zero.  Must be called from within a critical section or from the
+	 * tick interrupt.
+	 */
+	static void prvInsertHardTimer( Timer_t * const pxTimer, const TickType_t xTimeNow, const TickType_t xTicksToExpiry ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_HARD_TIMERS */
+
 /*
  * If a timer has expired, process it.  Otherwise, block the timer service task
  * until either a timer does expire or a command is received.
@@ -346,6 +528,55 @@ BaseType_t xReturn = pdFAIL;
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
+#if( ( configUSE_HARD_TIMERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	TimerHandle_t xTimerCreateHard(	const char * const pcTimerName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+									const TickType_t xTimerPeriodInTicks,
+									const UBaseType_t uxAutoReload,
+									void * const pvTimerID,
+									TimerCallbackFunction_t pxCallbackFunction )
+	{
+	Timer_t *pxNewTimer;
+
+		pxNewTimer = xTimerCreate( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction );
+
+		if( pxNewTimer != NULL )
+		{
+			/* The timer has not been started so cannot yet be referenced from
+			the timer service task or the tick interrupt. */
+			pxNewTimer->ucStatus |= tmrSTATUS_IS_HARD;
+		}
+
+		return pxNewTimer;
+	}
+
+#endif /* ( configUSE_HARD_TIMERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_HARD_TIMERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	TimerHandle_t xTimerCreateHardStatic(	const char * const pcTimerName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+											const TickType_t xTimerPeriodInTicks,
+											const UBaseType_t uxAutoReload,
+											void * const pvTimerID,
+											TimerCallbackFunction_t pxCallbackFunction,
+											StaticTimer_t *pxTimerBuffer )
+	{
+	Timer_t *pxNewTimer;
+
+		pxNewTimer = xTimerCreateStatic( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction, pxTimerBuffer );
+
+		if( pxNewTimer != NULL )
+		{
+			pxNewTimer->ucStatus |= tmrSTATUS_IS_HARD;
+		}
+
+		return pxNewTimer;
+	}
+
+#endif /* ( configUSE_HARD_TIMERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
 static void prvInitialiseNewTimer(	const char * const pcTimerName,			/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 									const TickType_t xTimerPeriodInTicks,
 									const UBaseType_t uxAutoReload,
@@ -382,12 +613,35 @@ BaseType_t xTimerGenericCommand( TimerHandle_t xTimer, const BaseType_t xCommand
 {
 BaseType_t xReturn = pdFAIL;
 DaemonTaskMessage_t xMessage;
+BaseType_t xTimerIsHard = pdFALSE;
 
 	configASSERT( xTimer );
 
-	/* Send a message to the timer service task to perform a particular action
-	on a particular timer definition. */
-	if( xTimerQueue != NULL )
+	#if ( configUSE_HARD_TIMERS == 1 )
+	{
+		/* The hard bit is set before the timer is first used and never
+		changes, so can be read outside of a critical section. */
+		if( ( xTimer->ucStatus & tmrSTATUS_IS_HARD ) != 0U )
+		{
+			xTimerIsHard = pdTRUE;
+		}
+	}
+	#endif /* configUSE_HARD_TIMERS */
+
+	if( xTimerIsHard != pdFALSE )
+	{
+		#if ( configUSE_HARD_TIMERS == 1 )
+		{
+			/* Hard timers are not processed by the timer service task, so the
+			command is performed immediately and never needs to block. */
+			( void ) pxHigherPriorityTaskWoken;
+			( void ) xTicksToWait;
+			xReturn = prvHardTimerCommand( xTimer, xCommandID, xOptionalValue );
+			traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
+		}
+		#endif /* configUSE_HARD_TIMERS */
+	}
+	else if( xTimerQueue != NULL )
 	{
 		/* Send a command to the timer service task to start the xTimer timer. */
 		xMessage.xMessageID = xCommandID;
@@ -398,7 +652,22 @@ DaemonTaskMessage_t xMessage;
 		{
 			if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
 			{
-				xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
+				#if ( configUSE_DIRECT_TIMER_COMMANDS == 1 )
+				{
+					/* Avoid the round trip through the timer service task if
+					possible. */
+					xReturn = prvDirectTimerCommand( xTimer, xCommandID, xOptionalValue );
+				}
+				#endif /* configUSE_DIRECT_TIMER_COMMANDS */
+
+				if( xReturn == pdFAIL )
+				{
+					xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 			else
 			{
@@ -504,45 +773,49 @@ Timer_t *pxTimer = xTimer;
 }
 /*-----------------------------------------------------------*/
 
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
-{
-BaseType_t xResult;
-Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-
-	/* Remove the timer from the list of active timers.  A check has already
-	been performed to ensure the list is not empty. */
-	( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
-	traceTIMER_EXPIRED( pxTimer );
+#if ( configUSE_TIMER_WHEEL == 0 )
 
-	/* If the timer is an auto-reload timer then calculate the next
-	expiry time and re-insert the timer in the list of active timers. */
-	if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
+	static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 	{
-		/* The timer is inserted into a list using a time relative to anything
-		other than the current time.  It will therefore be inserted into the
-		correct list relative to the time this task thinks it is now. */
-		if( prvInsertTimerInActiveList( pxTimer, ( xNextExpireTime + pxTimer->xTimerPeriodInTicks ), xTimeNow, xNextExpireTime ) != pdFALSE )
+	BaseType_t xResult;
+	Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+		/* Remove the timer from the list of active timers.  A check has already
+		been performed to ensure the list is not empty. */
+		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+		traceTIMER_EXPIRED( pxTimer );
+
+		/* If the timer is an auto-reload timer then calculate the next
+		expiry time and re-insert the timer in the list of active timers. */
+		if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
 		{
-			/* The timer expired before it was added to the active timer
-			list.  Reload it now.  */
-			xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
-			configASSERT( xResult );
-			( void ) xResult;
+			/* The timer is inserted into a list using a time relative to anything
+			other than the current time.  It will therefore be inserted into the
+			correct list relative to the time this task thinks it is now. */
+			if( prvInsertTimerInActiveList( pxTimer, ( xNextExpireTime + pxTimer->xTimerPeriodInTicks ), xTimeNow, xNextExpireTime ) != pdFALSE )
+			{
+				/* The timer expired before it was added to the active timer
+				list.  Reload it now.  */
+				xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
+				configASSERT( xResult );
+				( void ) xResult;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
 		else
 		{
+			pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
 			mtCOVERAGE_TEST_MARKER();
 		}
-	}
-	else
-	{
-		pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
-		mtCOVERAGE_TEST_MARKER();
+
+		/* Call the timer callback. */
+		pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 	}
 
-	/* Call the timer callback. */
-	pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
-}
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static portTASK_FUNCTION( prvTimerTask, pvParameters )
@@ -581,154 +854,179 @@ BaseType_t xListWasEmpty;
 }
 /*-----------------------------------------------------------*/
 
-static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
-{
-TickType_t xTimeNow;
-BaseType_t xTimerListsWereSwitched;
+#if ( configUSE_TIMER_WHEEL == 0 )
 
-	vTaskSuspendAll();
+	static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
 	{
-		/* Obtain the time now to make an assessment as to whether the timer
-		has expired or not.  If obtaining the time causes the lists to switch
-		then don't process this timer as any timers that remained in the list
-		when the lists were switched will have been processed within the
-		prvSampleTimeNow() function. */
-		xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
-		if( xTimerListsWereSwitched == pdFALSE )
+	TickType_t xTimeNow;
+	BaseType_t xTimerListsWereSwitched;
+
+		vTaskSuspendAll();
 		{
-			/* The tick count has not overflowed, has the timer expired? */
-			if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
-			{
-				( void ) xTaskResumeAll();
-				prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
-			}
-			else
+			/* Obtain the time now to make an assessment as to whether the timer
+			has expired or not.  If obtaining the time causes the lists to switch
+			then don't process this timer as any timers that remained in the list
+			when the lists were switched will have been processed within the
+			prvSampleTimeNow() function. */
+			xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+			if( xTimerListsWereSwitched == pdFALSE )
 			{
-				/* The tick count has not overflowed, and the next expire
-				time has not been reached yet.  This task should therefore
-				block to wait for the next expire time or a command to be
-				received - whichever comes first.  The following line cannot
-				be reached unless xNextExpireTime > xTimeNow, except in the
-				case when the current timer list is empty. */
-				if( xListWasEmpty != pdFALSE )
-				{
-					/* The current timer list is empty - is the overflow list
-					also empty? */
-					xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
-				}
-
-				vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
-
-				if( xTaskResumeAll() == pdFALSE )
+				/* The tick count has not overflowed, has the timer expired? */
+				if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
 				{
-					/* Yield to wait for either a command to arrive, or the
-					block time to expire.  If a command arrived between the
-					critical section being exited and this yield then the yield
-					will not cause the task to block. */
-					portYIELD_WITHIN_API();
+					( void ) xTaskResumeAll();
+					prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					/* The tick count has not overflowed, and the next expire
+					time has not been reached yet.  This task should therefore
+					block to wait for the next expire time or a command to be
+					received - whichever comes first.  The following line cannot
+					be reached unless xNextExpireTime > xTimeNow, except in the
+					case when the current timer list is empty. */
+					if( xListWasEmpty != pdFALSE )
+					{
+						/* The current timer list is empty - is the overflow list
+						also empty? */
+						xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+					}
+
+					#if ( configUSE_DIRECT_TIMER_COMMANDS == 1 )
+					{
+						/* Tasks can update the active timers directly while this task
+						is blocked, unless it is going to block indefinitely. */
+						if( xListWasEmpty == pdFALSE )
+						{
+							xTimerTaskWakeTime = xNextExpireTime;
+							xTimerTaskIsWaiting = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#endif /* configUSE_DIRECT_TIMER_COMMANDS */
+
+					vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+
+					if( xTaskResumeAll() == pdFALSE )
+					{
+						/* Yield to wait for either a command to arrive, or the
+						block time to expire.  If a command arrived between the
+						critical section being exited and this yield then the yield
+						will not cause the task to block. */
+						portYIELD_WITHIN_API();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					#if ( configUSE_DIRECT_TIMER_COMMANDS == 1 )
+					{
+						xTimerTaskIsWaiting = pdFALSE;
+					}
+					#endif /* configUSE_DIRECT_TIMER_COMMANDS */
 				}
 			}
+			else
+			{
+				( void ) xTaskResumeAll();
+			}
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
+	{
+	TickType_t xNextExpireTime;
+
+		/* Timers are listed in expiry time order, with the head of the list
+		referencing the task that will expire first.  Obtain the time at which
+		the timer with the nearest expiry time will expire.  If there are no
+		active timers then just set the next expire time to 0.  That will cause
+		this task to unblock when the tick count overflows, at which point the
+		timer lists will be switched and the next expiry time can be
+		re-assessed.  */
+		*pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
+		if( *pxListWasEmpty == pdFALSE )
+		{
+			xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
 		}
 		else
 		{
-			( void ) xTaskResumeAll();
+			/* Ensure the task unblocks when the tick count rolls over. */
+			xNextExpireTime = ( TickType_t ) 0U;
 		}
-	}
-}
-/*-----------------------------------------------------------*/
-
-static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
-{
-TickType_t xNextExpireTime;
 
-	/* Timers are listed in expiry time order, with the head of the list
-	referencing the task that will expire first.  Obtain the time at which
-	the timer with the nearest expiry time will expire.  If there are no
-	active timers then just set the next expire time to 0.  That will cause
-	this task to unblock when the tick count overflows, at which point the
-	timer lists will be switched and the next expiry time can be
-	re-assessed.  */
-	*pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
-	if( *pxListWasEmpty == pdFALSE )
-	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
-	}
-	else
-	{
-		/* Ensure the task unblocks when the tick count rolls over. */
-		xNextExpireTime = ( TickType_t ) 0U;
+		return xNextExpireTime;
 	}
+	/*-----------------------------------------------------------*/
 
-	return xNextExpireTime;
-}
-/*-----------------------------------------------------------*/
-
-static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
-{
-TickType_t xTimeNow;
-PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Variable is only accessible to one task. */
-
-	xTimeNow = xTaskGetTickCount();
-
-	if( xTimeNow < xLastTime )
-	{
-		prvSwitchTimerLists();
-		*pxTimerListsWereSwitched = pdTRUE;
-	}
-	else
+	static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
 	{
-		*pxTimerListsWereSwitched = pdFALSE;
-	}
-
-	xLastTime = xTimeNow;
-
-	return xTimeNow;
-}
-/*-----------------------------------------------------------*/
+	TickType_t xTimeNow;
 
-static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
-{
-BaseType_t xProcessTimerNow = pdFALSE;
-
-	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
-	listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+		xTimeNow = xTaskGetTickCount();
 
-	if( xNextExpiryTime <= xTimeNow )
-	{
-		/* Has the expiry time elapsed between the command to start/reset a
-		timer was issued, and the time the command was processed? */
-		if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		if( xTimeNow < xLastTime )
 		{
-			/* The time between a command being issued and the command being
-			processed actually exceeds the timers period.  */
-			xProcessTimerNow = pdTRUE;
+			prvSwitchTimerLists();
+			*pxTimerListsWereSwitched = pdTRUE;
 		}
 		else
 		{
-			vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+			*pxTimerListsWereSwitched = pdFALSE;
 		}
+
+		xLastTime = xTimeNow;
+
+		return xTimeNow;
 	}
-	else
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
 	{
-		if( ( xTimeNow < xCommandTime ) && ( xNextExpiryTime >= xCommandTime ) )
+	BaseType_t xProcessTimerNow = pdFALSE;
+
+		listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
+		listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+
+		if( xNextExpiryTime <= xTimeNow )
 		{
-			/* If, since the command was issued, the tick count has overflowed
-			but the expiry time has not, then the timer must have already passed
-			its expiry time and should be processed immediately. */
-			xProcessTimerNow = pdTRUE;
+			/* Has the expiry time elapsed between the command to start/reset a
+			timer was issued, and the time the command was processed? */
+			if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+			{
+				/* The time between a command being issued and the command being
+				processed actually exceeds the timers period.  */
+				xProcessTimerNow = pdTRUE;
+			}
+			else
+			{
+				vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+			}
 		}
 		else
 		{
-			vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+			if( ( xTimeNow < xCommandTime ) && ( xNextExpiryTime >= xCommandTime ) )
+			{
+				/* If, since the command was issued, the tick count has overflowed
+				but the expiry time has not, then the timer must have already passed
+				its expiry time and should be processed immediately. */
+				xProcessTimerNow = pdTRUE;
+			}
+			else
+			{
+				vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+			}
 		}
+
+		return xProcessTimerNow;
 	}
 
-	return xProcessTimerNow;
-}
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void	prvProcessReceivedCommands( void )
@@ -773,7 +1071,7 @@ TickType_t xTimeNow;
 			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
 			{
 				/* The timer is in a list, remove it. */
-				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				prvRemoveTimerFromActiveList( pxTimer );
 			}
 			else
 			{
@@ -879,78 +1177,993 @@ TickType_t xTimeNow;
 }
 /*-----------------------------------------------------------*/
 
-static void prvSwitchTimerLists( void )
-{
-TickType_t xNextExpireTime, xReloadTime;
-List_t *pxTemp;
-Timer_t *pxTimer;
-BaseType_t xResult;
+#if ( configUSE_TIMER_WHEEL == 0 )
 
-	/* The tick count has overflowed.  The timer lists must be switched.
-	If there are any timers still referenced from the current timer list
-	then they must have expired and should be processed before the lists
-	are switched. */
-	while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+	static void prvSwitchTimerLists( void )
 	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+	TickType_t xNextExpireTime, xReloadTime;
+	List_t *pxTemp;
+	Timer_t *pxTimer;
+	BaseType_t xResult;
+
+		/* The tick count has overflowed.  The timer lists must be switched.
+		If there are any timers still referenced from the current timer list
+		then they must have expired and should be processed before the lists
+		are switched. */
+		while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+		{
+			xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
 
-		/* Remove the timer from the list. */
-		pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
-		traceTIMER_EXPIRED( pxTimer );
+			/* Remove the timer from the list. */
+			pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+			traceTIMER_EXPIRED( pxTimer );
 
-		/* Execute its callback, then send a command to restart the timer if
-		it is an auto-reload timer.  It cannot be restarted here as the lists
-		have not yet been switched. */
-		pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+			/* Execute its callback, then send a command to restart the timer if
+			it is an auto-reload timer.  It cannot be restarted here as the lists
+			have not yet been switched. */
+			pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 
-		if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
-		{
-			/* Calculate the reload value, and if the reload value results in
-			the timer going into the same timer list then it has already expired
-			and the timer should be re-inserted into the current list so it is
-			processed again within this loop.  Otherwise a command should be sent
-			to restart the timer to ensure it is only inserted into a list after
-			the lists have been swapped. */
-			xReloadTime = ( xNextExpireTime + pxTimer->xTimerPeriodInTicks );
-			if( xReloadTime > xNextExpireTime )
+			if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
 			{
-				listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xReloadTime );
-				listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
-				vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+				/* Calculate the reload value, and if the reload value results in
+				the timer going into the same timer list then it has already expired
+				and the timer should be re-inserted into the current list so it is
+				processed again within this loop.  Otherwise a command should be sent
+				to restart the timer to ensure it is only inserted into a list after
+				the lists have been swapped. */
+				xReloadTime = ( xNextExpireTime + pxTimer->xTimerPeriodInTicks );
+				if( xReloadTime > xNextExpireTime )
+				{
+					listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xReloadTime );
+					listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+					vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+				}
+				else
+				{
+					xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
+					configASSERT( xResult );
+					( void ) xResult;
+				}
 			}
 			else
 			{
-				xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xNextExpireTime, NULL, tmrNO_DELAY );
-				configASSERT( xResult );
-				( void ) xResult;
+				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
+
+		pxTemp = pxCurrentTimerList;
+		pxCurrentTimerList = pxOverflowTimerList;
+		pxOverflowTimerList = pxTemp;
 	}
 
-	pxTemp = pxCurrentTimerList;
-	pxCurrentTimerList = pxOverflowTimerList;
-	pxOverflowTimerList = pxTemp;
-}
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
-static void prvCheckForValidListAndQueue( void )
-{
-	/* Check that the list from which active timers are referenced, and the
-	queue used to communicate with the timer service, have been
-	initialised. */
-	taskENTER_CRITICAL();
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 	{
-		if( xTimerQueue == NULL )
+	TickType_t xTicksToEvent, xExpiryTime;
+	BaseType_t xWheelIsEmpty;
+	List_t *pxSlot;
+	Timer_t *pxTimer;
+
+		/* xNextExpireTime is the time of the next wheel event, which has been
+		reached.  Step the wheel time through each event up to and including
+		xTimeNow so all the timers that have expired are processed in one
+		batch. */
+		( void ) xNextExpireTime;
+
+		for( ;; )
+		{
+			xTicksToEvent = prvGetTicksToNextWheelEvent( &xTimerWheel, &xWheelIsEmpty );
+
+			if( ( xWheelIsEmpty != pdFALSE ) || ( xTicksToEvent > ( TickType_t ) ( xTimeNow - xTimerWheel.xWheelTime ) ) )
+			{
+				/* There are no more events before xTimeNow.  Moving the wheel
+				time over empty slots does not change when the occupied slots
+				are processed. */
+				xTimerWheel.xWheelTime = xTimeNow;
+				break;
+			}
+			else
+			{
+				xTimerWheel.xWheelTime += xTicksToEvent;
+			}
+
+			prvMoveSlotsDownWheel( &xTimerWheel );
+
+			/* Every timer in the level 0 slot for the current time has
+			expired. */
+			pxSlot = &( xTimerWheel.xSlots[ ( UBaseType_t ) xTimerWheel.xWheelTime & tmrWHEEL_SLOT_MASK ] );
+
+			while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+			{
+				pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				xExpiryTime = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+				prvRemoveTimerFromActiveList( pxTimer );
+
+				if( xExpiryTime == xTimerWheel.xWheelTime )
+				{
+					traceTIMER_EXPIRED( pxTimer );
+
+					/* If the timer is an auto-reload timer then calculate the
+					next expiry time and re-insert the timer in the wheel.  The
+					period cannot be zero, so the timer cannot be placed back in
+					this slot.  If the next expiry time is also before xTimeNow
+					the timer will be processed again within this batch. */
+					if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
+					{
+						prvInsertTimerInWheel( &xTimerWheel, pxTimer, xExpiryTime + pxTimer->xTimerPeriodInTicks );
+					}
+					else
+					{
+						pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+					}
+
+					/* Call the timer callback. */
+					pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+				}
+				else
+				{
+					/* Only possible if configTIMER_WHEEL_LEVELS is 1, in which
+					case level 0 also holds the timers that are out of range. */
+					prvInsertTimerInWheel( &xTimerWheel, pxTimer, xExpiryTime );
+				}
+			}
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
+	{
+	TickType_t xTimeNow;
+
+		vTaskSuspendAll();
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
-			pxCurrentTimerList = &xActiveTimerList1;
-			pxOverflowTimerList = &xActiveTimerList2;
+			/* Times are measured relative to the wheel time, which is never
+			ahead of the tick count, so tick count overflows do not need any
+			special handling. */
+			xTimeNow = xTaskGetTickCount();
+
+			if( ( xListWasEmpty == pdFALSE ) && ( ( TickType_t ) ( xNextExpireTime - xTimerWheel.xWheelTime ) <= ( TickType_t ) ( xTimeNow - xTimerWheel.xWheelTime ) ) )
+			{
+				( void ) xTaskResumeAll();
+				prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
+			}
+			else
+			{
+				#if ( configUSE_DIRECT_TIMER_COMMANDS == 1 )
+				{
+					/* Tasks can update the active timers directly while this task
+					is blocked, unless it is going to block indefinitely. */
+					if( xListWasEmpty == pdFALSE )
+					{
+						xTimerTaskWakeTime = xNextExpireTime;
+						xTimerTaskIsWaiting = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_DIRECT_TIMER_COMMANDS */
+
+				/* Block to wait for the next wheel event or a command to be
+				received - whichever comes first.  If the wheel is empty then
+				there is no event to wait for. */
+				vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+
+				if( xTaskResumeAll() == pdFALSE )
+				{
+					/* Yield to wait for either a command to arrive, or the
+					block time to expire.  If a command arrived between the
+					critical section being exited and this yield then the yield
+					will not cause the task to block. */
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				#if ( configUSE_DIRECT_TIMER_COMMANDS == 1 )
+				{
+					xTimerTaskIsWaiting = pdFALSE;
+				}
+				#endif /* configUSE_DIRECT_TIMER_COMMANDS */
+			}
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
+	{
+		/* The timer service task must next run when a timer expires or when a
+		slot must be moved down the wheel, whichever is first. */
+		return xTimerWheel.xWheelTime + prvGetTicksToNextWheelEvent( &xTimerWheel, pxListWasEmpty );
+	}
+	/*-----------------------------------------------------------*/
+
+	static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
+	{
+		/* There are no timer lists to switch when the tick count overflows. */
+		*pxTimerListsWereSwitched = pdFALSE;
+
+		return xTaskGetTickCount();
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
+	{
+	BaseType_t xProcessTimerNow = pdFALSE, xWheelIsEmpty;
+
+		/* Measuring both times from the time the command was issued means a
+		tick count overflow between the command being issued and processed
+		does not need special handling. */
+		if( ( TickType_t ) ( xTimeNow - xCommandTime ) >= ( TickType_t ) ( xNextExpiryTime - xCommandTime ) )
+		{
+			/* The expiry time elapsed between the command to start/reset the
+			timer being issued, and the command being processed. */
+			listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
+			xProcessTimerNow = pdTRUE;
+		}
+		else
+		{
+			/* The wheel time is only moved forward when the wheel is
+			processed, so bring it up to date if the wheel is empty. */
+			( void ) prvGetTicksToNextWheelEvent( &xTimerWheel, &xWheelIsEmpty );
+
+			if( xWheelIsEmpty != pdFALSE )
+			{
+				xTimerWheel.xWheelTime = xTimeNow;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			prvInsertTimerInWheel( &xTimerWheel, pxTimer, xNextExpiryTime );
+		}
+
+		return xProcessTimerNow;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvInsertTimerInWheel( TimerWheel_t * const pxWheel, Timer_t * const pxTimer, const TickType_t xExpiryTime )
+	{
+	TickType_t xTicksToExpiry, xSlotTime;
+	UBaseType_t uxLevel = ( UBaseType_t ) 0U, uxSlot;
+
+		listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xExpiryTime );
+		listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+
+		xTicksToExpiry = ( TickType_t ) ( xExpiryTime - pxWheel->xWheelTime );
+		xSlotTime = xExpiryTime;
+
+		if( xTicksToExpiry >= tmrWHEEL_RANGE )
+		{
+			/* Beyond the range of the wheel.  The timer will be placed again
+			when the slot is moved down the wheel. */
+			xTicksToExpiry = tmrWHEEL_RANGE - ( TickType_t ) 1;
+			xSlotTime = pxWheel->xWheelTime + xTicksToExpiry;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Level n holds the timers that expire less than 32^(n+1) ticks from
+		the wheel time. */
+		while( ( xTicksToExpiry >> ( tmrWHEEL_SLOT_BITS * ( uxLevel + ( UBaseType_t ) 1U ) ) ) != ( TickType_t ) 0 )
+		{
+			uxLevel++;
+		}
+
+		uxSlot = ( UBaseType_t ) ( xSlotTime >> ( tmrWHEEL_SLOT_BITS * uxLevel ) ) & tmrWHEEL_SLOT_MASK;
+		vListInsertEnd( &( pxWheel->xSlots[ ( uxLevel << tmrWHEEL_SLOT_BITS ) + uxSlot ] ), &( pxTimer->xTimerListItem ) );
+		pxWheel->ulSlotsInUse[ uxLevel ] |= ( uint32_t ) 1 << uxSlot;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvRemoveTimerFromWheel( TimerWheel_t * const pxWheel, Timer_t * const pxTimer )
+	{
+	List_t * const pxSlot = listLIST_ITEM_CONTAINER( &( pxTimer->xTimerListItem ) );
+	UBaseType_t uxIndex;
+
+		if( uxListRemove( &( pxTimer->xTimerListItem ) ) == ( UBaseType_t ) 0 )
+		{
+			/* The slot is now empty. */
+			uxIndex = ( UBaseType_t ) ( pxSlot - pxWheel->xSlots );
+			pxWheel->ulSlotsInUse[ uxIndex >> tmrWHEEL_SLOT_BITS ] &= ~( ( uint32_t ) 1 << ( uxIndex & tmrWHEEL_SLOT_MASK ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvMoveSlotsDownWheel( TimerWheel_t * const pxWheel )
+	{
+	UBaseType_t uxLevel, uxShift, uxSlot;
+	List_t *pxSlot;
+	Timer_t *pxTimer;
+
+		/* Level n is only at the start of a slot's period when levels 0 to
+		n - 1 have wrapped back to slot 0. */
+		for( uxLevel = ( UBaseType_t ) 1U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+		{
+			uxShift = tmrWHEEL_SLOT_BITS * uxLevel;
+
+			if( ( pxWheel->xWheelTime & ( TickType_t ) ( ( ( TickType_t ) 1 << uxShift ) - ( TickType_t ) 1 ) ) != ( TickType_t ) 0 )
+			{
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			uxSlot = ( UBaseType_t ) ( pxWheel->xWheelTime >> uxShift ) & tmrWHEEL_SLOT_MASK;
+			pxSlot = &( pxWheel->xSlots[ ( uxLevel << tmrWHEEL_SLOT_BITS ) + uxSlot ] );
+			pxWheel->ulSlotsInUse[ uxLevel ] &= ~( ( uint32_t ) 1 << uxSlot );
+
+			while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+			{
+				pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				prvInsertTimerInWheel( pxWheel, pxTimer, listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) ) );
+			}
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static TickType_t prvGetTicksToNextWheelEvent( const TimerWheel_t * const pxWheel, BaseType_t * const pxWheelIsEmpty )
+	{
+	TickType_t xTicksToEvent = portMAX_DELAY, xTicks, xLevelTime;
+	UBaseType_t uxLevel, uxShift, uxRotate;
+	uint32_t ulSlotsInUse;
+
+		*pxWheelIsEmpty = pdTRUE;
+
+		for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+		{
+			ulSlotsInUse = pxWheel->ulSlotsInUse[ uxLevel ];
+
+			if( ulSlotsInUse != 0UL )
+			{
+				*pxWheelIsEmpty = pdFALSE;
+				uxShift = tmrWHEEL_SLOT_BITS * uxLevel;
+				xLevelTime = pxWheel->xWheelTime >> uxShift;
+
+				/* Rotate the bit map so bit 0 represents the slot after the
+				current slot.  The timers in the current slot for this period
+				have already been moved down the wheel, so anything left in
+				the current slot is for the same slot one revolution later. */
+				uxRotate = ( ( UBaseType_t ) xLevelTime + ( UBaseType_t ) 1U ) & tmrWHEEL_SLOT_MASK;
+
+				if( uxRotate != ( UBaseType_t ) 0U )
+				{
+					ulSlotsInUse = ( ulSlotsInUse >> uxRotate ) | ( ulSlotsInUse << ( ( UBaseType_t ) 32U - uxRotate ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* The first occupied slot needs processing at the start of
+				its period. */
+				xTicks = ( TickType_t ) ( ( TickType_t ) ( ( xLevelTime + ( TickType_t ) prvGetLowestSetBit( ulSlotsInUse ) + ( TickType_t ) 1 ) << uxShift ) - pxWheel->xWheelTime );
+
+				if( xTicks < xTicksToEvent )
+				{
+					xTicksToEvent = xTicks;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return xTicksToEvent;
+	}
+	/*-----------------------------------------------------------*/
+
+	static UBaseType_t prvGetLowestSetBit( uint32_t ulBitmap )
+	{
+	static const uint8_t ucBitPosition[ 32 ] = { 0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8, 31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9 };
+
+		/* Isolate the least significant set bit, then use a de Bruijn
+		sequence to map it to its index without a loop. */
+		return ( UBaseType_t ) ucBitPosition[ ( uint32_t ) ( ( ulBitmap & ( ( uint32_t ) 0 - ulBitmap ) ) * ( uint32_t ) 0x077CB531UL ) >> 27 ];
+	}
+
+#endif /* configUSE_TIMER_WHEEL */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HARD_TIMERS == 1 )
+
+	static BaseType_t prvHardTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue )
+	{
+	BaseType_t xReturn = pdPASS;
+	BaseType_t xFreeTimer = pdFALSE;
+	UBaseType_t uxSavedInterruptStatus = 0U;
+	TickType_t xTimeNow, xTimeSinceCommand;
+
+		/* The hard timer lists are also accessed from the tick interrupt. */
+		if( xCommandID >= tmrFIRST_FROM_ISR_COMMAND )
+		{
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+			xTimeNow = xTaskGetTickCountFromISR();
+		}
+		else
+		{
+			taskENTER_CRITICAL();
+			xTimeNow = xTaskGetTickCount();
+		}
+		{
+			/* The timer is going to be moved or removed, so remove it from the
+			list it is in now, if any. */
+			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+			{
+				#if ( configUSE_TIMER_WHEEL == 1 )
+				{
+					prvRemoveTimerFromWheel( &xHardTimerWheel, pxTimer );
+				}
+				#else
+				{
+					( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				}
+				#endif /* configUSE_TIMER_WHEEL */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			switch( xCommandID )
+			{
+				case tmrCOMMAND_START :
+				case tmrCOMMAND_START_FROM_ISR :
+				case tmrCOMMAND_RESET :
+				case tmrCOMMAND_RESET_FROM_ISR :
+				case tmrCOMMAND_START_DONT_TRACE :
+					/* xOptionalValue is the time at which the command was
+					issued.  The timer expires one period after that time, or
+					on the next tick if that time has already passed. */
+					xTimeSinceCommand = xTimeNow - xOptionalValue;
+					pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
+
+					if( xTimeSinceCommand < pxTimer->xTimerPeriodInTicks )
+					{
+						prvInsertHardTimer( pxTimer, xTimeNow, pxTimer->xTimerPeriodInTicks - xTimeSinceCommand );
+					}
+					else
+					{
+						prvInsertHardTimer( pxTimer, xTimeNow, ( TickType_t ) 1U );
+					}
+					break;
+
+				case tmrCOMMAND_CHANGE_PERIOD :
+				case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
+					/* The new period does not really have a reference, and can
+					be longer or shorter than the old one.  The command time is
+					therefore set to the current time. */
+					pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
+					pxTimer->xTimerPeriodInTicks = xOptionalValue;
+					configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+					prvInsertHardTimer( pxTimer, xTimeNow, pxTimer->xTimerPeriodInTicks );
+					break;
+
+				case tmrCOMMAND_STOP :
+				case tmrCOMMAND_STOP_FROM_ISR :
+					/* The timer has already been removed from the list. */
+					pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+					break;
+
+				case tmrCOMMAND_DELETE :
+					pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+
+					#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+					{
+						/* The memory is freed once the critical section has
+						been exited. */
+						if( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
+						{
+							xFreeTimer = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+					break;
+
+				default	:
+					/* Don't expect to get here. */
+					xReturn = pdFAIL;
+					break;
+			}
+		}
+		if( xCommandID >= tmrFIRST_FROM_ISR_COMMAND )
+		{
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		else
+		{
+			taskEXIT_CRITICAL();
+		}
+
+		if( xFreeTimer != pdFALSE )
+		{
+			vPortFree( pxTimer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configUSE_HARD_TIMERS */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_HARD_TIMERS == 1 ) && ( configUSE_TIMER_WHEEL == 1 ) )
+
+	static void prvInsertHardTimer( Timer_t * const pxTimer, const TickType_t xTimeNow, const TickType_t xTicksToExpiry )
+	{
+	BaseType_t xWheelIsEmpty;
+
+		/* The wheel time is moved forward each time the wheel is processed,
+		so it only needs bringing up to date if the wheel is empty. */
+		( void ) prvGetTicksToNextWheelEvent( &xHardTimerWheel, &xWheelIsEmpty );
+
+		if( xWheelIsEmpty != pdFALSE )
+		{
+			xHardTimerWheel.xWheelTime = xTimeNow;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		prvInsertTimerInWheel( &xHardTimerWheel, pxTimer, xTimeNow + xTicksToExpiry );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTimerProcessHardTimers( const TickType_t xTimeNow )
+	{
+	Timer_t *pxTimer;
+	List_t *pxSlot;
+	TickType_t xTicksToEvent, xExpiryTime, xTimeSinceExpiry;
+	BaseType_t xWheelIsEmpty;
+
+		/* The slots are not initialised until the first timer is created, but
+		until then the wheel is empty so no slot is accessed.  This is called
+		each time the tick count is incremented, so there is normally only one
+		wheel event to process. */
+		for( ;; )
+		{
+			xTicksToEvent = prvGetTicksToNextWheelEvent( &xHardTimerWheel, &xWheelIsEmpty );
+
+			if( ( xWheelIsEmpty != pdFALSE ) || ( xTicksToEvent > ( TickType_t ) ( xTimeNow - xHardTimerWheel.xWheelTime ) ) )
+			{
+				xHardTimerWheel.xWheelTime = xTimeNow;
+				break;
+			}
+			else
+			{
+				xHardTimerWheel.xWheelTime += xTicksToEvent;
+			}
+
+			prvMoveSlotsDownWheel( &xHardTimerWheel );
+
+			/* Every timer in the level 0 slot for the current time has
+			expired. */
+			pxSlot = &( xHardTimerWheel.xSlots[ ( UBaseType_t ) xHardTimerWheel.xWheelTime & tmrWHEEL_SLOT_MASK ] );
+
+			while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+			{
+				pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				xExpiryTime = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+				prvRemoveTimerFromWheel( &xHardTimerWheel, pxTimer );
+
+				if( xExpiryTime == xHardTimerWheel.xWheelTime )
+				{
+					traceTIMER_EXPIRED( pxTimer );
+
+					if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0U )
+					{
+						/* Reload in the same way as when the hard timer lists
+						are used.  Either way the timer is placed after
+						xTimeNow, so not in this slot. */
+						xTimeSinceExpiry = xTimeNow - xExpiryTime;
+
+						if( xTimeSinceExpiry < pxTimer->xTimerPeriodInTicks )
+						{
+							prvInsertTimerInWheel( &xHardTimerWheel, pxTimer, xExpiryTime + pxTimer->xTimerPeriodInTicks );
+						}
+						else
+						{
+							prvInsertTimerInWheel( &xHardTimerWheel, pxTimer, xTimeNow + ( TickType_t ) 1U );
+						}
+					}
+					else
+					{
+						pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+					}
+
+					/* Call the timer callback from the tick interrupt. */
+					pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+				}
+				else
+				{
+					/* Only possible if configTIMER_WHEEL_LEVELS is 1, in which
+					case level 0 also holds the timers that are out of range. */
+					prvInsertTimerInWheel( &xHardTimerWheel, pxTimer, xExpiryTime );
+				}
+			}
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	TickType_t xTimerGetTicksToNextHardTimer( const TickType_t xTimeNow )
+	{
+	TickType_t xReturn = portMAX_DELAY, xTicksToEvent, xTicksSinceWheelTime;
+	BaseType_t xWheelIsEmpty;
+
+		/* Hard timers can be started and stopped from interrupts.  The tick
+		interrupt must also not be suppressed beyond the time at which a slot
+		must be moved down the wheel. */
+		taskENTER_CRITICAL();
+		{
+			xTicksToEvent = prvGetTicksToNextWheelEvent( &xHardTimerWheel, &xWheelIsEmpty );
+			xTicksSinceWheelTime = ( TickType_t ) ( xTimeNow - xHardTimerWheel.xWheelTime );
+
+			if( xWheelIsEmpty != pdFALSE )
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+			else if( xTicksToEvent <= xTicksSinceWheelTime )
+			{
+				xReturn = ( TickType_t ) 0U;
+			}
+			else
+			{
+				xReturn = xTicksToEvent - xTicksSinceWheelTime;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* ( configUSE_HARD_TIMERS == 1 ) && ( configUSE_TIMER_WHEEL == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_HARD_TIMERS == 1 ) && ( configUSE_TIMER_WHEEL == 0 ) )
+
+	static void prvInsertHardTimer( Timer_t * const pxTimer, const TickType_t xTimeNow, const TickType_t xTicksToExpiry )
+	{
+	const TickType_t xExpiryTime = xTimeNow + xTicksToExpiry;
+
+		listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xExpiryTime );
+		listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+
+		if( xExpiryTime < xTimeNow )
+		{
+			/* The expiry time has overflowed. */
+			vListInsert( pxOverflowHardTimerList, &( pxTimer->xTimerListItem ) );
+		}
+		else
+		{
+			vListInsert( pxCurrentHardTimerList, &( pxTimer->xTimerListItem ) );
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTimerProcessHardTimers( const TickType_t xTimeNow )
+	{
+	Timer_t *pxTimer;
+	List_t *pxTemp;
+	TickType_t xExpiryTime, xTimeSinceExpiry;
+
+		/* The hard timer lists are not initialised until the first timer is
+		created. */
+		if( pxCurrentHardTimerList != NULL )
+		{
+			if( xTimeNow == ( TickType_t ) 0U )
+			{
+				/* The tick count has overflowed.  Every timer in the current
+				list expired before the overflow, so the list is empty. */
+				configASSERT( ( listLIST_IS_EMPTY( pxCurrentHardTimerList ) ) );
+				pxTemp = pxCurrentHardTimerList;
+				pxCurrentHardTimerList = pxOverflowHardTimerList;
+				pxOverflowHardTimerList = pxTemp;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Timers are held in expiry time order, so processing can stop at
+			the first timer that has not expired. */
+			while( listLIST_IS_EMPTY( pxCurrentHardTimerList ) == pdFALSE )
+			{
+				xExpiryTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentHardTimerList );
+
+				if( xExpiryTime > xTimeNow )
+				{
+					break;
+				}
+
+				pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentHardTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				traceTIMER_EXPIRED( pxTimer );
+
+				if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0U )
+				{
+					/* Reload relative to the time at which the timer should
+					have expired, so the period does not drift.  The timer can
+					only have expired in the past if the tick interrupt was
+					suppressed beyond its expiry time, in which case it next
+					expires on the following tick. */
+					xTimeSinceExpiry = xTimeNow - xExpiryTime;
+
+					if( xTimeSinceExpiry < pxTimer->xTimerPeriodInTicks )
+					{
+						prvInsertHardTimer( pxTimer, xTimeNow, pxTimer->xTimerPeriodInTicks - xTimeSinceExpiry );
+					}
+					else
+					{
+						prvInsertHardTimer( pxTimer, xTimeNow, ( TickType_t ) 1U );
+					}
+				}
+				else
+				{
+					pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+				}
+
+				/* Call the timer callback from the tick interrupt. */
+				pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+			}
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	TickType_t xTimerGetTicksToNextHardTimer( const TickType_t xTimeNow )
+	{
+	TickType_t xReturn = portMAX_DELAY;
+
+		/* Hard timers can be started and stopped from interrupts. */
+		taskENTER_CRITICAL();
+		{
+			if( pxCurrentHardTimerList != NULL )
+			{
+				if( listLIST_IS_EMPTY( pxCurrentHardTimerList ) == pdFALSE )
+				{
+					xReturn = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentHardTimerList ) - xTimeNow;
+				}
+				else if( listLIST_IS_EMPTY( pxOverflowHardTimerList ) == pdFALSE )
+				{
+					xReturn = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxOverflowHardTimerList ) - xTimeNow;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* ( configUSE_HARD_TIMERS == 1 ) && ( configUSE_TIMER_WHEEL == 0 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_DIRECT_TIMER_COMMANDS == 1 )
+
+	static BaseType_t prvDirectTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue )
+	{
+	BaseType_t xReturn = pdFAIL;
+	TickType_t xTimeNow, xCommandTime = ( TickType_t ) 0U, xTicksToExpiry = ( TickType_t ) 0U;
+
+		/* Suspending the scheduler prevents the timer service task running,
+		and any other task updating the active timers, until the command has
+		been applied. */
+		vTaskSuspendAll();
+		{
+			xTimeNow = xTaskGetTickCount();
+
+			/* The timer service task must be blocked.  Commands already in the
+			queue were sent first, so must also be processed first. */
+			if( ( xTimerTaskIsWaiting != pdFALSE ) && ( uxQueueMessagesWaiting( xTimerQueue ) == ( UBaseType_t ) 0 ) )
+			{
+				switch( xCommandID )
+				{
+					case tmrCOMMAND_START :
+					case tmrCOMMAND_RESET :
+					case tmrCOMMAND_CHANGE_PERIOD :
+						if( xCommandID == tmrCOMMAND_CHANGE_PERIOD )
+						{
+							configASSERT( ( xOptionalValue > 0 ) );
+							xCommandTime = xTimeNow;
+							xTicksToExpiry = xOptionalValue;
+						}
+						else
+						{
+							xCommandTime = xOptionalValue;
+							xTicksToExpiry = pxTimer->xTimerPeriodInTicks;
+						}
+
+						/* The timer service task must process the command if
+						the timer has already expired, or if the timer service
+						task would need to wake earlier than it is going to. */
+						if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) < xTicksToExpiry ) &&
+							( ( TickType_t ) ( xTimerTaskWakeTime - xTimeNow ) <= ( TickType_t ) ( ( xCommandTime + xTicksToExpiry ) - xTimeNow ) ) )
+						{
+							xReturn = pdPASS;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+						break;
+
+					case tmrCOMMAND_STOP :
+					case tmrCOMMAND_DELETE :
+						/* Removing a timer can only make the timer service task
+						wake before it needs to, which is harmless. */
+						xReturn = pdPASS;
+						break;
+
+					default :
+						/* Other commands are only sent by the timer service task
+						itself. */
+						break;
+				}
+
+				#if ( configUSE_TIMER_WHEEL == 0 )
+				{
+					/* Timers cannot be inserted into the active lists if the
+					tick count has overflowed since the timer service task last
+					switched the lists. */
+					if( xTimeNow < xLastTime )
+					{
+						xReturn = pdFAIL;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_TIMER_WHEEL */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xReturn != pdFAIL )
+			{
+				if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
+				{
+					prvRemoveTimerFromActiveList( pxTimer );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				switch( xCommandID )
+				{
+					case tmrCOMMAND_START :
+					case tmrCOMMAND_RESET :
+					case tmrCOMMAND_CHANGE_PERIOD :
+						pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
+						pxTimer->xTimerPeriodInTicks = xTicksToExpiry;
+
+						/* It has already been checked that the timer has not
+						expired, so it does not need processing now. */
+						( void ) prvInsertTimerInActiveList( pxTimer, xCommandTime + xTicksToExpiry, xTimeNow, xCommandTime );
+						break;
+
+					case tmrCOMMAND_DELETE :
+						pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+
+						#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+						{
+							if( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
+							{
+								vPortFree( pxTimer );
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+						break;
+
+					default :
+						/* Stop the timer.  It has already been removed from the
+						active timers. */
+						pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+						break;
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		( void ) xTaskResumeAll();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_DIRECT_TIMER_COMMANDS */
+/*-----------------------------------------------------------*/
+
+static void prvCheckForValidListAndQueue( void )
+{
+	/* Check that the list from which active timers are referenced, and the
+	queue used to communicate with the timer service, have been
+	initialised. */
+	taskENTER_CRITICAL();
+	{
+		if( xTimerQueue == NULL )
+		{
+			#if ( configUSE_TIMER_WHEEL == 1 )
+			{
+				UBaseType_t uxSlot;
+
+				for( uxSlot = ( UBaseType_t ) 0U; uxSlot < ( ( UBaseType_t ) configTIMER_WHEEL_LEVELS * tmrWHEEL_SLOTS ); uxSlot++ )
+				{
+					vListInitialise( &( xTimerWheel.xSlots[ uxSlot ] ) );
+
+					#if ( configUSE_HARD_TIMERS == 1 )
+					{
+						vListInitialise( &( xHardTimerWheel.xSlots[ uxSlot ] ) );
+					}
+					#endif /* configUSE_HARD_TIMERS */
+				}
+			}
+			#else
+			{
+				vListInitialise( &xActiveTimerList1 );
+				vListInitialise( &xActiveTimerList2 );
+				pxCurrentTimerList = &xActiveTimerList1;
+				pxOverflowTimerList = &xActiveTimerList2;
+			}
+			#endif /* configUSE_TIMER_WHEEL */
+
+			#if ( ( configUSE_HARD_TIMERS == 1 ) && ( configUSE_TIMER_WHEEL == 0 ) )
+			{
+				if( pxCurrentHardTimerList == NULL )
+				{
+					vListInitialise( &xHardTimerList1 );
+					vListInitialise( &xHardTimerList2 );
+					pxOverflowHardTimerList = &xHardTimerList2;
+					pxCurrentHardTimerList = &xHardTimerList1;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_HARD_TIMERS */
 
 			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{